@@ -0,0 +1,103 @@
+#include <algorithm>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Search kernels over an s21::vector<int32_t> / <float> at each SIMD level
+// the CPU supports, next to the std:: algorithms on the same data.
+// Usage: s21_algorithm_bench [elements]
+namespace {
+
+const char *Name(s21::simd::level level) {
+  switch (level) {
+    case s21::simd::level::kAvx2:
+      return "avx2";
+    case s21::simd::level::kSse42:
+      return "sse4.2";
+    default:
+      return "scalar";
+  }
+}
+
+template <typename T>
+void Run(const char *type, s21::vector<T> &items, s21::vector<T> &sorted) {
+  const size_t n = items.size();
+  const T missing = static_cast<T>(-1);
+  const T *first = items.data();
+  const T *last = first + n;
+  const size_t probes = 1000;
+  char name[64];
+
+  std::snprintf(name, sizeof(name), "std::find %s", type);
+  s21_bench::Report(name, s21_bench::BestOf(5, [&] {
+                      s21_bench::DoNotOptimize(std::find(first, last, missing));
+                    }), n);
+  std::snprintf(name, sizeof(name), "std::min_element %s", type);
+  s21_bench::Report(name, s21_bench::BestOf(5, [&] {
+                      s21_bench::DoNotOptimize(std::min_element(first, last));
+                    }), n);
+  std::snprintf(name, sizeof(name), "std::lower_bound %s", type);
+  s21_bench::Report(name, s21_bench::BestOf(5, [&] {
+                      for (size_t i = 0; i < probes; ++i) {
+                        s21_bench::DoNotOptimize(std::lower_bound(
+                            sorted.begin(), sorted.end(),
+                            static_cast<T>(i * 7919 % n)));
+                      }
+                    }), probes);
+
+  const s21::simd::level levels[] = {s21::simd::level::kScalar,
+                                     s21::simd::level::kSse42,
+                                     s21::simd::level::kAvx2};
+  for (s21::simd::level level : levels) {
+    if (level > s21::simd::supported()) {
+      continue;
+    }
+    s21::simd::limit(level);
+    std::snprintf(name, sizeof(name), "find %s %s", type, Name(level));
+    s21_bench::Report(name, s21_bench::BestOf(5, [&] {
+                        s21_bench::DoNotOptimize(s21::find(items, missing));
+                      }), n);
+    std::snprintf(name, sizeof(name), "count %s %s", type, Name(level));
+    s21_bench::Report(name, s21_bench::BestOf(5, [&] {
+                        s21_bench::DoNotOptimize(s21::count(items, missing));
+                      }), n);
+    std::snprintf(name, sizeof(name), "min_element %s %s", type, Name(level));
+    s21_bench::Report(name, s21_bench::BestOf(5, [&] {
+                        s21_bench::DoNotOptimize(s21::min_element(items));
+                      }), n);
+    std::snprintf(name, sizeof(name), "lower_bound %s %s", type, Name(level));
+    s21_bench::Report(name, s21_bench::BestOf(5, [&] {
+                        for (size_t i = 0; i < probes; ++i) {
+                          s21_bench::DoNotOptimize(s21::lower_bound(
+                              sorted, static_cast<T>(i * 7919 % n)));
+                        }
+                      }), probes);
+  }
+  s21::simd::limit(s21::simd::level::kAvx2);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 1 << 20);
+
+  s21::vector<int32_t> ints;
+  s21::vector<float> floats;
+  uint32_t state = 12345;
+  for (size_t i = 0; i < n; ++i) {
+    state = state * 1664525u + 1013904223u;
+    ints.push_back(static_cast<int32_t>(state % n));
+    floats.push_back(static_cast<float>(state % n));
+  }
+  s21::vector<int32_t> sorted_ints(ints);
+  s21::vector<float> sorted_floats(floats);
+  std::sort(sorted_ints.begin(), sorted_ints.end());
+  std::sort(sorted_floats.begin(), sorted_floats.end());
+
+  std::printf("%zu elements, best level %s\n", n,
+              Name(s21::simd::supported()));
+  Run("int32", ints, sorted_ints);
+  Run("float", floats, sorted_floats);
+  return 0;
+}
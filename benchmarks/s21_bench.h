@@ -0,0 +1,68 @@
+#ifndef SRC_BENCHMARKS_S21_BENCH_H_
+#define SRC_BENCHMARKS_S21_BENCH_H_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+// The container headers rely on their includer for the standard library
+// (the tests get it through gtest), so benchmarks pull it in here.
+#include <initializer_list>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+
+namespace s21_bench {
+
+// Keeps the compiler from optimizing away a computed value.
+template <typename T>
+inline void DoNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+inline void ClobberMemory() { asm volatile("" : : : "memory"); }
+
+// Runs fn repeat times and returns the best wall time in nanoseconds.
+template <typename F>
+double BestOf(int repeat, F &&fn) {
+  double best = 0;
+  for (int i = 0; i < repeat; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    fn();
+    auto stop = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    if (i == 0 || ns < best) {
+      best = ns;
+    }
+  }
+  return best;
+}
+
+inline void Report(const char *name, double ns, double items) {
+  std::printf("%-44s %12.3f ms %10.3f ns/item\n", name, ns / 1e6,
+              items > 0 ? ns / items : 0.0);
+}
+
+// xorshift64: a fast, reproducible sequence for generating inputs. The
+// state must not start at zero.
+inline uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+inline size_t ArgOr(int argc, char **argv, int index, size_t fallback) {
+  if (argc > index) {
+    return static_cast<size_t>(std::strtoull(argv[index], nullptr, 10));
+  }
+  return fallback;
+}
+
+}  // namespace s21_bench
+
+#endif  // SRC_BENCHMARKS_S21_BENCH_H_
@@ -0,0 +1,87 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Mixed read/write throughput (90% find, 10% insert_or_assign over random
+// keys) of concurrent_map against one mutex around an s21::map, from 1 to
+// 64 threads.
+// Usage: s21_concurrent_map_bench [keys] [ops per thread] [max threads]
+namespace {
+
+class LockedMap {
+ public:
+  bool Find(uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void Assign(uint64_t key, uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<uint64_t, uint64_t> map_;
+};
+
+template <typename Op>
+double Throughput(size_t threads, size_t ops, Op op) {
+  double ns = s21_bench::BestOf(3, [&] {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&op, ops, t] {
+        uint64_t state = 88172645463325252ull + t * 7919;
+        for (size_t i = 0; i < ops; ++i) {
+          op(s21_bench::NextRandom(state));
+        }
+      });
+    }
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+  });
+  return static_cast<double>(threads * ops) / ns * 1e3;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t keys = s21_bench::ArgOr(argc, argv, 1, 100000);
+  const size_t ops = s21_bench::ArgOr(argc, argv, 2, 200000);
+  const size_t max_threads = s21_bench::ArgOr(argc, argv, 3, 64);
+
+  s21::concurrent_map<uint64_t, uint64_t> sharded;
+  LockedMap locked;
+  for (size_t i = 0; i < keys; ++i) {
+    sharded.insert(i, i);
+    locked.Assign(i, i);
+  }
+
+  std::printf("%zu keys, %zu ops/thread, %u hardware threads\n", keys, ops,
+              std::thread::hardware_concurrency());
+  std::printf("%8s %16s %16s\n", "threads", "mutex Mops/s", "sharded Mops/s");
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    double mutex_mops = Throughput(threads, ops, [&](uint64_t r) {
+      uint64_t key = (r >> 8) % keys;
+      if (r % 10 == 0) {
+        locked.Assign(key, r);
+      } else {
+        s21_bench::DoNotOptimize(locked.Find(key));
+      }
+    });
+    double sharded_mops = Throughput(threads, ops, [&](uint64_t r) {
+      uint64_t key = (r >> 8) % keys;
+      if (r % 10 == 0) {
+        sharded.insert_or_assign(key, r);
+      } else {
+        s21_bench::DoNotOptimize(sharded.contains(key));
+      }
+    });
+    std::printf("%8zu %16.2f %16.2f\n", threads, mutex_mops, sharded_mops);
+  }
+  return 0;
+}
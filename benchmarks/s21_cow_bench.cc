@@ -0,0 +1,88 @@
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Copy cost and first-write cost: a plain copy of s21::vector / s21::map
+// against a cow copy, then the first write through that copy (which
+// clones for cow) and a second write (in place for both).
+// Usage: s21_cow_bench [elements] [copies]
+namespace {
+
+double Since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+// Times each phase separately per copy and keeps the best of three runs.
+template <typename MakeCopy, typename Write>
+void Measure(const char *name, size_t copies, MakeCopy make_copy,
+             Write write) {
+  double best[3] = {0, 0, 0};
+  for (int run = 0; run < 3; ++run) {
+    double total[3] = {0, 0, 0};
+    for (size_t i = 0; i < copies; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      auto copy = make_copy();
+      s21_bench::ClobberMemory();
+      total[0] += Since(start);
+      start = std::chrono::steady_clock::now();
+      write(copy, i);
+      s21_bench::ClobberMemory();
+      total[1] += Since(start);
+      start = std::chrono::steady_clock::now();
+      write(copy, i + 1);
+      s21_bench::ClobberMemory();
+      total[2] += Since(start);
+      s21_bench::DoNotOptimize(copy);
+    }
+    for (int phase = 0; phase < 3; ++phase) {
+      if (run == 0 || total[phase] < best[phase]) {
+        best[phase] = total[phase];
+      }
+    }
+  }
+  std::printf(
+      "%-10s copy %12.1f ns   first write %12.1f ns   second write %8.1f "
+      "ns\n",
+      name, best[0] / copies, best[1] / copies, best[2] / copies);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 100000);
+  const size_t copies = s21_bench::ArgOr(argc, argv, 2, 50);
+
+  s21::vector<uint64_t> vector;
+  s21::map<uint64_t, uint64_t> map;
+  for (size_t i = 0; i < n; ++i) {
+    vector.push_back(i);
+    map.insert(i, i);
+  }
+  s21::cow_vector<uint64_t> shared_vector(vector);
+  s21::cow_map<uint64_t, uint64_t> shared_map(map);
+
+  std::printf("%zu elements, %zu copies\n", n, copies);
+  Measure(
+      "vector", copies, [&] { return s21::vector<uint64_t>(vector); },
+      [&](s21::vector<uint64_t> &copy, size_t i) { copy[i % n] = i; });
+  Measure(
+      "cow_vector", copies,
+      [&] { return s21::cow_vector<uint64_t>(shared_vector); },
+      [&](s21::cow_vector<uint64_t> &copy, size_t i) {
+        copy.write()[i % n] = i;
+      });
+  Measure(
+      "map", copies, [&] { return s21::map<uint64_t, uint64_t>(map); },
+      [&](s21::map<uint64_t, uint64_t> &copy, size_t i) {
+        copy.insert_or_assign(i % n, i);
+      });
+  Measure(
+      "cow_map", copies,
+      [&] { return s21::cow_map<uint64_t, uint64_t>(shared_map); },
+      [&](s21::cow_map<uint64_t, uint64_t> &copy, size_t i) {
+        copy.write().insert_or_assign(i % n, i);
+      });
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include <algorithm>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Fork-join on the work-stealing pool: naive parallel fib (one task per
+// call above a cutoff, so scheduling overhead dominates) and a parallel
+// sort, from one thread up to every hardware thread, with the per-worker
+// steal and idle counters of the last run.
+// Usage: s21_fork_join_bench [fib n] [sort elements] [max threads]
+namespace {
+
+uint64_t SerialFib(uint64_t n) { return n < 2 ? n : SerialFib(n - 1) + SerialFib(n - 2); }
+
+uint64_t Fib(s21::thread_pool &pool, uint64_t n) {
+  if (n < 10) {
+    return SerialFib(n);
+  }
+  uint64_t left = 0;
+  s21::task_group group(pool);
+  group.run([&] { left = Fib(pool, n - 1); });
+  uint64_t right = Fib(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const uint64_t fib_n = s21_bench::ArgOr(argc, argv, 1, 34);
+  const size_t sort_n = s21_bench::ArgOr(argc, argv, 2, 10000000);
+  const size_t max_threads = s21_bench::ArgOr(
+      argc, argv, 3, s21::thread_pool::default_threads() + 1);
+
+  s21::vector<int32_t> source(sort_n);
+  uint32_t state = 2463534242u;
+  for (size_t i = 0; i < sort_n; ++i) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    source[i] = static_cast<int32_t>(state);
+  }
+
+  double serial_ns = s21_bench::BestOf(3, [&] {
+    s21_bench::DoNotOptimize(SerialFib(fib_n));
+  });
+  std::printf("fib(%llu) serial %.1f ms\n",
+              static_cast<unsigned long long>(fib_n), serial_ns / 1e6);
+  std::printf("%8s %12s %12s\n", "threads", "fib ms", "sort ms");
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    s21::thread_pool pool(threads - 1);
+    double fib_ns = s21_bench::BestOf(3, [&] {
+      s21_bench::DoNotOptimize(Fib(pool, fib_n));
+    });
+    s21::vector<int32_t> items;
+    double sort_ns = s21_bench::BestOf(3, [&] {
+      items = source;
+      s21::sort(s21::execution::par.on(pool), items.begin(), items.end());
+    });
+    std::printf("%8zu %12.1f %12.1f\n", threads, fib_ns / 1e6, sort_ns / 1e6);
+
+    pool.reset_stats();
+    Fib(pool, fib_n);
+    for (size_t i = 0; i < pool.size(); ++i) {
+      s21::thread_pool::worker_stats stats = pool.stats(i);
+      std::printf("    worker %zu: %llu run, %llu stolen, %llu failed steals, "
+                  "%llu sleeps, %.1f ms idle\n",
+                  i, static_cast<unsigned long long>(stats.executed),
+                  static_cast<unsigned long long>(stats.stolen),
+                  static_cast<unsigned long long>(stats.failed_steals),
+                  static_cast<unsigned long long>(stats.sleeps),
+                  static_cast<double>(stats.idle_ns) / 1e6);
+    }
+    if (threads < max_threads && threads * 2 > max_threads) {
+      threads = max_threads / 2;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,46 @@
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Random point lookups: s21::map against the same keys frozen into an
+// Eytzinger-ordered frozen_map.
+// Usage: s21_frozen_map_bench [elements]
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 1000000);
+  const size_t lookups = 1000000;
+
+  s21::map<uint64_t, uint64_t> map;
+  for (size_t i = 0; i < n; ++i) {
+    map.insert(i * 2, i);
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  s21::frozen_map<uint64_t, uint64_t> frozen(map);
+  double freeze_ms = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+  double map_ns = s21_bench::BestOf(3, [&] {
+    uint64_t state = 88172645463325252ull;
+    uint64_t hits = 0;
+    for (size_t i = 0; i < lookups; ++i) {
+      hits += map.contains(s21_bench::NextRandom(state) % (2 * n));
+    }
+    s21_bench::DoNotOptimize(hits);
+  });
+
+  double frozen_ns = s21_bench::BestOf(3, [&] {
+    uint64_t state = 88172645463325252ull;
+    uint64_t hits = 0;
+    for (size_t i = 0; i < lookups; ++i) {
+      hits += frozen.contains(s21_bench::NextRandom(state) % (2 * n));
+    }
+    s21_bench::DoNotOptimize(hits);
+  });
+
+  std::printf("%zu keys, freeze %.1f ms, buffer %.1f MB\n", n, freeze_ms,
+              static_cast<double>(frozen.data_size()) / 1e6);
+  s21_bench::Report("map contains", map_ns, lookups);
+  s21_bench::Report("frozen_map contains", frozen_ns, lookups);
+  return 0;
+}
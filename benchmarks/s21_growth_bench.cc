@@ -0,0 +1,82 @@
+#include <cmath>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+
+// Vector growth policies: reallocations, moved elements and unused bytes
+// while growing by push_back, averaged over final sizes spread
+// log-uniformly up to the given maximum. "jemalloc" adds the slack of the
+// size class the final buffer would land in.
+// Usage: s21_growth_bench [max elements]
+namespace {
+
+struct Record {
+  char bytes[24];
+};
+
+template <typename T, typename Policy>
+void Run(const char *policy, size_t max_size) {
+  const int samples = 256;
+  double reallocs = 0;
+  double moved = 0;
+  double wasted = 0;
+  double reserved = 0;
+
+  for (int s = 1; s <= samples; ++s) {
+    double fraction = static_cast<double>(s) / samples;
+    size_t n = static_cast<size_t>(
+        std::ceil(std::pow(static_cast<double>(max_size), fraction)));
+
+    s21::vector<T, Policy> vec;
+    size_t capacity = vec.capacity();
+    for (size_t i = 0; i < n; ++i) {
+      vec.push_back(T());
+      if (vec.capacity() != capacity) {
+        reallocs += 1;
+        moved += static_cast<double>(i);
+        capacity = vec.capacity();
+      }
+    }
+    size_t used = vec.size() * sizeof(T);
+    size_t bytes = vec.capacity() * sizeof(T);
+    wasted += static_cast<double>(bytes - used);
+    reserved += static_cast<double>(
+        s21::size_class_growth<>::size_class(bytes) - used);
+  }
+
+  double ns = s21_bench::BestOf(3, [&] {
+    s21::vector<T, Policy> grown;
+    for (size_t i = 0; i < max_size; ++i) {
+      grown.push_back(T());
+    }
+    s21_bench::DoNotOptimize(grown.data());
+  });
+
+  std::printf("%-12s %-8s %9.1f %12.1f %13.1f %13.1f %9.3f\n", policy,
+              sizeof(T) == sizeof(int) ? "int" : "24-byte", reallocs / samples,
+              moved / samples, wasted / samples, reserved / samples,
+              ns / 1e6);
+}
+
+template <typename T>
+void RunAll(size_t max_size) {
+  Run<T, s21::golden_growth>("golden", max_size);
+  Run<T, s21::growth_1_5x>("1.5x", max_size);
+  Run<T, s21::growth_2x>("2x", max_size);
+  Run<T, s21::page_growth<>>("page", max_size);
+  Run<T, s21::size_class_growth<>>("size-class", max_size);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t max_size = s21_bench::ArgOr(argc, argv, 1, 1000000);
+
+  std::printf("growth up to %zu elements, averages per final size\n",
+              max_size);
+  std::printf("%-12s %-8s %9s %12s %13s %13s %9s\n", "policy", "element",
+              "reallocs", "moved elems", "unused bytes", "jemalloc", "fill ms");
+  RunAll<int>(max_size);
+  RunAll<Record>(max_size);
+  return 0;
+}
@@ -0,0 +1,116 @@
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+
+// new[] versus mmap/huge-page backed vectors: push_back growth time to
+// 1..max GiB of uint64_t, then dTLB load misses over random reads.
+// TLB counters come from perf_event_open and print as n/a when the kernel
+// does not allow them.
+// Usage: s21_hugepage_bench [max GiB]
+namespace {
+
+class DtlbMisses {
+ public:
+  DtlbMisses() {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HW_CACHE;
+    attr.config = PERF_COUNT_HW_CACHE_DTLB |
+                  (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                  (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+  }
+  ~DtlbMisses() {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  void Start() {
+    if (fd_ >= 0) {
+      ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+  // Returns -1 when the counter is unavailable.
+  long long Stop() {
+    long long count = -1;
+    if (fd_ >= 0) {
+      ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd_, &count, sizeof(count)) != sizeof(count)) {
+        count = -1;
+      }
+    }
+    return count;
+  }
+
+ private:
+  int fd_;
+};
+
+template <typename Vector>
+void Run(const char *storage, size_t gib) {
+  const size_t n = (gib << 30) / sizeof(uint64_t);
+  const size_t reads = size_t(1) << 24;
+
+  Vector vec;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < n; ++i) {
+    vec.push_back(i);
+  }
+  double grow_ms = std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+
+  DtlbMisses counter;
+  uint64_t state = 88172645463325252ull;
+  uint64_t sum = 0;
+  start = std::chrono::steady_clock::now();
+  counter.Start();
+  for (size_t i = 0; i < reads; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    sum += vec[state % n];
+  }
+  long long misses = counter.Stop();
+  double read_ms = std::chrono::duration<double, std::milli>(
+                       std::chrono::steady_clock::now() - start)
+                       .count();
+  s21_bench::DoNotOptimize(sum);
+
+  char tlb[32];
+  if (misses < 0) {
+    std::snprintf(tlb, sizeof(tlb), "n/a");
+  } else {
+    std::snprintf(tlb, sizeof(tlb), "%.3f",
+                  static_cast<double>(misses) / static_cast<double>(reads));
+  }
+  std::printf("%4zu GiB  %-6s %12.1f %12.1f %14s\n", gib, storage, grow_ms,
+              read_ms, tlb);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t max_gib = s21_bench::ArgOr(argc, argv, 1, 1);
+
+  std::printf("%8s  %-6s %12s %12s %14s\n", "size", "alloc", "grow ms",
+              "16M reads ms", "dTLB miss/read");
+  for (size_t gib = 1; gib <= max_gib; gib *= 2) {
+    Run<s21::vector<uint64_t>>("new[]", gib);
+    Run<s21::vector<uint64_t, s21::golden_growth, s21::mmap_storage<>>>(
+        "mmap", gib);
+  }
+  return 0;
+}
@@ -0,0 +1,156 @@
+#include <utility>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Dijkstra on a random sparse graph. s21::indexed_heap with decrease_key
+// against the s21::multiset workaround (erase the old (distance, vertex)
+// entry, insert the new one) and, for reference, s21::priority_queue with
+// lazy deletion of stale entries.
+// Usage: s21_indexed_heap_bench [vertices] [degree]
+namespace {
+
+constexpr uint64_t kUnreached = ~0ull;
+
+struct Graph {
+  size_t vertices;
+  s21::vector<size_t> first;  // CSR offsets, vertices + 1 of them
+  s21::vector<uint32_t> target;
+  s21::vector<uint32_t> weight;
+};
+
+Graph MakeGraph(size_t vertices, size_t degree) {
+  Graph graph{vertices, {}, {}, {}};
+  uint64_t state = 88172645463325252ull;
+  for (size_t v = 0; v < vertices; ++v) {
+    graph.first.push_back(v * degree);
+    for (size_t e = 0; e < degree; ++e) {
+      graph.target.push_back(
+          static_cast<uint32_t>(s21_bench::NextRandom(state) % vertices));
+      graph.weight.push_back(
+          static_cast<uint32_t>(s21_bench::NextRandom(state) % 1000 + 1));
+    }
+  }
+  graph.first.push_back(vertices * degree);
+  return graph;
+}
+
+uint64_t Checksum(s21::vector<uint64_t> &dist) {
+  uint64_t sum = 0;
+  for (size_t v = 0; v < dist.size(); ++v) {
+    sum += dist[v] == kUnreached ? 0 : dist[v];
+  }
+  return sum;
+}
+
+uint64_t DijkstraIndexedHeap(Graph &graph) {
+  s21::vector<uint64_t> dist(graph.vertices);
+  s21::vector<size_t> handle(graph.vertices);
+  s21::vector<bool> queued(graph.vertices);
+  for (size_t v = 0; v < graph.vertices; ++v) {
+    dist[v] = kUnreached;
+    queued[v] = false;
+  }
+  s21::indexed_heap<uint32_t, uint64_t> heap;
+  dist[0] = 0;
+  handle[0] = heap.push(0, 0);
+  queued[0] = true;
+  while (!heap.empty()) {
+    uint32_t u = heap.key(heap.top());
+    heap.pop();
+    queued[u] = false;
+    for (size_t e = graph.first[u]; e < graph.first[u + 1]; ++e) {
+      uint32_t v = graph.target[e];
+      uint64_t candidate = dist[u] + graph.weight[e];
+      if (candidate < dist[v]) {
+        if (queued[v]) {
+          heap.decrease_key(handle[v], candidate);
+        } else {
+          handle[v] = heap.push(v, candidate);
+          queued[v] = true;
+        }
+        dist[v] = candidate;
+      }
+    }
+  }
+  return Checksum(dist);
+}
+
+uint64_t DijkstraMultiset(Graph &graph) {
+  s21::vector<uint64_t> dist(graph.vertices);
+  for (size_t v = 0; v < graph.vertices; ++v) {
+    dist[v] = kUnreached;
+  }
+  s21::multiset<std::pair<uint64_t, uint32_t>> queue;
+  dist[0] = 0;
+  queue.insert({0, 0});
+  while (!queue.empty()) {
+    auto top = queue.begin();
+    uint32_t u = (*top).second;
+    queue.erase(top);
+    for (size_t e = graph.first[u]; e < graph.first[u + 1]; ++e) {
+      uint32_t v = graph.target[e];
+      uint64_t candidate = dist[u] + graph.weight[e];
+      if (candidate < dist[v]) {
+        if (dist[v] != kUnreached) {
+          queue.erase(queue.find({dist[v], v}));
+        }
+        dist[v] = candidate;
+        queue.insert({candidate, v});
+      }
+    }
+  }
+  return Checksum(dist);
+}
+
+uint64_t DijkstraLazy(Graph &graph) {
+  s21::vector<uint64_t> dist(graph.vertices);
+  for (size_t v = 0; v < graph.vertices; ++v) {
+    dist[v] = kUnreached;
+  }
+  using Entry = std::pair<uint64_t, uint32_t>;
+  s21::priority_queue<Entry, s21::vector<Entry>, std::greater<Entry>, 4> queue;
+  dist[0] = 0;
+  queue.push({0, 0});
+  while (!queue.empty()) {
+    Entry top = queue.top();
+    queue.pop();
+    uint32_t u = top.second;
+    if (top.first != dist[u]) {
+      continue;
+    }
+    for (size_t e = graph.first[u]; e < graph.first[u + 1]; ++e) {
+      uint32_t v = graph.target[e];
+      uint64_t candidate = dist[u] + graph.weight[e];
+      if (candidate < dist[v]) {
+        dist[v] = candidate;
+        queue.push({candidate, v});
+      }
+    }
+  }
+  return Checksum(dist);
+}
+
+template <typename Run>
+void Measure(const char *name, Graph &graph, Run run) {
+  uint64_t checksum = 0;
+  double ns = s21_bench::BestOf(3, [&] { checksum = run(graph); });
+  s21_bench::Report(name, ns, graph.target.size());
+  std::printf("  checksum %llu\n", static_cast<unsigned long long>(checksum));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t vertices = s21_bench::ArgOr(argc, argv, 1, 200000);
+  const size_t degree = s21_bench::ArgOr(argc, argv, 2, 8);
+  Graph graph = MakeGraph(vertices, degree);
+
+  std::printf("%zu vertices, %zu edges (time per edge)\n", vertices,
+              graph.target.size());
+  Measure("multiset erase+insert", graph, DijkstraMultiset);
+  Measure("indexed_heap decrease_key", graph, DijkstraIndexedHeap);
+  Measure("priority_queue lazy deletion", graph, DijkstraLazy);
+  return 0;
+}
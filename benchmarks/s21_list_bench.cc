@@ -0,0 +1,76 @@
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+
+// Iterator-heavy loops over s21::list.
+// Usage: s21_list_bench [elements]
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 1000000);
+  const int repeat = 5;
+
+  s21::list<int> l;
+  for (size_t i = 0; i < n; ++i) {
+    l.push_back(static_cast<int>(i));
+  }
+
+  std::printf("s21::list<int>, %zu elements\n", n);
+
+  double ns = s21_bench::BestOf(repeat, [&] {
+    long long sum = 0;
+    for (auto iter = l.begin(); iter != l.end(); ++iter) {
+      sum += *iter;
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("forward iteration", ns, static_cast<double>(n));
+
+  ns = s21_bench::BestOf(repeat, [&] {
+    long long sum = 0;
+    auto iter = l.end();
+    for (size_t i = 0; i < n; ++i) {
+      --iter;
+      sum += *iter;
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("backward iteration", ns, static_cast<double>(n));
+
+  ns = s21_bench::BestOf(repeat, [&] {
+    for (auto iter = l.begin(); iter != l.end(); ++iter) {
+      ++(*iter);
+    }
+    s21_bench::ClobberMemory();
+  });
+  s21_bench::Report("forward write", ns, static_cast<double>(n));
+
+  ns = s21_bench::BestOf(repeat, [&] {
+    auto iter = l.begin();
+    for (size_t i = 0; i < n; ++i) {
+      iter = l.insert(iter, 0);
+      ++iter;
+      ++iter;
+    }
+  });
+  s21_bench::Report("insert every other", ns, static_cast<double>(n));
+
+  ns = s21_bench::BestOf(1, [&] {
+    auto iter = l.begin();
+    while (iter != l.end()) {
+      auto erased = iter;
+      ++iter;
+      if (*erased == 0) {
+        l.erase(erased);
+      }
+    }
+  });
+  s21_bench::Report("erase while iterating", ns, static_cast<double>(l.size()));
+
+  ns = s21_bench::BestOf(repeat, [&] {
+    for (size_t i = 0; i < n; ++i) {
+      l.push_front(1);
+      l.pop_back();
+    }
+  });
+  s21_bench::Report("push_front + pop_back", ns, static_cast<double>(n));
+
+  return 0;
+}
@@ -0,0 +1,151 @@
+#include <utility>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Hit-path latency of s21::lru_cache in each eviction mode against the
+// hand-rolled s21::list + s21::map<key, list::iterator> LRU it replaces,
+// then a skewed workload over 10x more keys than fit, reporting time per
+// access and hit ratio.
+// Usage: s21_lru_cache_bench [capacity] [accesses]
+namespace {
+
+// Small keys are much more likely than large ones.
+uint64_t SkewedKey(uint64_t &state, uint64_t keys) {
+  return s21_bench::NextRandom(state) %
+         (s21_bench::NextRandom(state) % keys + 1);
+}
+
+class ListMapLru {
+ public:
+  explicit ListMapLru(size_t capacity) : capacity_(capacity) {}
+
+  uint64_t *get(uint64_t key) {
+    auto found = index_.find(key);
+    if (found == index_.end()) {
+      return nullptr;
+    }
+    auto item = (*found).second;
+    order_.splice(order_.cbegin(), order_, item);
+    return &(*item).second;
+  }
+
+  void put(uint64_t key, uint64_t value) {
+    if (uint64_t *existing = get(key)) {
+      *existing = value;
+      return;
+    }
+    if (index_.size() == capacity_) {
+      index_.erase(index_.find(order_.back().first));
+      order_.pop_back();
+    }
+    order_.push_front({key, value});
+    index_.insert(key, order_.begin());
+  }
+
+ private:
+  using Order = s21::list<std::pair<uint64_t, uint64_t>>;
+
+  size_t capacity_;
+  Order order_;
+  s21::map<uint64_t, Order::iterator> index_;
+};
+
+template <typename Cache>
+void Run(const char *name, Cache &cache, size_t capacity, size_t accesses) {
+  for (uint64_t key = 0; key < capacity; ++key) {
+    cache.put(key, key);
+  }
+  double hit_ns = s21_bench::BestOf(3, [&] {
+    uint64_t state = 88172645463325252ull;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < accesses; ++i) {
+      sum += *cache.get(s21_bench::NextRandom(state) % capacity);
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report(name, hit_ns, accesses);
+}
+
+template <typename Cache>
+void RunSkewed(const char *name, Cache &cache, size_t capacity,
+               size_t accesses) {
+  size_t hits = 0;
+  double ns = s21_bench::BestOf(1, [&] {
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < accesses; ++i) {
+      uint64_t key = SkewedKey(state, 10 * capacity);
+      if (cache.get(key) != nullptr) {
+        ++hits;
+      } else {
+        cache.put(key, key);
+      }
+    }
+  });
+  s21_bench::Report(name, ns, accesses);
+  std::printf("  hit ratio %.3f\n",
+              static_cast<double>(hits) / static_cast<double>(accesses));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t capacity = s21_bench::ArgOr(argc, argv, 1, 100000);
+  const size_t accesses = s21_bench::ArgOr(argc, argv, 2, 2000000);
+  using Cache = s21::lru_cache<uint64_t, uint64_t>;
+
+  std::printf("capacity %zu, %zu accesses\nAll hits:\n", capacity, accesses);
+  {
+    ListMapLru cache(capacity);
+    Run("list + map LRU get", cache, capacity, accesses);
+  }
+  {
+    Cache cache(capacity, s21::eviction_policy::kLru);
+    Run("lru_cache kLru get", cache, capacity, accesses);
+  }
+  {
+    Cache cache(capacity, s21::eviction_policy::kClock);
+    Run("lru_cache kClock get", cache, capacity, accesses);
+  }
+  {
+    Cache cache(capacity, s21::eviction_policy::kSieve);
+    Run("lru_cache kSieve get", cache, capacity, accesses);
+  }
+  {
+    s21::sharded_lru_cache<uint64_t, uint64_t> cache(
+        capacity, s21::eviction_policy::kSieve);
+    for (uint64_t key = 0; key < capacity; ++key) {
+      cache.put(key, key);
+    }
+    double ns = s21_bench::BestOf(3, [&] {
+      uint64_t state = 88172645463325252ull;
+      uint64_t sum = 0;
+      for (size_t i = 0; i < accesses; ++i) {
+        // Keys spread over the shards, so a few may have been evicted.
+        sum += cache.get(s21_bench::NextRandom(state) % capacity).value_or(0);
+      }
+      s21_bench::DoNotOptimize(sum);
+    });
+    s21_bench::Report("sharded_lru_cache kSieve get", ns, accesses);
+  }
+
+  std::printf("Skewed over %zu keys, miss inserts:\n", 10 * capacity);
+  {
+    ListMapLru cache(capacity);
+    RunSkewed("list + map LRU", cache, capacity, accesses);
+  }
+  {
+    Cache cache(capacity, s21::eviction_policy::kLru);
+    RunSkewed("lru_cache kLru", cache, capacity, accesses);
+  }
+  {
+    Cache cache(capacity, s21::eviction_policy::kClock);
+    RunSkewed("lru_cache kClock", cache, capacity, accesses);
+  }
+  {
+    Cache cache(capacity, s21::eviction_policy::kSieve);
+    RunSkewed("lru_cache kSieve", cache, capacity, accesses);
+  }
+  return 0;
+}
@@ -0,0 +1,87 @@
+#include <string>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Startup cost of a sorted record array kept in a file: reading it into
+// s21::vector versus opening it as s21::mmap_vector, plus one full scan.
+// Usage: s21_mmap_vector_bench [records] [path]
+namespace {
+
+struct Record {
+  uint64_t key;
+  uint64_t value;
+};
+
+double Millis(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+template <typename Vector>
+uint64_t Scan(Vector &vec, size_t n) {
+  uint64_t sum = 0;
+  for (size_t i = 0; i < n; ++i) {
+    sum += vec.data()[i].value;
+  }
+  return sum;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 8000000);
+  const std::string path =
+      argc > 2 ? argv[2] : "/tmp/s21_mmap_vector_bench.bin";
+
+  {
+    std::remove(path.c_str());
+    s21::mmap_vector<Record> file(path.c_str());
+    file.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      file.push_back(Record{i, i * 3});
+    }
+    file.sync();
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  s21::vector<Record> loaded;
+  {
+    std::FILE *file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+      std::perror("fopen");
+      return 1;
+    }
+    Record chunk[4096];
+    std::fseek(file, 64, SEEK_SET);
+    size_t got = 0;
+    while ((got = std::fread(chunk, sizeof(Record), 4096, file)) > 0) {
+      loaded.insert(loaded.cend(), chunk, chunk + got);
+    }
+    std::fclose(file);
+  }
+  double load_ms = Millis(start);
+  start = std::chrono::steady_clock::now();
+  s21_bench::DoNotOptimize(Scan(loaded, loaded.size()));
+  double load_scan_ms = Millis(start);
+
+  start = std::chrono::steady_clock::now();
+  s21::mmap_vector<Record> mapped(path.c_str(), s21::mmap_mode::read_only);
+  s21_bench::DoNotOptimize(mapped.back().value);
+  double map_ms = Millis(start);
+  start = std::chrono::steady_clock::now();
+  s21_bench::DoNotOptimize(Scan(mapped, mapped.size()));
+  double map_scan_ms = Millis(start);
+
+  std::printf("%zu records of %zu bytes\n", n, sizeof(Record));
+  std::printf("%-24s %12s %12s\n", "", "open ms", "scan ms");
+  std::printf("%-24s %12.3f %12.3f\n", "read into s21::vector", load_ms,
+              load_scan_ms);
+  std::printf("%-24s %12.3f %12.3f\n", "s21::mmap_vector", map_ms,
+              map_scan_ms);
+
+  std::remove(path.c_str());
+  return 0;
+}
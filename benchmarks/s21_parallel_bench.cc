@@ -0,0 +1,72 @@
+#include <algorithm>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Scaling of the parallel algorithms over an s21::vector<int32_t>, from
+// one thread (the caller alone) up to every hardware thread.
+// Usage: s21_parallel_bench [elements] [max threads]
+namespace {
+
+void Fill(s21::vector<int32_t> &items) {
+  uint32_t state = 2463534242u;
+  for (size_t i = 0; i < items.size(); ++i) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    items[i] = static_cast<int32_t>(state & 0xffffff);
+  }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 100000000);
+  const size_t hardware = s21::thread_pool::default_threads() + 1;
+  const size_t max_threads = s21_bench::ArgOr(argc, argv, 2, hardware);
+
+  s21::vector<int32_t> items(n);
+  s21::vector<int32_t> out(n);
+  Fill(items);
+
+  std::printf("%zu elements, %zu hardware threads\n", n, hardware);
+  std::printf("%8s %12s %12s %12s %12s %12s\n", "threads", "for_each ms",
+              "transform ms", "reduce ms", "scan ms", "sort ms");
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    s21::thread_pool pool(threads - 1);
+    auto par = s21::execution::par.on(pool);
+    double for_each_ns = s21_bench::BestOf(3, [&] {
+      s21::for_each(par, items.begin(), items.end(),
+                    [](int32_t &x) { x = x * 3 + 1; });
+    });
+    double transform_ns = s21_bench::BestOf(3, [&] {
+      s21::transform(par, items.begin(), items.end(), out.begin(),
+                     [](int32_t x) { return x ^ (x >> 3); });
+    });
+    double reduce_ns = s21_bench::BestOf(3, [&] {
+      s21_bench::DoNotOptimize(
+          s21::reduce(par, items.begin(), items.end(), int64_t{0}));
+    });
+    double scan_ns = s21_bench::BestOf(3, [&] {
+      s21::inclusive_scan(par, items.begin(), items.end(), out.begin());
+    });
+    double sort_ns = 0;
+    for (int i = 0; i < 2; ++i) {
+      Fill(items);
+      auto start = std::chrono::steady_clock::now();
+      s21::sort(par, items.begin(), items.end());
+      double ns = std::chrono::duration<double, std::nano>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+      sort_ns = i == 0 || ns < sort_ns ? ns : sort_ns;
+    }
+    std::printf("%8zu %12.1f %12.1f %12.1f %12.1f %12.1f\n", threads,
+                for_each_ns / 1e6, transform_ns / 1e6, reduce_ns / 1e6,
+                scan_ns / 1e6, sort_ns / 1e6);
+    if (threads < max_threads && threads * 2 > max_threads) {
+      threads = max_threads / 2;
+    }
+  }
+  return 0;
+}
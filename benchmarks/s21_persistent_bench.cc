@@ -0,0 +1,156 @@
+#include <vector>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Versioned updates: each of `updates` random edits keeps the previous
+// version alive as a snapshot. s21::map and s21::vector have to copy the
+// whole container per snapshot; the persistent ones copy one path. Also
+// compares batch building through a transient and plain lookups.
+// Usage: s21_persistent_bench [elements] [updates]
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 100000);
+  const size_t updates = s21_bench::ArgOr(argc, argv, 2, 200);
+  const size_t lookups = 1000000;
+
+  std::printf("%zu elements, %zu snapshotted updates\n", n, updates);
+
+  // Map
+  s21::map<uint64_t, uint64_t> map;
+  for (size_t i = 0; i < n; ++i) {
+    map.insert(i, i);
+  }
+  double map_build_ns = s21_bench::BestOf(3, [&] {
+    s21::map<uint64_t, uint64_t> built;
+    for (size_t i = 0; i < n; ++i) {
+      built.insert(i, i);
+    }
+    s21_bench::DoNotOptimize(built.size());
+  });
+  double persistent_build_ns = s21_bench::BestOf(3, [&] {
+    s21::persistent_map<uint64_t, uint64_t>::transient_type edit;
+    for (size_t i = 0; i < n; ++i) {
+      edit.insert(i, i);
+    }
+    s21_bench::DoNotOptimize(edit.persistent().size());
+  });
+  s21::persistent_map<uint64_t, uint64_t> persistent(map);
+
+  double map_update_ns = s21_bench::BestOf(3, [&] {
+    std::vector<s21::map<uint64_t, uint64_t>> history;
+    history.push_back(map);
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < updates; ++i) {
+      s21::map<uint64_t, uint64_t> next(history.back());
+      next.insert_or_assign(s21_bench::NextRandom(state) % n, i);
+      history.push_back(next);
+    }
+    s21_bench::DoNotOptimize(history.size());
+  });
+  double persistent_update_ns = s21_bench::BestOf(3, [&] {
+    std::vector<s21::persistent_map<uint64_t, uint64_t>> history;
+    history.push_back(persistent);
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < updates; ++i) {
+      history.push_back(
+          history.back().insert_or_assign(s21_bench::NextRandom(state) % n, i));
+    }
+    s21_bench::DoNotOptimize(history.size());
+  });
+
+  double map_lookup_ns = s21_bench::BestOf(3, [&] {
+    uint64_t state = 88172645463325252ull;
+    uint64_t hits = 0;
+    for (size_t i = 0; i < lookups; ++i) {
+      hits += map.contains(s21_bench::NextRandom(state) % (2 * n));
+    }
+    s21_bench::DoNotOptimize(hits);
+  });
+  double persistent_lookup_ns = s21_bench::BestOf(3, [&] {
+    uint64_t state = 88172645463325252ull;
+    uint64_t hits = 0;
+    for (size_t i = 0; i < lookups; ++i) {
+      hits += persistent.contains(s21_bench::NextRandom(state) % (2 * n));
+    }
+    s21_bench::DoNotOptimize(hits);
+  });
+
+  s21_bench::Report("map build (insert)", map_build_ns, n);
+  s21_bench::Report("persistent_map build (transient)", persistent_build_ns,
+                    n);
+  s21_bench::Report("map copy + update", map_update_ns, updates);
+  s21_bench::Report("persistent_map update", persistent_update_ns, updates);
+  s21_bench::Report("map contains", map_lookup_ns, lookups);
+  s21_bench::Report("persistent_map contains", persistent_lookup_ns, lookups);
+
+  // Vector
+  s21::vector<uint64_t> vector;
+  for (size_t i = 0; i < n; ++i) {
+    vector.push_back(i);
+  }
+  double vector_build_ns = s21_bench::BestOf(3, [&] {
+    s21::vector<uint64_t> built;
+    for (size_t i = 0; i < n; ++i) {
+      built.push_back(i);
+    }
+    s21_bench::DoNotOptimize(built.size());
+  });
+  s21::persistent_vector<uint64_t> pvector;
+  double pvector_build_ns = s21_bench::BestOf(3, [&] {
+    s21::persistent_vector<uint64_t>::transient_type edit;
+    for (size_t i = 0; i < n; ++i) {
+      edit.push_back(i);
+    }
+    pvector = edit.persistent();
+  });
+
+  double vector_update_ns = s21_bench::BestOf(3, [&] {
+    std::vector<s21::vector<uint64_t>> history;
+    history.push_back(vector);
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < updates; ++i) {
+      s21::vector<uint64_t> next(history.back());
+      next[s21_bench::NextRandom(state) % n] = i;
+      history.push_back(next);
+    }
+    s21_bench::DoNotOptimize(history.size());
+  });
+  double pvector_update_ns = s21_bench::BestOf(3, [&] {
+    std::vector<s21::persistent_vector<uint64_t>> history;
+    history.push_back(pvector);
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < updates; ++i) {
+      history.push_back(
+          history.back().set(s21_bench::NextRandom(state) % n, i));
+    }
+    s21_bench::DoNotOptimize(history.size());
+  });
+
+  double vector_read_ns = s21_bench::BestOf(3, [&] {
+    uint64_t state = 88172645463325252ull;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < lookups; ++i) {
+      sum += vector[s21_bench::NextRandom(state) % n];
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  double pvector_read_ns = s21_bench::BestOf(3, [&] {
+    uint64_t state = 88172645463325252ull;
+    uint64_t sum = 0;
+    for (size_t i = 0; i < lookups; ++i) {
+      sum += pvector[s21_bench::NextRandom(state) % n];
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+
+  s21_bench::Report("vector build (push_back)", vector_build_ns, n);
+  s21_bench::Report("persistent_vector build (transient)", pvector_build_ns,
+                    n);
+  s21_bench::Report("vector copy + set", vector_update_ns, updates);
+  s21_bench::Report("persistent_vector set", pvector_update_ns, updates);
+  s21_bench::Report("vector random read", vector_read_ns, lookups);
+  s21_bench::Report("persistent_vector random read", pvector_read_ns,
+                    lookups);
+  return 0;
+}
@@ -0,0 +1,85 @@
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Scheduler-style workload: a queue held at `size` entries where each step
+// pops the earliest deadline and pushes a new one. s21::multiset (the old
+// workaround: a node allocation per push, pointer chasing per pop) against
+// binary and 4-ary s21::priority_queue. Also times O(n) heapify.
+// Usage: s21_priority_queue_bench [size] [steps]
+namespace {
+
+template <typename Queue>
+double RunHeap(size_t size, size_t steps) {
+  return s21_bench::BestOf(3, [&] {
+    Queue queue;
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < size; ++i) {
+      queue.push(s21_bench::NextRandom(state));
+    }
+    uint64_t sum = 0;
+    for (size_t i = 0; i < steps; ++i) {
+      sum += queue.top();
+      queue.pop();
+      queue.push(s21_bench::NextRandom(state));
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+}
+
+double RunMultiset(size_t size, size_t steps) {
+  return s21_bench::BestOf(3, [&] {
+    s21::multiset<uint64_t> queue;
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < size; ++i) {
+      queue.insert(s21_bench::NextRandom(state));
+    }
+    uint64_t sum = 0;
+    for (size_t i = 0; i < steps; ++i) {
+      auto top = queue.begin();
+      sum += *top;
+      queue.erase(top);
+      queue.insert(s21_bench::NextRandom(state));
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+}
+
+template <typename Queue>
+double RunHeapify(const s21::vector<uint64_t> &items) {
+  return s21_bench::BestOf(3, [&] {
+    Queue queue(items.cbegin(), items.cend());
+    s21_bench::DoNotOptimize(queue.top());
+  });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t size = s21_bench::ArgOr(argc, argv, 1, 100000);
+  const size_t steps = s21_bench::ArgOr(argc, argv, 2, 1000000);
+
+  using Binary = s21::priority_queue<uint64_t, s21::vector<uint64_t>,
+                                     std::greater<uint64_t>>;
+  using Quaternary =
+      s21::priority_queue<uint64_t, s21::vector<uint64_t>,
+                          std::greater<uint64_t>, 4>;
+
+  std::printf("%zu queued, %zu pop+push steps\n", size, steps);
+  s21_bench::Report("multiset pop+push", RunMultiset(size, steps), steps);
+  s21_bench::Report("priority_queue<2> pop+push", RunHeap<Binary>(size, steps),
+                    steps);
+  s21_bench::Report("priority_queue<4> pop+push",
+                    RunHeap<Quaternary>(size, steps), steps);
+
+  s21::vector<uint64_t> items;
+  uint64_t state = 88172645463325252ull;
+  for (size_t i = 0; i < 10 * size; ++i) {
+    items.push_back(s21_bench::NextRandom(state));
+  }
+  s21_bench::Report("priority_queue<2> heapify", RunHeapify<Binary>(items),
+                    items.size());
+  s21_bench::Report("priority_queue<4> heapify",
+                    RunHeapify<Quaternary>(items), items.size());
+  return 0;
+}
@@ -0,0 +1,132 @@
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Reader throughput while one writer updates continuously: rcu_map
+// against an s21::map behind a std::shared_mutex (readers share, the
+// writer excludes them) and behind a plain std::mutex. Readers do random
+// lookups; the writer reassigns random keys as fast as it can.
+// Usage: s21_rcu_map_bench [keys] [lookups per reader] [max readers]
+namespace {
+
+class SharedLockedMap {
+ public:
+  bool Find(uint64_t key) {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void Assign(uint64_t key, uint64_t value) {
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+ private:
+  std::shared_mutex mutex_;
+  s21::map<uint64_t, uint64_t> map_;
+};
+
+class LockedMap {
+ public:
+  bool Find(uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void Assign(uint64_t key, uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<uint64_t, uint64_t> map_;
+};
+
+struct Result {
+  double reader_mops;
+  double writer_kops;
+};
+
+// Runs `readers` threads of `lookups` finds each next to one writer that
+// assigns until the readers finish.
+template <typename Find, typename Assign>
+Result Measure(size_t readers, size_t lookups, size_t keys, Find find,
+               Assign assign) {
+  std::atomic<size_t> writes(0);
+  double ns = s21_bench::BestOf(3, [&] {
+    std::atomic<bool> done(false);
+    std::thread writer([&] {
+      uint64_t state = 0x2545F4914F6CDD1Dull;
+      size_t count = 0;
+      while (!done.load(std::memory_order_relaxed)) {
+        uint64_t r = s21_bench::NextRandom(state);
+        assign((r >> 8) % keys, r);
+        ++count;
+      }
+      writes.store(count);
+    });
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < readers; ++t) {
+      workers.emplace_back([&, t] {
+        uint64_t state = 88172645463325252ull + t * 7919;
+        for (size_t i = 0; i < lookups; ++i) {
+          s21_bench::DoNotOptimize(
+              find((s21_bench::NextRandom(state) >> 8) % keys));
+        }
+      });
+    }
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+    done.store(true);
+    writer.join();
+  });
+  return Result{static_cast<double>(readers * lookups) / ns * 1e3,
+                static_cast<double>(writes.load()) / ns * 1e6};
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t keys = s21_bench::ArgOr(argc, argv, 1, 100000);
+  const size_t lookups = s21_bench::ArgOr(argc, argv, 2, 500000);
+  const size_t max_readers = s21_bench::ArgOr(argc, argv, 3, 16);
+
+  s21::map<uint64_t, uint64_t> initial;
+  for (size_t i = 0; i < keys; ++i) {
+    initial.insert(i, i);
+  }
+  s21::rcu_map<uint64_t, uint64_t> rcu(initial);
+  SharedLockedMap shared;
+  LockedMap locked;
+  for (size_t i = 0; i < keys; ++i) {
+    shared.Assign(i, i);
+    locked.Assign(i, i);
+  }
+
+  std::printf("%zu keys, %zu lookups/reader, %u hardware threads\n", keys,
+              lookups, std::thread::hardware_concurrency());
+  std::printf("%8s %24s %24s %24s\n", "readers", "mutex Mops/s (writes/ms)",
+              "rwlock Mops/s (writes/ms)", "rcu Mops/s (writes/ms)");
+  for (size_t readers = 1; readers <= max_readers; readers *= 2) {
+    Result mutex_result = Measure(
+        readers, lookups, keys, [&](uint64_t key) { return locked.Find(key); },
+        [&](uint64_t key, uint64_t value) { locked.Assign(key, value); });
+    Result shared_result = Measure(
+        readers, lookups, keys, [&](uint64_t key) { return shared.Find(key); },
+        [&](uint64_t key, uint64_t value) { shared.Assign(key, value); });
+    Result rcu_result = Measure(
+        readers, lookups, keys, [&](uint64_t key) { return rcu.contains(key); },
+        [&](uint64_t key, uint64_t value) { rcu.insert_or_assign(key, value); });
+    std::printf("%8zu %14.2f (%7.1f) %15.2f (%7.1f) %14.2f (%7.1f)\n", readers,
+                mutex_result.reader_mops, mutex_result.writer_kops,
+                shared_result.reader_mops, shared_result.writer_kops,
+                rcu_result.reader_mops, rcu_result.writer_kops);
+  }
+  return 0;
+}
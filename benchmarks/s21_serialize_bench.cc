@@ -0,0 +1,66 @@
+#include <sstream>
+#include <string>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+
+// save()/load() throughput through in-memory streams, plus the sorted
+// linear build of trees against inserting the same keys one by one.
+// Usage: s21_serialize_bench [elements]
+namespace {
+
+template <typename Container>
+void Run(const char *name, const Container &container, size_t n) {
+  std::string bytes;
+  double save_ns = s21_bench::BestOf(3, [&] {
+    std::ostringstream os;
+    container.save(os);
+    bytes = os.str();
+  });
+
+  double load_ns = s21_bench::BestOf(3, [&] {
+    std::istringstream is(bytes);
+    Container loaded;
+    loaded.load(is);
+    s21_bench::DoNotOptimize(loaded.size());
+  });
+
+  double size = static_cast<double>(bytes.size());
+  std::printf("%-28s %10.1f MB %9.2f GB/s save %9.2f GB/s load %7.1f ns/elem\n",
+              name, size / 1e6, size / save_ns, size / load_ns,
+              load_ns / static_cast<double>(n));
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 1000000);
+
+  s21::vector<int64_t> ints;
+  s21::vector<std::string> strings;
+  s21::list<int64_t> list;
+  s21::map<int64_t, int64_t> map;
+  for (size_t i = 0; i < n; ++i) {
+    int64_t value = static_cast<int64_t>(i);
+    ints.push_back(value);
+    strings.push_back("value-" + std::to_string(i));
+    list.push_back(value);
+    map.insert(value, value);
+  }
+
+  std::printf("%zu elements\n", n);
+  Run("vector<int64_t> (bulk)", ints, n);
+  Run("vector<string>", strings, n);
+  Run("list<int64_t>", list, n);
+  Run("map<int64_t, int64_t>", map, n);
+
+  double insert_ns = s21_bench::BestOf(3, [&] {
+    s21::map<int64_t, int64_t> rebuilt;
+    for (auto iter = map.cbegin(); iter != map.cend(); ++iter) {
+      rebuilt.insert(*iter);
+    }
+    s21_bench::DoNotOptimize(rebuilt.size());
+  });
+  s21_bench::Report("map rebuild by insert", insert_ns, n);
+  return 0;
+}
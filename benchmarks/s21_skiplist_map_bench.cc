@@ -0,0 +1,124 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Mixed throughput (80% find, 10% insert, 10% erase over random keys,
+// about half of them present) of skiplist_map against one mutex around an
+// s21::map, from 1 to 64 threads; plus ordered scans of 32 elements from
+// lower_bound, which a sharded map cannot serve.
+// Usage: s21_skiplist_map_bench [keys] [ops per thread] [max threads]
+namespace {
+
+constexpr int kScanLength = 32;
+
+class LockedMap {
+ public:
+  bool Find(uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+  void Insert(uint64_t key, uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert(key, value);
+  }
+  void Erase(uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = map_.find(key);
+    if (iter != map_.end()) {
+      map_.erase(iter);
+    }
+  }
+  uint64_t Scan(uint64_t key) {
+    // s21::map has no lower_bound; walk from the key when present.
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t sum = 0;
+    auto iter = map_.find(key);
+    for (int i = 0; i < kScanLength && iter != map_.end(); ++i, ++iter) {
+      sum += (*iter).second;
+    }
+    return sum;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<uint64_t, uint64_t> map_;
+};
+
+template <typename Op>
+double Throughput(size_t threads, size_t ops, Op op) {
+  double ns = s21_bench::BestOf(3, [&] {
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < threads; ++t) {
+      workers.emplace_back([&op, ops, t] {
+        uint64_t state = 88172645463325252ull + t * 7919;
+        for (size_t i = 0; i < ops; ++i) {
+          op(s21_bench::NextRandom(state));
+        }
+      });
+    }
+    for (std::thread &worker : workers) {
+      worker.join();
+    }
+  });
+  return static_cast<double>(threads * ops) / ns * 1e3;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t keys = s21_bench::ArgOr(argc, argv, 1, 100000);
+  const size_t ops = s21_bench::ArgOr(argc, argv, 2, 200000);
+  const size_t max_threads = s21_bench::ArgOr(argc, argv, 3, 64);
+
+  s21::skiplist_map<uint64_t, uint64_t> skiplist;
+  LockedMap locked;
+  for (size_t i = 0; i < keys; i += 2) {
+    skiplist.insert(i, i);
+    locked.Insert(i, i);
+  }
+
+  std::printf("%zu keys, %zu ops/thread, %u hardware threads\n", keys, ops,
+              std::thread::hardware_concurrency());
+  std::printf("%8s %16s %16s %16s %16s\n", "threads", "mutex Mops/s", "skiplist Mops/s", "mutex scans/us",
+              "skiplist scans/us");
+  for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+    double mutex_mops = Throughput(threads, ops, [&](uint64_t r) {
+      uint64_t key = (r >> 8) % keys;
+      if (r % 10 == 0) {
+        locked.Insert(key, r);
+      } else if (r % 10 == 1) {
+        locked.Erase(key);
+      } else {
+        s21_bench::DoNotOptimize(locked.Find(key));
+      }
+    });
+    double skiplist_mops = Throughput(threads, ops, [&](uint64_t r) {
+      uint64_t key = (r >> 8) % keys;
+      if (r % 10 == 0) {
+        skiplist.insert(key, r);
+      } else if (r % 10 == 1) {
+        skiplist.erase(key);
+      } else {
+        s21_bench::DoNotOptimize(skiplist.contains(key));
+      }
+    });
+    double mutex_scans = Throughput(threads, ops / 8, [&](uint64_t r) {
+      s21_bench::DoNotOptimize(locked.Scan((r >> 8) % keys));
+    });
+    double skiplist_scans = Throughput(threads, ops / 8, [&](uint64_t r) {
+      uint64_t sum = 0;
+      auto iter = skiplist.lower_bound((r >> 8) % keys);
+      for (int i = 0; i < kScanLength && iter != skiplist.end(); ++i, ++iter) {
+        sum += iter->second;
+      }
+      s21_bench::DoNotOptimize(sum);
+    });
+    std::printf("%8zu %16.2f %16.2f %16.2f %16.2f\n", threads, mutex_mops, skiplist_mops, mutex_scans,
+                skiplist_scans);
+  }
+  return 0;
+}
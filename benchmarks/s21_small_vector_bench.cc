@@ -0,0 +1,56 @@
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Heap allocations and time for many short-lived small vectors.
+// Usage: s21_small_vector_bench [vectors]
+namespace {
+
+size_t allocations = 0;
+
+template <typename Vector>
+void Run(const char *name, size_t count, size_t elements) {
+  size_t before = allocations;
+  double ns = s21_bench::BestOf(1, [&] {
+    long long sum = 0;
+    for (size_t i = 0; i < count; ++i) {
+      Vector vec;
+      for (size_t j = 0; j < elements; ++j) {
+        vec.push_back(static_cast<int>(i + j));
+      }
+      sum += vec[elements - 1];
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  std::printf("%-34s %2zu elems %10.3f allocs/vector %8.2f ns/vector\n", name,
+              elements,
+              static_cast<double>(allocations - before) /
+                  static_cast<double>(count),
+              ns / static_cast<double>(count));
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  ++allocations;
+  if (void *ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+int main(int argc, char **argv) {
+  const size_t count = s21_bench::ArgOr(argc, argv, 1, 1000000);
+
+  for (size_t elements : {1, 4, 8, 16}) {
+    Run<s21::vector<int>>("s21::vector<int>", count, elements);
+    Run<s21::small_vector<int, 8>>("s21::small_vector<int, 8>", count,
+                                   elements);
+    Run<s21::static_vector<int, 16>>("s21::static_vector<int, 16>", count,
+                                     elements);
+  }
+  return 0;
+}
@@ -0,0 +1,60 @@
+#include <algorithm>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Random lower_bound probes into sorted s21::vector<int32_t>s sized from
+// L1 to DRAM: std::lower_bound, the branchless view and the view with an
+// Eytzinger index.
+// Usage: s21_sorted_vector_view_bench [largest elements]
+namespace {
+
+template <typename Search>
+double Probe(size_t n, size_t lookups, Search search) {
+  return s21_bench::BestOf(3, [&] {
+    uint64_t state = 88172645463325252ull;
+    size_t sum = 0;
+    for (size_t i = 0; i < lookups; ++i) {
+      sum +=
+          search(static_cast<int32_t>(s21_bench::NextRandom(state) % (2 * n)));
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t largest = s21_bench::ArgOr(argc, argv, 1, 32 << 20);
+  const size_t lookups = 1000000;
+
+  std::printf("%12s %10s %14s %14s %14s\n", "elements", "bytes",
+              "std ns", "branchless ns", "eytzinger ns");
+  for (size_t n = 1 << 10; n <= largest; n *= 8) {
+    s21::vector<int32_t> items(n);
+    for (size_t i = 0; i < n; ++i) {
+      items[i] = static_cast<int32_t>(2 * i);
+    }
+    const int32_t *first = items.begin();
+    const int32_t *last = items.end();
+    s21::sorted_vector_view<int32_t> view(items);
+
+    double std_ns = Probe(n, lookups, [&](int32_t key) {
+      return static_cast<size_t>(std::lower_bound(first, last, key) - first);
+    });
+    double branchless_ns = Probe(n, lookups, [&](int32_t key) {
+      return static_cast<size_t>(view.lower_bound(key) - first);
+    });
+    view.build_index();
+    double eytzinger_ns = Probe(n, lookups, [&](int32_t key) {
+      return static_cast<size_t>(view.lower_bound(key) - first);
+    });
+
+    double per = static_cast<double>(lookups);
+    std::printf("%12zu %8.0fKB %14.1f %14.1f %14.1f\n", n,
+                static_cast<double>(n * sizeof(int32_t)) / 1024, std_ns / per,
+                branchless_ns / per, eytzinger_ns / per);
+  }
+  return 0;
+}
@@ -0,0 +1,104 @@
+#include <utility>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Connection timeouts: arm `timers` timeouts spread over `horizon` ticks,
+// cancel every other one (the connection finished first), then advance the
+// clock one tick at a time and expire the rest. s21::timer_wheel against
+// the s21::multiset<(deadline, id)> timer set it replaces, whose expiry
+// loop keeps calling begin().
+// Usage: s21_timer_wheel_bench [timers] [horizon]
+namespace {
+
+double Since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::nano>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+void RunWheel(size_t timers, uint64_t horizon) {
+  using Wheel = s21::timer_wheel<uint64_t>;
+  Wheel *wheel = new Wheel;
+  s21::vector<Wheel::timer_id> ids;
+  ids.reserve(timers);
+
+  auto start = std::chrono::steady_clock::now();
+  uint64_t state = 88172645463325252ull;
+  for (size_t i = 0; i < timers; ++i) {
+    ids.push_back(
+        wheel->schedule(1 + s21_bench::NextRandom(state) % horizon, i));
+  }
+  s21_bench::Report("timer_wheel schedule", Since(start), timers);
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < timers; i += 2) {
+    wheel->cancel(ids[i]);
+  }
+  s21_bench::Report("timer_wheel cancel", Since(start), timers / 2);
+
+  start = std::chrono::steady_clock::now();
+  uint64_t sum = 0;
+  size_t fired = 0;
+  for (uint64_t now = 1; now <= horizon; ++now) {
+    fired += wheel->advance(now, [&](uint64_t id) { sum += id; });
+  }
+  s21_bench::Report("timer_wheel expire", Since(start), fired);
+  s21_bench::DoNotOptimize(sum);
+
+  start = std::chrono::steady_clock::now();
+  delete wheel;
+  s21_bench::Report("timer_wheel destroy", Since(start), timers);
+}
+
+void RunMultiset(size_t timers, uint64_t horizon) {
+  using Set = s21::multiset<std::pair<uint64_t, uint64_t>>;
+  Set *set = new Set;
+  s21::vector<uint64_t> deadlines;
+  deadlines.reserve(timers);
+
+  auto start = std::chrono::steady_clock::now();
+  uint64_t state = 88172645463325252ull;
+  for (size_t i = 0; i < timers; ++i) {
+    deadlines.push_back(1 + s21_bench::NextRandom(state) % horizon);
+    set->insert({deadlines[i], i});
+  }
+  s21_bench::Report("multiset schedule", Since(start), timers);
+
+  start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < timers; i += 2) {
+    set->erase(set->find({deadlines[i], i}));
+  }
+  s21_bench::Report("multiset cancel", Since(start), timers / 2);
+
+  start = std::chrono::steady_clock::now();
+  uint64_t sum = 0;
+  size_t fired = 0;
+  for (uint64_t now = 1; now <= horizon; ++now) {
+    while (!set->empty() && (*set->begin()).first <= now) {
+      sum += (*set->begin()).second;
+      set->erase(set->begin());
+      ++fired;
+    }
+  }
+  s21_bench::Report("multiset expire", Since(start), fired);
+  s21_bench::DoNotOptimize(sum);
+
+  start = std::chrono::steady_clock::now();
+  delete set;
+  s21_bench::Report("multiset destroy", Since(start), timers);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t timers = s21_bench::ArgOr(argc, argv, 1, 10000000);
+  const uint64_t horizon = s21_bench::ArgOr(argc, argv, 2, 1 << 20);
+
+  std::printf("%zu timers over %llu ticks, half cancelled\n", timers,
+              static_cast<unsigned long long>(horizon));
+  RunMultiset(timers, horizon);
+  RunWheel(timers, horizon);
+  return 0;
+}
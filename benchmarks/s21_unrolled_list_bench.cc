@@ -0,0 +1,70 @@
+#include <malloc.h>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Memory per element and scan speed of s21::unrolled_list against s21::list.
+// Usage: s21_unrolled_list_bench [elements]
+namespace {
+
+size_t HeapInUse() { return mallinfo2().uordblks; }
+
+template <typename List>
+void Run(const char *name, size_t n) {
+  size_t before = HeapInUse();
+  List *l = new List;
+  for (size_t i = 0; i < n; ++i) {
+    l->push_back(static_cast<int>(i));
+  }
+  size_t bytes = HeapInUse() - before;
+  std::printf("%-32s %8.2f bytes/element (payload %zu)\n", name,
+              static_cast<double>(bytes) / static_cast<double>(n),
+              sizeof(int));
+
+  double ns = s21_bench::BestOf(5, [&] {
+    long long sum = 0;
+    for (auto iter = l->begin(); iter != l->end(); ++iter) {
+      sum += *iter;
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("  forward scan", ns, static_cast<double>(n));
+
+  ns = s21_bench::BestOf(5, [&] {
+    long long sum = 0;
+    auto iter = l->end();
+    for (size_t i = 0; i < n; ++i) {
+      --iter;
+      sum += *iter;
+    }
+    s21_bench::DoNotOptimize(sum);
+  });
+  s21_bench::Report("  backward scan", ns, static_cast<double>(n));
+
+  ns = s21_bench::BestOf(1, [&] {
+    auto iter = l->begin();
+    for (size_t i = 0; i < n / 64; ++i) {
+      iter = l->insert(iter, 1);
+      for (int j = 0; j < 64; ++j) {
+        ++iter;
+      }
+    }
+  });
+  s21_bench::Report("  insert every 64th", ns, static_cast<double>(n / 64));
+
+  delete l;
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 1000000);
+
+  std::printf("%zu ints\n", n);
+  Run<s21::list<int>>("s21::list<int>", n);
+  Run<s21::unrolled_list<int, 16>>("s21::unrolled_list<int, 16>", n);
+  Run<s21::unrolled_list<int>>("s21::unrolled_list<int> (64)", n);
+  Run<s21::unrolled_list<int, 256>>("s21::unrolled_list<int, 256>", n);
+  return 0;
+}
@@ -0,0 +1,82 @@
+#include <string>
+
+#include "benchmarks/s21_bench.h"
+#include "s21_containers.h"
+
+// Bulk edits in the middle of large vectors.
+// Usage: s21_vector_bench [elements]
+namespace {
+
+template <typename T>
+s21::vector<T> Filled(size_t n) {
+  s21::vector<T> vec;
+  vec.reserve(n + 64);
+  for (size_t i = 0; i < n; ++i) {
+    vec.push_back(T());
+  }
+  return vec;
+}
+
+template <typename T>
+void Run(const char *type, size_t n, T a, T b, T c, T d) {
+  char name[96];
+  const int rounds = 16;
+
+  s21::vector<T> vec = Filled<T>(n);
+  double ns = s21_bench::BestOf(1, [&] {
+    for (int i = 0; i < rounds; ++i) {
+      vec.insert(vec.begin() + vec.size() / 2, a);
+    }
+  });
+  std::snprintf(name, sizeof(name), "%s insert x1 mid", type);
+  s21_bench::Report(name, ns / rounds, 1);
+
+  vec = Filled<T>(n);
+  ns = s21_bench::BestOf(1, [&] {
+    for (int i = 0; i < rounds; ++i) {
+      vec.insert_many(vec.cbegin() + vec.size() / 2, a, b, c, d);
+    }
+  });
+  std::snprintf(name, sizeof(name), "%s insert_many x4 mid", type);
+  s21_bench::Report(name, ns / rounds, 4);
+
+  vec = Filled<T>(n);
+  ns = s21_bench::BestOf(1, [&] {
+    for (int i = 0; i < rounds; ++i) {
+      vec.erase(vec.begin() + vec.size() / 2);
+    }
+  });
+  std::snprintf(name, sizeof(name), "%s erase x1 mid", type);
+  s21_bench::Report(name, ns / rounds, 1);
+
+  s21::vector<T> chunk = Filled<T>(64);
+  vec = Filled<T>(n);
+  ns = s21_bench::BestOf(1, [&] {
+    for (int i = 0; i < rounds; ++i) {
+      vec.insert(vec.begin() + vec.size() / 2, chunk.cbegin(), chunk.cend());
+    }
+  });
+  std::snprintf(name, sizeof(name), "%s insert range x64 mid", type);
+  s21_bench::Report(name, ns / rounds, 64);
+
+  vec = Filled<T>(n);
+  ns = s21_bench::BestOf(1, [&] {
+    for (int i = 0; i < rounds; ++i) {
+      auto first = vec.begin() + vec.size() / 2;
+      vec.erase(first, first + 64);
+    }
+  });
+  std::snprintf(name, sizeof(name), "%s erase range x64 mid", type);
+  s21_bench::Report(name, ns / rounds, 64);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+  const size_t n = s21_bench::ArgOr(argc, argv, 1, 1000000);
+
+  std::printf("%zu-element vectors, times per call\n", n);
+  Run<int>("int", n, 1, 2, 3, 4);
+  Run<std::string>("string", n, "a", "b", "c", "d");
+  return 0;
+}
@@ -0,0 +1,712 @@
+#ifndef SRC_CONTAINERS_S21_ALGORITHM_H_
+#define SRC_CONTAINERS_S21_ALGORITHM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#endif
+
+namespace s21
+{
+    // Search helpers for ranges and containers. Contiguous ranges of
+    // int32_t or float searched for a value of the same type run SIMD
+    // kernels; the instruction set is picked at runtime (AVX2, SSE4.2 or
+    // scalar), so one binary runs on any x86-64 machine. Everything else
+    // takes the plain loop. Results match the std:: algorithms, including
+    // -0.0 == 0.0 and NaN never comparing equal or less.
+    template <typename InputIt, typename T>
+    InputIt find(InputIt first, InputIt last, const T &value);
+    template <typename InputIt, typename T>
+    size_t count(InputIt first, InputIt last, const T &value);
+    template <typename InputIt, typename T>
+    bool contains(InputIt first, InputIt last, const T &value);
+    template <typename ForwardIt>
+    ForwardIt min_element(ForwardIt first, ForwardIt last);
+    template <typename ForwardIt>
+    ForwardIt max_element(ForwardIt first, ForwardIt last);
+    // [first, last) must be sorted.
+    template <typename ForwardIt, typename T>
+    ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T &value);
+
+    // Whole-container forms.
+    template <typename Container, typename T>
+    auto find(Container &c, const T &value) -> decltype(c.begin());
+    template <typename Container, typename T>
+    size_t count(Container &c, const T &value);
+    template <typename Container, typename T>
+    bool contains(Container &c, const T &value);
+    template <typename Container>
+    auto min_element(Container &c) -> decltype(c.begin());
+    template <typename Container>
+    auto max_element(Container &c) -> decltype(c.begin());
+    template <typename Container, typename T>
+    auto lower_bound(Container &c, const T &value) -> decltype(c.begin());
+
+    namespace simd
+    {
+        enum class level
+        {
+            kScalar,
+            kSse42,
+            kAvx2
+        };
+
+        // Best level this CPU supports.
+        level supported() noexcept;
+        // Level the kernels use; defaults to supported().
+        level active() noexcept;
+        // Caps the active level, e.g. to compare kernels or to rule out
+        // AVX frequency drops; clamped to supported().
+        void limit(level max_level) noexcept;
+
+        // Kernels over n contiguous elements, returning an index (n when
+        // nothing matches) or a count.
+        template <typename E>
+        size_t find(const E *items, size_t n, E value) noexcept;
+        template <typename E>
+        size_t count(const E *items, size_t n, E value) noexcept;
+        template <typename E>
+        size_t min_element(const E *items, size_t n) noexcept;
+        template <typename E>
+        size_t max_element(const E *items, size_t n) noexcept;
+        template <typename E>
+        size_t lower_bound(const E *items, size_t n, E value) noexcept;
+
+        template <typename It, typename T = void>
+        constexpr bool kAccelerated =
+            std::is_pointer_v<It> &&
+            (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>,
+                            int32_t> ||
+             std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>,
+                            float>) &&
+            (std::is_void_v<T> ||
+             std::is_same_v<std::remove_cv_t<std::remove_pointer_t<It>>, T>);
+    } // namespace simd
+
+
+    namespace simd::scalar
+    {
+        template <typename E>
+        size_t find(const E *items, size_t n, E value) noexcept
+        {
+            size_t i = 0;
+            while (i < n && !(items[i] == value))
+            {
+                ++i;
+            }
+            return i;
+        }
+
+        template <typename E>
+        size_t count(const E *items, size_t n, E value) noexcept
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                result += items[i] == value;
+            }
+            return result;
+        }
+
+        template <typename E>
+        size_t min_element(const E *items, size_t n) noexcept
+        {
+            size_t best = 0;
+            for (size_t i = 1; i < n; ++i)
+            {
+                if (items[i] < items[best])
+                {
+                    best = i;
+                }
+            }
+            return n == 0 ? 0 : best;
+        }
+
+        template <typename E>
+        size_t max_element(const E *items, size_t n) noexcept
+        {
+            size_t best = 0;
+            for (size_t i = 1; i < n; ++i)
+            {
+                if (items[best] < items[i])
+                {
+                    best = i;
+                }
+            }
+            return n == 0 ? 0 : best;
+        }
+
+        template <typename E>
+        size_t lower_bound(const E *items, size_t n, E value) noexcept
+        {
+            const E *base = items;
+            while (n > 0)
+            {
+                size_t half = n / 2;
+                if (base[half] < value)
+                {
+                    base += half + 1;
+                    n -= half + 1;
+                }
+                else
+                {
+                    n = half;
+                }
+            }
+            return static_cast<size_t>(base - items);
+        }
+    } // namespace simd::scalar
+
+#ifdef S21_SIMD_X86
+#pragma GCC push_options
+#pragma GCC target("avx2")
+    namespace simd::avx2
+    {
+        constexpr size_t kWidth = 8;
+
+        inline __m256i Load(const int32_t *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)); }
+        inline __m256 Load(const float *p) { return _mm256_loadu_ps(p); }
+        inline __m256i Broadcast(int32_t v) { return _mm256_set1_epi32(v); }
+        inline __m256 Broadcast(float v) { return _mm256_set1_ps(v); }
+        inline int EqMask(__m256i a, __m256i b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+        inline int EqMask(__m256 a, __m256 b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+        inline int LtMask(__m256i a, __m256i b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(b, a))); }
+        inline int LtMask(__m256 a, __m256 b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+        inline int NanMask(__m256i) { return 0; }
+        inline int NanMask(__m256 a) { return _mm256_movemask_ps(_mm256_cmp_ps(a, a, _CMP_UNORD_Q)); }
+        inline __m256i Min(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+        inline __m256 Min(__m256 a, __m256 b) { return _mm256_min_ps(a, b); }
+        inline __m256i Max(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+        inline __m256 Max(__m256 a, __m256 b) { return _mm256_max_ps(a, b); }
+        inline void Store(int32_t *p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v); }
+        inline void Store(float *p, __m256 v) { _mm256_storeu_ps(p, v); }
+
+        template <typename E>
+        size_t find(const E *items, size_t n, E value) noexcept
+        {
+            auto needle = Broadcast(value);
+            size_t i = 0;
+            for (; i + kWidth <= n; i += kWidth)
+            {
+                int mask = EqMask(Load(items + i), needle);
+                if (mask != 0)
+                {
+                    return i + static_cast<size_t>(__builtin_ctz(mask));
+                }
+            }
+            return i + scalar::find(items + i, n - i, value);
+        }
+
+        template <typename E>
+        size_t count(const E *items, size_t n, E value) noexcept
+        {
+            auto needle = Broadcast(value);
+            size_t result = 0;
+            size_t i = 0;
+            for (; i + kWidth <= n; i += kWidth)
+            {
+                result += static_cast<size_t>(
+                    __builtin_popcount(EqMask(Load(items + i), needle)));
+            }
+            return result + scalar::count(items + i, n - i, value);
+        }
+
+        // Finds the extreme value a lane at a time, then its first
+        // position; a NaN anywhere hands the range to the scalar loop,
+        // whose comparisons define the result.
+        template <typename E, bool kMin>
+        size_t extreme(const E *items, size_t n) noexcept
+        {
+            if (n < 2 * kWidth)
+            {
+                return kMin ? scalar::min_element(items, n)
+                            : scalar::max_element(items, n);
+            }
+            auto best = Load(items);
+            int nan = NanMask(best);
+            size_t i = kWidth;
+            for (; i + kWidth <= n; i += kWidth)
+            {
+                auto chunk = Load(items + i);
+                nan |= NanMask(chunk);
+                best = kMin ? Min(best, chunk) : Max(best, chunk);
+            }
+            if (nan != 0)
+            {
+                return kMin ? scalar::min_element(items, n)
+                            : scalar::max_element(items, n);
+            }
+            E lanes[kWidth];
+            Store(lanes, best);
+            E value = lanes[0];
+            for (size_t lane = 1; lane < kWidth; ++lane)
+            {
+                if (kMin ? lanes[lane] < value : value < lanes[lane])
+                {
+                    value = lanes[lane];
+                }
+            }
+            for (; i < n; ++i)
+            {
+                if (kMin ? items[i] < value : value < items[i])
+                {
+                    value = items[i];
+                }
+            }
+            return find(items, n, value);
+        }
+
+        template <typename E>
+        size_t lower_bound(const E *items, size_t n, E value) noexcept
+        {
+            // Halve down to a few vectors, then count the smaller elements.
+            const E *base = items;
+            while (n > 4 * kWidth)
+            {
+                size_t half = n / 2;
+                if (base[half] < value)
+                {
+                    base += half + 1;
+                    n -= half + 1;
+                }
+                else
+                {
+                    n = half;
+                }
+            }
+            auto needle = Broadcast(value);
+            size_t below = 0;
+            size_t i = 0;
+            for (; i + kWidth <= n; i += kWidth)
+            {
+                below += static_cast<size_t>(
+                    __builtin_popcount(LtMask(Load(base + i), needle)));
+            }
+            for (; i < n; ++i)
+            {
+                below += base[i] < value;
+            }
+            return static_cast<size_t>(base - items) + below;
+        }
+    } // namespace simd::avx2
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("sse4.2")
+    namespace simd::sse42
+    {
+        constexpr size_t kWidth = 4;
+
+        inline __m128i Load(const int32_t *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); }
+        inline __m128 Load(const float *p) { return _mm_loadu_ps(p); }
+        inline __m128i Broadcast(int32_t v) { return _mm_set1_epi32(v); }
+        inline __m128 Broadcast(float v) { return _mm_set1_ps(v); }
+        inline int EqMask(__m128i a, __m128i b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+        inline int EqMask(__m128 a, __m128 b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+        inline int LtMask(__m128i a, __m128i b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(a, b))); }
+        inline int LtMask(__m128 a, __m128 b) { return _mm_movemask_ps(_mm_cmplt_ps(a, b)); }
+        inline int NanMask(__m128i) { return 0; }
+        inline int NanMask(__m128 a) { return _mm_movemask_ps(_mm_cmpunord_ps(a, a)); }
+        inline __m128i Min(__m128i a, __m128i b) { return _mm_min_epi32(a, b); }
+        inline __m128 Min(__m128 a, __m128 b) { return _mm_min_ps(a, b); }
+        inline __m128i Max(__m128i a, __m128i b) { return _mm_max_epi32(a, b); }
+        inline __m128 Max(__m128 a, __m128 b) { return _mm_max_ps(a, b); }
+        inline void Store(int32_t *p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+        inline void Store(float *p, __m128 v) { _mm_storeu_ps(p, v); }
+
+        template <typename E>
+        size_t find(const E *items, size_t n, E value) noexcept
+        {
+            auto needle = Broadcast(value);
+            size_t i = 0;
+            for (; i + kWidth <= n; i += kWidth)
+            {
+                int mask = EqMask(Load(items + i), needle);
+                if (mask != 0)
+                {
+                    return i + static_cast<size_t>(__builtin_ctz(mask));
+                }
+            }
+            return i + scalar::find(items + i, n - i, value);
+        }
+
+        template <typename E>
+        size_t count(const E *items, size_t n, E value) noexcept
+        {
+            auto needle = Broadcast(value);
+            size_t result = 0;
+            size_t i = 0;
+            for (; i + kWidth <= n; i += kWidth)
+            {
+                result += static_cast<size_t>(
+                    __builtin_popcount(EqMask(Load(items + i), needle)));
+            }
+            return result + scalar::count(items + i, n - i, value);
+        }
+
+        template <typename E, bool kMin>
+        size_t extreme(const E *items, size_t n) noexcept
+        {
+            if (n < 2 * kWidth)
+            {
+                return kMin ? scalar::min_element(items, n)
+                            : scalar::max_element(items, n);
+            }
+            auto best = Load(items);
+            int nan = NanMask(best);
+            size_t i = kWidth;
+            for (; i + kWidth <= n; i += kWidth)
+            {
+                auto chunk = Load(items + i);
+                nan |= NanMask(chunk);
+                best = kMin ? Min(best, chunk) : Max(best, chunk);
+            }
+            if (nan != 0)
+            {
+                return kMin ? scalar::min_element(items, n)
+                            : scalar::max_element(items, n);
+            }
+            E lanes[kWidth];
+            Store(lanes, best);
+            E value = lanes[0];
+            for (size_t lane = 1; lane < kWidth; ++lane)
+            {
+                if (kMin ? lanes[lane] < value : value < lanes[lane])
+                {
+                    value = lanes[lane];
+                }
+            }
+            for (; i < n; ++i)
+            {
+                if (kMin ? items[i] < value : value < items[i])
+                {
+                    value = items[i];
+                }
+            }
+            return find(items, n, value);
+        }
+
+        template <typename E>
+        size_t lower_bound(const E *items, size_t n, E value) noexcept
+        {
+            const E *base = items;
+            while (n > 4 * kWidth)
+            {
+                size_t half = n / 2;
+                if (base[half] < value)
+                {
+                    base += half + 1;
+                    n -= half + 1;
+                }
+                else
+                {
+                    n = half;
+                }
+            }
+            auto needle = Broadcast(value);
+            size_t below = 0;
+            size_t i = 0;
+            for (; i + kWidth <= n; i += kWidth)
+            {
+                below += static_cast<size_t>(
+                    __builtin_popcount(LtMask(Load(base + i), needle)));
+            }
+            for (; i < n; ++i)
+            {
+                below += base[i] < value;
+            }
+            return static_cast<size_t>(base - items) + below;
+        }
+    } // namespace simd::sse42
+#pragma GCC pop_options
+#endif
+
+    namespace simd
+    {
+        inline level supported() noexcept
+        {
+#ifdef S21_SIMD_X86
+            static const level detected =
+                __builtin_cpu_supports("avx2")     ? level::kAvx2
+                : __builtin_cpu_supports("sse4.2") ? level::kSse42
+                                                   : level::kScalar;
+            return detected;
+#else
+            return level::kScalar;
+#endif
+        }
+
+        inline level &ActiveLevel() noexcept
+        {
+            static level active = supported();
+            return active;
+        }
+
+        inline level active() noexcept
+        {
+            return ActiveLevel();
+        }
+
+        inline void limit(level max_level) noexcept
+        {
+            ActiveLevel() = max_level < supported() ? max_level : supported();
+        }
+
+        template <typename E>
+        size_t find(const E *items, size_t n, E value) noexcept
+        {
+#ifdef S21_SIMD_X86
+            switch (active())
+            {
+            case level::kAvx2:
+                return avx2::find(items, n, value);
+            case level::kSse42:
+                return sse42::find(items, n, value);
+            default:
+                break;
+            }
+#endif
+            return scalar::find(items, n, value);
+        }
+
+        template <typename E>
+        size_t count(const E *items, size_t n, E value) noexcept
+        {
+#ifdef S21_SIMD_X86
+            switch (active())
+            {
+            case level::kAvx2:
+                return avx2::count(items, n, value);
+            case level::kSse42:
+                return sse42::count(items, n, value);
+            default:
+                break;
+            }
+#endif
+            return scalar::count(items, n, value);
+        }
+
+        template <typename E>
+        size_t min_element(const E *items, size_t n) noexcept
+        {
+#ifdef S21_SIMD_X86
+            switch (active())
+            {
+            case level::kAvx2:
+                return avx2::extreme<E, true>(items, n);
+            case level::kSse42:
+                return sse42::extreme<E, true>(items, n);
+            default:
+                break;
+            }
+#endif
+            return scalar::min_element(items, n);
+        }
+
+        template <typename E>
+        size_t max_element(const E *items, size_t n) noexcept
+        {
+#ifdef S21_SIMD_X86
+            switch (active())
+            {
+            case level::kAvx2:
+                return avx2::extreme<E, false>(items, n);
+            case level::kSse42:
+                return sse42::extreme<E, false>(items, n);
+            default:
+                break;
+            }
+#endif
+            return scalar::max_element(items, n);
+        }
+
+        template <typename E>
+        size_t lower_bound(const E *items, size_t n, E value) noexcept
+        {
+#ifdef S21_SIMD_X86
+            switch (active())
+            {
+            case level::kAvx2:
+                return avx2::lower_bound(items, n, value);
+            case level::kSse42:
+                return sse42::lower_bound(items, n, value);
+            default:
+                break;
+            }
+#endif
+            return scalar::lower_bound(items, n, value);
+        }
+    } // namespace simd
+
+    template <typename InputIt, typename T>
+    InputIt find(InputIt first, InputIt last, const T &value)
+    {
+        if constexpr (simd::kAccelerated<InputIt, T>)
+        {
+            return first + simd::find(first, static_cast<size_t>(last - first), value);
+        }
+        else
+        {
+            while (first != last && !(*first == value))
+            {
+                ++first;
+            }
+            return first;
+        }
+    }
+
+    template <typename InputIt, typename T>
+    size_t count(InputIt first, InputIt last, const T &value)
+    {
+        if constexpr (simd::kAccelerated<InputIt, T>)
+        {
+            return simd::count(first, static_cast<size_t>(last - first), value);
+        }
+        else
+        {
+            size_t result = 0;
+            for (; first != last; ++first)
+            {
+                if (*first == value)
+                {
+                    ++result;
+                }
+            }
+            return result;
+        }
+    }
+
+    template <typename InputIt, typename T>
+    bool contains(InputIt first, InputIt last, const T &value)
+    {
+        return s21::find(first, last, value) != last;
+    }
+
+    template <typename ForwardIt>
+    ForwardIt min_element(ForwardIt first, ForwardIt last)
+    {
+        if constexpr (simd::kAccelerated<ForwardIt>)
+        {
+            return first + simd::min_element(first, static_cast<size_t>(last - first));
+        }
+        else
+        {
+            ForwardIt best = first;
+            if (first != last)
+            {
+                while (++first != last)
+                {
+                    if (*first < *best)
+                    {
+                        best = first;
+                    }
+                }
+            }
+            return best;
+        }
+    }
+
+    template <typename ForwardIt>
+    ForwardIt max_element(ForwardIt first, ForwardIt last)
+    {
+        if constexpr (simd::kAccelerated<ForwardIt>)
+        {
+            return first + simd::max_element(first, static_cast<size_t>(last - first));
+        }
+        else
+        {
+            ForwardIt best = first;
+            if (first != last)
+            {
+                while (++first != last)
+                {
+                    if (*best < *first)
+                    {
+                        best = first;
+                    }
+                }
+            }
+            return best;
+        }
+    }
+
+    template <typename ForwardIt, typename T>
+    ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T &value)
+    {
+        if constexpr (simd::kAccelerated<ForwardIt, T>)
+        {
+            return first + simd::lower_bound(first, static_cast<size_t>(last - first), value);
+        }
+        else
+        {
+            size_t n = 0;
+            for (ForwardIt it = first; it != last; ++it)
+            {
+                ++n;
+            }
+            while (n > 0)
+            {
+                size_t half = n / 2;
+                ForwardIt middle = first;
+                for (size_t i = 0; i < half; ++i)
+                {
+                    ++middle;
+                }
+                if (*middle < value)
+                {
+                    first = ++middle;
+                    n -= half + 1;
+                }
+                else
+                {
+                    n = half;
+                }
+            }
+            return first;
+        }
+    }
+
+    template <typename Container, typename T>
+    auto find(Container &c, const T &value) -> decltype(c.begin())
+    {
+        return s21::find(c.begin(), c.end(), value);
+    }
+
+    template <typename Container, typename T>
+    size_t count(Container &c, const T &value)
+    {
+        return s21::count(c.begin(), c.end(), value);
+    }
+
+    template <typename Container, typename T>
+    bool contains(Container &c, const T &value)
+    {
+        return s21::find(c.begin(), c.end(), value) != c.end();
+    }
+
+    template <typename Container>
+    auto min_element(Container &c) -> decltype(c.begin())
+    {
+        return s21::min_element(c.begin(), c.end());
+    }
+
+    template <typename Container>
+    auto max_element(Container &c) -> decltype(c.begin())
+    {
+        return s21::max_element(c.begin(), c.end());
+    }
+
+    template <typename Container, typename T>
+    auto lower_bound(Container &c, const T &value) -> decltype(c.begin())
+    {
+        return s21::lower_bound(c.begin(), c.end(), value);
+    }
+} // namespace s21
+
+#undef S21_SIMD_X86
+
+#endif // SRC_CONTAINERS_S21_ALGORITHM_H_
@@ -1,6 +1,8 @@
 #ifndef SRC_CONTAINERS_S21_ARRAY_H_
 #define SRC_CONTAINERS_S21_ARRAY_H_
 
+#include "s21_serialize.h"
+
 namespace s21
 {
     template <typename T, size_t N>
@@ -46,6 +48,10 @@ namespace s21
         constexpr size_type size() const noexcept;
         constexpr size_type max_size() const noexcept;
 
+        // Array serialization
+        void save(std::ostream &os) const;
+        void load(std::istream &is);
+
     private:
         value_type data_[N];
     };
@@ -182,6 +188,25 @@ namespace s21
     {
         return N;
     }
+
+    // Array serialization
+    template <typename T, size_t N>
+    void array<T, N>::save(std::ostream &os) const
+    {
+        serial::write_header(os, serial_kind::kArray, N);
+        serial::write_array(os, begin(), N);
+        serial::check_written(os);
+    }
+
+    template <typename T, size_t N>
+    void array<T, N>::load(std::istream &is)
+    {
+        if (serial::read_header(is, serial_kind::kArray) != N)
+        {
+            throw std::invalid_argument("s21::load: array size mismatch");
+        }
+        serial::read_array(is, begin(), N);
+    }
 } // namespace s21
 
 #endif // SRC_CONTAINERS_S21_ARRAY_H_
\ No newline at end of file
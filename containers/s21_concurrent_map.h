@@ -0,0 +1,280 @@
+#ifndef SRC_CONTAINERS_S21_CONCURRENT_MAP_H_
+#define SRC_CONTAINERS_S21_CONCURRENT_MAP_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <utility>
+
+#include "s21_map.h"
+
+namespace s21
+{
+    // Map shared between threads. Keys are hashed onto a power-of-two
+    // number of shards, each an s21::map behind its own reader-writer
+    // lock, so readers never block each other and writers only contend
+    // within a shard. Lookups return copies: a reference would outlive
+    // the lock that protects it. Ordered traversal goes through snapshot().
+    template <typename Key, typename T, typename Hash = std::hash<Key>>
+    class concurrent_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<key_type, mapped_type>;
+        using size_type = size_t;
+
+        explicit concurrent_map(size_type shards = 64);
+        concurrent_map(const concurrent_map &other) = delete;
+        ~concurrent_map() = default;
+
+        concurrent_map &operator=(const concurrent_map &other) = delete;
+
+        // Lookup
+        std::optional<mapped_type> find(const key_type &key) const;
+        bool contains(const key_type &key) const;
+
+        // Modifiers; each is atomic with respect to the key's shard.
+        // insert() keeps an existing value and returns false for it;
+        // insert_or_assign() returns true when the key was new.
+        bool insert(const key_type &key, const mapped_type &obj);
+        bool insert_or_assign(const key_type &key, const mapped_type &obj);
+        bool erase(const key_type &key);
+        // Calls fn(mapped_type &) under the shard's write lock. The first
+        // form skips absent keys and says whether it ran; the second
+        // inserts `init` first. fn must not touch this map.
+        template <typename F>
+        bool update(const key_type &key, F fn);
+        template <typename F>
+        void update(const key_type &key, const mapped_type &init, F fn);
+        void clear();
+
+        // Capacity; approximate while writers run.
+        size_type size() const;
+        bool empty() const;
+        size_type shard_count() const noexcept;
+
+        // Consistent copy of the whole map: every shard is read-locked at
+        // once, so the copy reflects a single point in time.
+        map<key_type, mapped_type> snapshot() const;
+        // Calls fn(const value_type &) for every entry of one consistent
+        // view, holding all read locks for the duration.
+        template <typename F>
+        void for_each(F fn) const;
+
+    private:
+        struct alignas(64) Shard
+        {
+            mutable std::shared_mutex mutex;
+            mutable map<key_type, mapped_type> items;
+        };
+
+        std::unique_ptr<Shard[]> shards_;
+        size_type count_;
+        unsigned shift_;
+        Hash hash_;
+
+        Shard &ShardFor(const key_type &key) const noexcept;
+        template <typename F>
+        void WithAllShared(F fn) const;
+    };
+
+
+    template <typename Key, typename T, typename Hash>
+    concurrent_map<Key, T, Hash>::concurrent_map(size_type shards) : count_(1), shift_(64), hash_()
+    {
+        while (count_ < shards)
+        {
+            count_ *= 2;
+            --shift_;
+        }
+        shards_.reset(new Shard[count_]);
+    }
+
+    template <typename Key, typename T, typename Hash>
+    std::optional<T> concurrent_map<Key, T, Hash>::find(const key_type &key) const
+    {
+        Shard &shard = ShardFor(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.items.find(key);
+        if (iter == shard.items.end())
+        {
+            return std::nullopt;
+        }
+        return (*iter).second;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    bool concurrent_map<Key, T, Hash>::contains(const key_type &key) const
+    {
+        Shard &shard = ShardFor(key);
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.items.contains(key);
+    }
+
+    template <typename Key, typename T, typename Hash>
+    bool concurrent_map<Key, T, Hash>::insert(const key_type &key, const mapped_type &obj)
+    {
+        Shard &shard = ShardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        return shard.items.insert(key, obj).second;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    bool concurrent_map<Key, T, Hash>::insert_or_assign(const key_type &key, const mapped_type &obj)
+    {
+        Shard &shard = ShardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.items.find(key);
+        if (iter == shard.items.end())
+        {
+            shard.items.insert(key, obj);
+            return true;
+        }
+        (*iter).second = obj;
+        return false;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    bool concurrent_map<Key, T, Hash>::erase(const key_type &key)
+    {
+        Shard &shard = ShardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.items.find(key);
+        if (iter == shard.items.end())
+        {
+            return false;
+        }
+        shard.items.erase(iter);
+        return true;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    template <typename F>
+    bool concurrent_map<Key, T, Hash>::update(const key_type &key, F fn)
+    {
+        Shard &shard = ShardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.items.find(key);
+        if (iter == shard.items.end())
+        {
+            return false;
+        }
+        fn((*iter).second);
+        return true;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    template <typename F>
+    void concurrent_map<Key, T, Hash>::update(const key_type &key, const mapped_type &init, F fn)
+    {
+        Shard &shard = ShardFor(key);
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        auto iter = shard.items.find(key);
+        if (iter == shard.items.end())
+        {
+            iter = shard.items.insert(key, init).first;
+        }
+        fn((*iter).second);
+    }
+
+    template <typename Key, typename T, typename Hash>
+    void concurrent_map<Key, T, Hash>::clear()
+    {
+        for (size_type i = 0; i < count_; ++i)
+        {
+            std::unique_lock<std::shared_mutex> lock(shards_[i].mutex);
+            shards_[i].items.clear();
+        }
+    }
+
+    template <typename Key, typename T, typename Hash>
+    typename concurrent_map<Key, T, Hash>::size_type concurrent_map<Key, T, Hash>::size() const
+    {
+        size_type total = 0;
+        for (size_type i = 0; i < count_; ++i)
+        {
+            std::shared_lock<std::shared_mutex> lock(shards_[i].mutex);
+            total += shards_[i].items.size();
+        }
+        return total;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    bool concurrent_map<Key, T, Hash>::empty() const
+    {
+        return size() == 0;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    typename concurrent_map<Key, T, Hash>::size_type concurrent_map<Key, T, Hash>::shard_count() const noexcept
+    {
+        return count_;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    map<Key, T> concurrent_map<Key, T, Hash>::snapshot() const
+    {
+        map<key_type, mapped_type> result;
+        WithAllShared([&result](const value_type &item) { result.insert(item); });
+        return result;
+    }
+
+    template <typename Key, typename T, typename Hash>
+    template <typename F>
+    void concurrent_map<Key, T, Hash>::for_each(F fn) const
+    {
+        WithAllShared(fn);
+    }
+
+    template <typename Key, typename T, typename Hash>
+    typename concurrent_map<Key, T, Hash>::Shard &concurrent_map<Key, T, Hash>::ShardFor(
+        const key_type &key) const noexcept
+    {
+        // Fibonacci hashing takes the top bits of the product, so hashes
+        // that differ only in high bits (std::hash of integers is the
+        // identity) still spread over the shards.
+        uint64_t mixed = static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+        size_type index = shift_ >= 64 ? 0 : static_cast<size_type>(mixed >> shift_);
+        return shards_[index];
+    }
+
+    template <typename Key, typename T, typename Hash>
+    template <typename F>
+    void concurrent_map<Key, T, Hash>::WithAllShared(F fn) const
+    {
+        // Always in index order; writers hold one shard at a time, so
+        // this cannot deadlock with them.
+        for (size_type i = 0; i < count_; ++i)
+        {
+            shards_[i].mutex.lock_shared();
+        }
+        try
+        {
+            for (size_type i = 0; i < count_; ++i)
+            {
+                for (auto iter = shards_[i].items.cbegin(); iter != shards_[i].items.cend(); ++iter)
+                {
+                    fn(*iter);
+                }
+            }
+        }
+        catch (...)
+        {
+            for (size_type i = 0; i < count_; ++i)
+            {
+                shards_[i].mutex.unlock_shared();
+            }
+            throw;
+        }
+        for (size_type i = 0; i < count_; ++i)
+        {
+            shards_[i].mutex.unlock_shared();
+        }
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_CONCURRENT_MAP_H_
@@ -0,0 +1,191 @@
+#ifndef SRC_CONTAINERS_S21_COW_H_
+#define SRC_CONTAINERS_S21_COW_H_
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Opt-in copy-on-write for any copyable container. Copies share one
+    // reference-counted instance and cost O(1); the first write() through
+    // a copy that is still shared clones the container, so copies that
+    // are never mutated never pay for a deep copy. The count is atomic:
+    // different cow objects sharing an instance may be read and written
+    // from different threads. A single cow object is no more thread-safe
+    // than the container itself.
+    //
+    // A reference from write() must not be kept across a copy of the cow:
+    // the copy would share, and see, later writes through it.
+    template <typename Container>
+    class cow
+    {
+    public:
+        using container_type = Container;
+        using size_type = size_t;
+
+        cow() noexcept;
+        cow(const container_type &value);
+        cow(container_type &&value);
+        cow(const cow &other) noexcept;
+        cow(cow &&other) noexcept;
+        ~cow();
+
+        cow &operator=(cow other) noexcept;
+
+        // Shared, read-only access; never copies.
+        const container_type &read() const noexcept;
+        const container_type &operator*() const noexcept;
+        const container_type *operator->() const noexcept;
+
+        // Exclusive access: clones the container first if it is shared.
+        container_type &write();
+
+        bool unique() const noexcept;
+        size_type use_count() const noexcept;
+
+        void swap(cow &other) noexcept;
+
+    private:
+        struct Block
+        {
+            template <typename... Args>
+            explicit Block(Args &&...args);
+
+            std::atomic<size_type> refs;
+            container_type value;
+        };
+
+        // Null for a default-constructed or moved-from cow, which reads as
+        // an empty container.
+        Block *block_;
+
+        static const container_type &Empty() noexcept;
+        static void Release(Block *block) noexcept;
+    };
+
+    template <typename T>
+    using cow_vector = cow<vector<T>>;
+
+    template <typename Key, typename T>
+    using cow_map = cow<map<Key, T>>;
+
+
+    template <typename Container>
+    template <typename... Args>
+    cow<Container>::Block::Block(Args &&...args) : refs(1), value(std::forward<Args>(args)...) {}
+
+    template <typename Container>
+    cow<Container>::cow() noexcept : block_(nullptr) {}
+
+    template <typename Container>
+    cow<Container>::cow(const container_type &value) : block_(new Block(value)) {}
+
+    template <typename Container>
+    cow<Container>::cow(container_type &&value) : block_(new Block(std::move(value))) {}
+
+    template <typename Container>
+    cow<Container>::cow(const cow &other) noexcept : block_(other.block_)
+    {
+        if (block_ != nullptr)
+        {
+            block_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename Container>
+    cow<Container>::cow(cow &&other) noexcept : block_(other.block_)
+    {
+        other.block_ = nullptr;
+    }
+
+    template <typename Container>
+    cow<Container>::~cow()
+    {
+        Release(block_);
+    }
+
+    template <typename Container>
+    cow<Container> &cow<Container>::operator=(cow other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    template <typename Container>
+    const Container &cow<Container>::read() const noexcept
+    {
+        return block_ != nullptr ? block_->value : Empty();
+    }
+
+    template <typename Container>
+    const Container &cow<Container>::operator*() const noexcept
+    {
+        return read();
+    }
+
+    template <typename Container>
+    const Container *cow<Container>::operator->() const noexcept
+    {
+        return &read();
+    }
+
+    template <typename Container>
+    Container &cow<Container>::write()
+    {
+        if (block_ == nullptr)
+        {
+            block_ = new Block();
+        }
+        else if (!unique())
+        {
+            // Another owner may drop its reference meanwhile; Release
+            // handles the count reaching zero either way.
+            Block *copy = new Block(static_cast<const container_type &>(block_->value));
+            Release(block_);
+            block_ = copy;
+        }
+        return block_->value;
+    }
+
+    template <typename Container>
+    bool cow<Container>::unique() const noexcept
+    {
+        // Acquire pairs with the release in other owners' Release, so
+        // their last reads happen before our writes.
+        return block_ == nullptr || block_->refs.load(std::memory_order_acquire) == 1;
+    }
+
+    template <typename Container>
+    typename cow<Container>::size_type cow<Container>::use_count() const noexcept
+    {
+        return block_ == nullptr ? 0 : block_->refs.load(std::memory_order_relaxed);
+    }
+
+    template <typename Container>
+    void cow<Container>::swap(cow &other) noexcept
+    {
+        std::swap(block_, other.block_);
+    }
+
+    template <typename Container>
+    const Container &cow<Container>::Empty() noexcept
+    {
+        static const container_type empty{};
+        return empty;
+    }
+
+    template <typename Container>
+    void cow<Container>::Release(Block *block) noexcept
+    {
+        if (block != nullptr && block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            delete block;
+        }
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_COW_H_
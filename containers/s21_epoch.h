@@ -0,0 +1,399 @@
+#ifndef SRC_CONTAINERS_S21_EPOCH_H_
+#define SRC_CONTAINERS_S21_EPOCH_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include "s21_set.h"
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Epoch-based reclamation for lock-free structures. A thread pins the
+    // domain (through a guard) while it holds raw pointers into shared
+    // nodes; a node unlinked by a writer is retired rather than deleted and
+    // freed once every thread pinned at the time has let go. The global
+    // epoch only advances when all pinned threads have seen the current
+    // one, so anything retired in epoch e is unreachable by epoch e + 3;
+    // each thread keeps three bags of garbage and empties a bag when its
+    // own epoch comes back round to it.
+    class epoch_domain
+    {
+    public:
+        using size_type = size_t;
+
+        // Pins the domain for its lifetime; nests. A guard belongs to the
+        // thread that created it.
+        class guard
+        {
+        public:
+            guard() noexcept;
+            explicit guard(epoch_domain &domain);
+            guard(const guard &other);
+            guard(guard &&other) noexcept;
+            ~guard();
+
+            guard &operator=(guard other) noexcept;
+
+            void release() noexcept;
+
+        private:
+            epoch_domain *domain_;
+        };
+
+        epoch_domain();
+        epoch_domain(const epoch_domain &other) = delete;
+        // Frees everything still retired; no thread may be pinned.
+        ~epoch_domain();
+
+        epoch_domain &operator=(const epoch_domain &other) = delete;
+
+        guard pin();
+        // Hands p to deleter once no pinned thread can reach it. Must be
+        // called while pinned, after p has been unlinked.
+        void retire(void *p, void (*deleter)(void *));
+        template <typename T>
+        void retire(T *p);
+
+        // Current global epoch and the number of objects waiting to be
+        // freed, for tests and tuning.
+        uint64_t epoch() const noexcept;
+        size_type pending() const noexcept;
+        // Domains the calling thread holds a record for, dead ones not yet
+        // forgotten included.
+        static size_type thread_records();
+
+    private:
+        struct Retired
+        {
+            void *ptr;
+            void (*deleter)(void *);
+        };
+
+        struct alignas(64) Record
+        {
+            std::atomic<bool> active{false};
+            std::atomic<uint64_t> epoch{0};
+            std::atomic<bool> in_use{true};
+            std::atomic<size_type> pending{0};
+            Record *next = nullptr;
+            size_type nesting = 0;
+            size_type since_advance = 0;
+            vector<Retired> bags[3];
+        };
+
+        // Records a thread holds, by domain id; ids are never reused, so a
+        // stale entry for a dead domain can never match a live one.
+        struct ThreadRecords
+        {
+            struct Entry
+            {
+                uint64_t domain;
+                Record *record;
+            };
+
+            vector<Entry> entries;
+            // Deaths() when dead domains were last dropped from entries.
+            uint64_t deaths_seen = 0;
+
+            ~ThreadRecords();
+            void Forget();
+        };
+
+        // Try to advance after this many retires by one thread.
+        static constexpr size_type kAdvanceEvery = 64;
+
+        const uint64_t id_;
+        std::atomic<uint64_t> epoch_;
+        std::atomic<Record *> records_;
+
+        static std::mutex &RegistryMutex() noexcept;
+        static set<uint64_t> &LiveDomains();
+        static uint64_t NextId() noexcept;
+        // Number of domains destroyed so far.
+        static std::atomic<uint64_t> &Deaths() noexcept;
+        static ThreadRecords &Local();
+
+        Record *LocalRecord();
+        Record *AcquireRecord();
+        void Enter();
+        void Exit() noexcept;
+        void TryAdvance() noexcept;
+        static void FreeBag(Record &record, size_type index) noexcept;
+    };
+
+
+    inline epoch_domain::guard::guard() noexcept : domain_(nullptr) {}
+
+    inline epoch_domain::guard::guard(epoch_domain &domain) : domain_(&domain)
+    {
+        domain_->Enter();
+    }
+
+    inline epoch_domain::guard::guard(const guard &other) : domain_(other.domain_)
+    {
+        if (domain_ != nullptr)
+        {
+            domain_->Enter();
+        }
+    }
+
+    inline epoch_domain::guard::guard(guard &&other) noexcept : domain_(other.domain_)
+    {
+        other.domain_ = nullptr;
+    }
+
+    inline epoch_domain::guard::~guard()
+    {
+        release();
+    }
+
+    inline epoch_domain::guard &epoch_domain::guard::operator=(guard other) noexcept
+    {
+        epoch_domain *held = domain_;
+        domain_ = other.domain_;
+        other.domain_ = held;
+        return *this;
+    }
+
+    inline void epoch_domain::guard::release() noexcept
+    {
+        if (domain_ != nullptr)
+        {
+            domain_->Exit();
+            domain_ = nullptr;
+        }
+    }
+
+    inline epoch_domain::epoch_domain() : id_(NextId()), epoch_(0), records_(nullptr)
+    {
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+        LiveDomains().insert(id_);
+    }
+
+    inline epoch_domain::~epoch_domain()
+    {
+        {
+            // After this no exiting thread touches our records.
+            std::lock_guard<std::mutex> lock(RegistryMutex());
+            LiveDomains().erase(LiveDomains().find(id_));
+            Deaths().fetch_add(1);
+        }
+        Record *record = records_.load();
+        while (record != nullptr)
+        {
+            Record *next = record->next;
+            for (size_type i = 0; i < 3; ++i)
+            {
+                FreeBag(*record, i);
+            }
+            delete record;
+            record = next;
+        }
+    }
+
+    inline epoch_domain::guard epoch_domain::pin()
+    {
+        return guard(*this);
+    }
+
+    inline void epoch_domain::retire(void *p, void (*deleter)(void *))
+    {
+        Record *record = LocalRecord();
+        uint64_t epoch = record->epoch.load(std::memory_order_relaxed);
+        record->bags[epoch % 3].push_back(Retired{p, deleter});
+        record->pending.fetch_add(1, std::memory_order_relaxed);
+        if (++record->since_advance >= kAdvanceEvery)
+        {
+            record->since_advance = 0;
+            TryAdvance();
+        }
+    }
+
+    template <typename T>
+    void epoch_domain::retire(T *p)
+    {
+        retire(static_cast<void *>(p), [](void *q) { delete static_cast<T *>(q); });
+    }
+
+    inline uint64_t epoch_domain::epoch() const noexcept
+    {
+        return epoch_.load();
+    }
+
+    inline epoch_domain::size_type epoch_domain::pending() const noexcept
+    {
+        size_type total = 0;
+        for (Record *record = records_.load(); record != nullptr; record = record->next)
+        {
+            total += record->pending.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    inline epoch_domain::size_type epoch_domain::thread_records()
+    {
+        return Local().entries.size();
+    }
+
+    inline std::mutex &epoch_domain::RegistryMutex() noexcept
+    {
+        static std::mutex mutex;
+        return mutex;
+    }
+
+    inline set<uint64_t> &epoch_domain::LiveDomains()
+    {
+        static set<uint64_t> domains;
+        return domains;
+    }
+
+    inline uint64_t epoch_domain::NextId() noexcept
+    {
+        static std::atomic<uint64_t> next(1);
+        return next.fetch_add(1);
+    }
+
+    inline std::atomic<uint64_t> &epoch_domain::Deaths() noexcept
+    {
+        static std::atomic<uint64_t> deaths(0);
+        return deaths;
+    }
+
+    inline epoch_domain::ThreadRecords &epoch_domain::Local()
+    {
+        static thread_local ThreadRecords local;
+        return local;
+    }
+
+    inline epoch_domain::ThreadRecords::~ThreadRecords()
+    {
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+        for (Entry &entry : entries)
+        {
+            if (LiveDomains().contains(entry.domain))
+            {
+                entry.record->in_use.store(false);
+            }
+        }
+    }
+
+    inline void epoch_domain::ThreadRecords::Forget()
+    {
+        // Read before locking: every death counted here has already left
+        // LiveDomains.
+        uint64_t deaths = Deaths().load();
+        if (deaths == deaths_seen)
+        {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(RegistryMutex());
+        size_type kept = 0;
+        for (size_type i = 0; i < entries.size(); ++i)
+        {
+            if (LiveDomains().contains(entries[i].domain))
+            {
+                entries[kept++] = entries[i];
+            }
+        }
+        entries.erase(entries.cbegin() + kept, entries.cend());
+        deaths_seen = deaths;
+    }
+
+    inline epoch_domain::Record *epoch_domain::LocalRecord()
+    {
+        ThreadRecords &local = Local();
+        for (ThreadRecords::Entry &entry : local.entries)
+        {
+            if (entry.domain == id_)
+            {
+                return entry.record;
+            }
+        }
+        // Entries for dead domains are dropped whenever a new one is added,
+        // so a thread that outlives many short-lived domains keeps scanning
+        // only the live ones.
+        local.Forget();
+        Record *record = AcquireRecord();
+        local.entries.push_back(ThreadRecords::Entry{id_, record});
+        return record;
+    }
+
+    inline epoch_domain::Record *epoch_domain::AcquireRecord()
+    {
+        // Reuse a record a finished thread gave back, else publish a new one.
+        for (Record *record = records_.load(); record != nullptr; record = record->next)
+        {
+            bool expected = false;
+            if (!record->in_use.load() && record->in_use.compare_exchange_strong(expected, true))
+            {
+                return record;
+            }
+        }
+        Record *record = new Record;
+        record->next = records_.load();
+        while (!records_.compare_exchange_weak(record->next, record))
+        {
+        }
+        return record;
+    }
+
+    inline void epoch_domain::Enter()
+    {
+        Record *record = LocalRecord();
+        if (record->nesting++ != 0)
+        {
+            return;
+        }
+        // The store must be visible before we read the epoch (seq_cst on
+        // both), or an advancer could miss us and move two epochs ahead.
+        record->active.store(true);
+        uint64_t global = epoch_.load();
+        uint64_t local = record->epoch.load(std::memory_order_relaxed);
+        if (local != global)
+        {
+            // Bags from three or more epochs back are unreachable now.
+            for (uint64_t e = local + 1; e <= global && e <= local + 3; ++e)
+            {
+                FreeBag(*record, e % 3);
+            }
+            record->epoch.store(global, std::memory_order_relaxed);
+        }
+    }
+
+    inline void epoch_domain::Exit() noexcept
+    {
+        Record *record = LocalRecord();
+        if (--record->nesting == 0)
+        {
+            record->active.store(false, std::memory_order_release);
+        }
+    }
+
+    inline void epoch_domain::TryAdvance() noexcept
+    {
+        uint64_t global = epoch_.load();
+        for (Record *record = records_.load(); record != nullptr; record = record->next)
+        {
+            if (record->active.load() && record->epoch.load(std::memory_order_relaxed) != global)
+            {
+                return;
+            }
+        }
+        epoch_.compare_exchange_strong(global, global + 1);
+    }
+
+    inline void epoch_domain::FreeBag(Record &record, size_type index) noexcept
+    {
+        vector<Retired> &bag = record.bags[index];
+        for (Retired &retired : bag)
+        {
+            retired.deleter(retired.ptr);
+        }
+        record.pending.fetch_sub(bag.size(), std::memory_order_relaxed);
+        bag.clear();
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_EPOCH_H_
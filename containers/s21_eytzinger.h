@@ -0,0 +1,136 @@
+#ifndef SRC_CONTAINERS_S21_EYTZINGER_H_
+#define SRC_CONTAINERS_S21_EYTZINGER_H_
+
+namespace s21
+{
+    // Eytzinger (BFS) layout of a sorted sequence: the implicit binary
+    // search tree whose node k has children 2k and 2k + 1. Positions are
+    // 1-based and node k lives at items[k - 1]; position 0 means "none".
+    // A search touches the top levels, which share a few cache lines, and
+    // can prefetch the next levels before it needs them.
+    namespace eytzinger
+    {
+        // Leftmost and rightmost node, i.e. the smallest and largest item.
+        size_t first(size_t n) noexcept;
+        size_t last(size_t n) noexcept;
+        // In-order neighbours of node k.
+        size_t next(size_t k, size_t n) noexcept;
+        size_t prev(size_t k, size_t n) noexcept;
+
+        // Copies n sorted items from `first` into `out` in Eytzinger order.
+        template <typename InputIt, typename T>
+        void layout(InputIt first, size_t n, T *out);
+
+        // First node not less than / greater than key, or 0.
+        template <typename T, typename Key>
+        size_t lower_bound(const T *items, size_t n, const Key &key) noexcept;
+        template <typename T, typename Key>
+        size_t upper_bound(const T *items, size_t n, const Key &key) noexcept;
+    } // namespace eytzinger
+
+
+    inline size_t eytzinger::first(size_t n) noexcept
+    {
+        size_t k = n == 0 ? 0 : 1;
+        while (k != 0 && 2 * k <= n)
+        {
+            k = 2 * k;
+        }
+        return k;
+    }
+
+    inline size_t eytzinger::last(size_t n) noexcept
+    {
+        size_t k = n == 0 ? 0 : 1;
+        while (k != 0 && 2 * k + 1 <= n)
+        {
+            k = 2 * k + 1;
+        }
+        return k;
+    }
+
+    inline size_t eytzinger::next(size_t k, size_t n) noexcept
+    {
+        if (2 * k + 1 <= n)
+        {
+            k = 2 * k + 1;
+            while (2 * k <= n)
+            {
+                k = 2 * k;
+            }
+            return k;
+        }
+        // Climb while we are a right child; the parent of the last left
+        // child on the way is the successor (0 past the largest item).
+        while (k & 1)
+        {
+            k >>= 1;
+        }
+        return k >> 1;
+    }
+
+    inline size_t eytzinger::prev(size_t k, size_t n) noexcept
+    {
+        if (2 * k <= n)
+        {
+            k = 2 * k;
+            while (2 * k + 1 <= n)
+            {
+                k = 2 * k + 1;
+            }
+            return k;
+        }
+        while (k != 0 && !(k & 1))
+        {
+            k >>= 1;
+        }
+        return k >> 1;
+    }
+
+    template <typename InputIt, typename T>
+    void eytzinger::layout(InputIt first, size_t n, T *out)
+    {
+        for (size_t k = eytzinger::first(n); k != 0; k = next(k, n), ++first)
+        {
+            out[k - 1] = *first;
+        }
+    }
+
+    template <typename T, typename Key>
+    size_t eytzinger::lower_bound(const T *items, size_t n,
+                                  const Key &key) noexcept
+    {
+        // Four levels below k start at 16k; fetch that line early.
+        constexpr size_t kAhead = 16;
+        size_t k = 1;
+        while (k <= n)
+        {
+            if (kAhead * k <= n)
+            {
+                __builtin_prefetch(items + kAhead * k - 1);
+            }
+            k = 2 * k + (items[k - 1] < key);
+        }
+        // Undo the trailing right turns plus the final left one.
+        return k >> __builtin_ffsll(static_cast<long long>(~k));
+    }
+
+    template <typename T, typename Key>
+    size_t eytzinger::upper_bound(const T *items, size_t n,
+                                  const Key &key) noexcept
+    {
+        constexpr size_t kAhead = 16;
+        size_t k = 1;
+        while (k <= n)
+        {
+            if (kAhead * k <= n)
+            {
+                __builtin_prefetch(items + kAhead * k - 1);
+            }
+            k = 2 * k + !(key < items[k - 1]);
+        }
+        return k >> __builtin_ffsll(static_cast<long long>(~k));
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_EYTZINGER_H_
@@ -0,0 +1,489 @@
+#ifndef SRC_CONTAINERS_S21_FROZEN_MAP_H_
+#define SRC_CONTAINERS_S21_FROZEN_MAP_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <ostream>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "s21_eytzinger.h"
+#include "s21_map.h"
+
+namespace s21
+{
+    // Read-only snapshot of a map in one contiguous, position-independent
+    // buffer: a 64-byte header, then the keys in Eytzinger order, then the
+    // values in the same order. The buffer can be saved to a file and
+    // mapped by any number of processes; lookups read it in place and
+    // never allocate.
+    template <typename Key, typename T>
+    class frozen_map
+    {
+        static_assert(std::is_trivially_copyable_v<Key> &&
+                          std::is_trivially_copyable_v<T>,
+                      "frozen_map stores raw bytes of keys and values");
+        static_assert(alignof(Key) <= 64 && alignof(T) <= 64,
+                      "keys and values must fit the buffer alignment");
+
+    public:
+        class FrozenMapIterator;
+
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<const key_type &, const mapped_type &>;
+        using reference = value_type;
+        using const_reference = value_type;
+        using iterator = FrozenMapIterator;
+        using const_iterator = FrozenMapIterator;
+        using size_type = size_t;
+
+        // Freezes `source` into a buffer owned by this object.
+        explicit frozen_map(const map<Key, T> &source);
+        // Maps a file written by save() read-only.
+        explicit frozen_map(const char *path);
+        // Views a buffer owned by the caller, e.g. shared memory.
+        frozen_map(const void *buffer, size_type bytes);
+        frozen_map(const frozen_map &other) = delete;
+        frozen_map(frozen_map &&other) noexcept;
+        ~frozen_map();
+
+        frozen_map &operator=(const frozen_map &other) = delete;
+        frozen_map &operator=(frozen_map &&other) noexcept;
+
+        // Element access
+        const mapped_type &at(const key_type &key) const;
+
+        // Iterators, in key order
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Capacity
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+
+        // Lookup
+        const_iterator find(const key_type &key) const noexcept;
+        bool contains(const key_type &key) const noexcept;
+        const_iterator lower_bound(const key_type &key) const noexcept;
+        const_iterator upper_bound(const key_type &key) const noexcept;
+
+        // Buffer
+        const void *data() const noexcept;
+        size_type data_size() const noexcept;
+        void save(std::ostream &os) const;
+
+    private:
+        struct Header
+        {
+            char magic[8];
+            uint32_t version;
+            uint32_t key_size;
+            uint32_t value_size;
+            uint32_t reserved;
+            uint64_t count;
+            uint64_t keys_offset;
+            uint64_t values_offset;
+            uint64_t padding[2];
+        };
+
+        enum class Owner
+        {
+            kNone,
+            kHeap,
+            kMapping
+        };
+
+        static constexpr char kMagic[8] = {'S', '2', '1', 'F', 'M', 'A', 'P', '\0'};
+        static constexpr uint32_t kVersion = 1;
+        static constexpr size_type kAlignment = 64;
+
+        const char *buffer_;
+        size_type bytes_;
+        Owner owner_;
+        const Key *keys_;
+        const T *values_;
+        size_type size_;
+
+        void attach(const void *buffer, size_type bytes);
+        void release() noexcept;
+        static size_type alignUp(size_type offset) noexcept;
+    };
+
+    template <typename Key, typename T>
+    class frozen_map<Key, T>::FrozenMapIterator
+    {
+        friend class frozen_map;
+
+    public:
+        FrozenMapIterator() = default;
+
+        reference operator*() const
+        {
+            return reference(owner_->keys_[pos_ - 1], owner_->values_[pos_ - 1]);
+        }
+
+        FrozenMapIterator &operator++() noexcept
+        {
+            pos_ = eytzinger::next(pos_, owner_->size_);
+            return *this;
+        }
+
+        FrozenMapIterator operator++(int) noexcept
+        {
+            FrozenMapIterator tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        FrozenMapIterator &operator--() noexcept
+        {
+            pos_ = pos_ == 0 ? eytzinger::last(owner_->size_)
+                             : eytzinger::prev(pos_, owner_->size_);
+            return *this;
+        }
+
+        FrozenMapIterator operator--(int) noexcept
+        {
+            FrozenMapIterator tmp = *this;
+            --(*this);
+            return tmp;
+        }
+
+        bool operator==(const FrozenMapIterator &other) const noexcept
+        {
+            return pos_ == other.pos_ && owner_ == other.owner_;
+        }
+
+        bool operator!=(const FrozenMapIterator &other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+    private:
+        const frozen_map *owner_ = nullptr;
+        // Eytzinger position, 0 for end().
+        size_type pos_ = 0;
+
+        FrozenMapIterator(const frozen_map *owner, size_type pos)
+            : owner_(owner), pos_(pos) {}
+    };
+
+
+    template <typename Key, typename T>
+    frozen_map<Key, T>::frozen_map(const map<Key, T> &source)
+        : buffer_(nullptr), bytes_(0), owner_(Owner::kNone), keys_(nullptr),
+          values_(nullptr), size_(0)
+    {
+        size_type count = source.size();
+        size_type keys_offset = sizeof(Header);
+        size_type values_offset = alignUp(keys_offset + count * sizeof(Key));
+        size_type bytes = values_offset + count * sizeof(T);
+
+        char *buffer = static_cast<char *>(
+            ::operator new(bytes, std::align_val_t(kAlignment)));
+        std::memset(buffer, 0, bytes);
+
+        Header header{};
+        std::memcpy(header.magic, kMagic, sizeof(kMagic));
+        header.version = kVersion;
+        header.key_size = sizeof(Key);
+        header.value_size = sizeof(T);
+        header.count = count;
+        header.keys_offset = keys_offset;
+        header.values_offset = values_offset;
+        std::memcpy(buffer, &header, sizeof(header));
+
+        Key *keys = reinterpret_cast<Key *>(buffer + keys_offset);
+        T *values = reinterpret_cast<T *>(buffer + values_offset);
+        auto iter = source.cbegin();
+        for (size_type k = eytzinger::first(count); k != 0;
+             k = eytzinger::next(k, count), ++iter)
+        {
+            keys[k - 1] = (*iter).first;
+            values[k - 1] = (*iter).second;
+        }
+
+        attach(buffer, bytes);
+        owner_ = Owner::kHeap;
+    }
+
+    template <typename Key, typename T>
+    frozen_map<Key, T>::frozen_map(const char *path)
+        : buffer_(nullptr), bytes_(0), owner_(Owner::kNone), keys_(nullptr),
+          values_(nullptr), size_(0)
+    {
+        int fd = open(path, O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                                    "frozen_map: cannot open file");
+        }
+        struct stat info;
+        if (fstat(fd, &info) != 0)
+        {
+            int error = errno;
+            close(fd);
+            throw std::system_error(error, std::generic_category(),
+                                    "frozen_map: cannot stat file");
+        }
+        size_type bytes = static_cast<size_type>(info.st_size);
+        void *mapping = bytes == 0 ? MAP_FAILED
+                                   : mmap(nullptr, bytes, PROT_READ,
+                                          MAP_SHARED, fd, 0);
+        int error = errno;
+        close(fd);
+        if (bytes == 0)
+        {
+            throw std::invalid_argument("frozen_map: buffer is too small");
+        }
+        if (mapping == MAP_FAILED)
+        {
+            throw std::system_error(error, std::generic_category(),
+                                    "frozen_map: cannot map file");
+        }
+
+        try
+        {
+            attach(mapping, bytes);
+        }
+        catch (...)
+        {
+            munmap(mapping, bytes);
+            throw;
+        }
+        owner_ = Owner::kMapping;
+    }
+
+    template <typename Key, typename T>
+    frozen_map<Key, T>::frozen_map(const void *buffer, size_type bytes)
+        : buffer_(nullptr), bytes_(0), owner_(Owner::kNone), keys_(nullptr),
+          values_(nullptr), size_(0)
+    {
+        attach(buffer, bytes);
+    }
+
+    template <typename Key, typename T>
+    frozen_map<Key, T>::frozen_map(frozen_map &&other) noexcept
+        : buffer_(other.buffer_), bytes_(other.bytes_), owner_(other.owner_),
+          keys_(other.keys_), values_(other.values_), size_(other.size_)
+    {
+        other.buffer_ = nullptr;
+        other.bytes_ = 0;
+        other.owner_ = Owner::kNone;
+        other.size_ = 0;
+    }
+
+    template <typename Key, typename T>
+    frozen_map<Key, T>::~frozen_map()
+    {
+        release();
+    }
+
+    template <typename Key, typename T>
+    frozen_map<Key, T> &frozen_map<Key, T>::operator=(
+        frozen_map &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            buffer_ = other.buffer_;
+            bytes_ = other.bytes_;
+            owner_ = other.owner_;
+            keys_ = other.keys_;
+            values_ = other.values_;
+            size_ = other.size_;
+
+            other.buffer_ = nullptr;
+            other.bytes_ = 0;
+            other.owner_ = Owner::kNone;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    // Element access
+    template <typename Key, typename T>
+    const typename frozen_map<Key, T>::mapped_type &frozen_map<Key, T>::at(
+        const key_type &key) const
+    {
+        const_iterator iter = find(key);
+        if (iter == end())
+        {
+            throw std::out_of_range(
+                "Container does not have an element with the specified key");
+        }
+        return values_[iter.pos_ - 1];
+    }
+
+    // Iterators
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::const_iterator frozen_map<Key, T>::begin()
+        const noexcept
+    {
+        return const_iterator(this, eytzinger::first(size_));
+    }
+
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::const_iterator frozen_map<Key, T>::end()
+        const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::const_iterator frozen_map<Key, T>::cbegin()
+        const noexcept
+    {
+        return begin();
+    }
+
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::const_iterator frozen_map<Key, T>::cend()
+        const noexcept
+    {
+        return end();
+    }
+
+    // Capacity
+    template <typename Key, typename T>
+    bool frozen_map<Key, T>::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::size_type frozen_map<Key, T>::size()
+        const noexcept
+    {
+        return size_;
+    }
+
+    // Lookup
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::const_iterator frozen_map<Key, T>::find(
+        const key_type &key) const noexcept
+    {
+        size_type pos = eytzinger::lower_bound(keys_, size_, key);
+        if (pos != 0 && key < keys_[pos - 1])
+        {
+            pos = 0;
+        }
+        return const_iterator(this, pos);
+    }
+
+    template <typename Key, typename T>
+    bool frozen_map<Key, T>::contains(const key_type &key) const noexcept
+    {
+        return find(key) != end();
+    }
+
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::const_iterator frozen_map<Key, T>::lower_bound(
+        const key_type &key) const noexcept
+    {
+        return const_iterator(this, eytzinger::lower_bound(keys_, size_, key));
+    }
+
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::const_iterator frozen_map<Key, T>::upper_bound(
+        const key_type &key) const noexcept
+    {
+        return const_iterator(this, eytzinger::upper_bound(keys_, size_, key));
+    }
+
+    // Buffer
+    template <typename Key, typename T>
+    const void *frozen_map<Key, T>::data() const noexcept
+    {
+        return buffer_;
+    }
+
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::size_type frozen_map<Key, T>::data_size()
+        const noexcept
+    {
+        return bytes_;
+    }
+
+    template <typename Key, typename T>
+    void frozen_map<Key, T>::save(std::ostream &os) const
+    {
+        os.write(buffer_, static_cast<std::streamsize>(bytes_));
+        if (!os)
+        {
+            throw std::ios_base::failure("frozen_map: stream write failed");
+        }
+    }
+
+    template <typename Key, typename T>
+    void frozen_map<Key, T>::attach(const void *buffer, size_type bytes)
+    {
+        const char *base = static_cast<const char *>(buffer);
+        if (bytes < sizeof(Header) ||
+            reinterpret_cast<uintptr_t>(base) % kAlignment != 0)
+        {
+            throw std::invalid_argument(
+                "frozen_map: buffer is too small or misaligned");
+        }
+
+        Header header;
+        std::memcpy(&header, base, sizeof(header));
+        bool valid =
+            std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+            header.version == kVersion && header.key_size == sizeof(Key) &&
+            header.value_size == sizeof(T) &&
+            header.keys_offset == sizeof(Header) &&
+            header.count <= (bytes - sizeof(Header)) / sizeof(Key) &&
+            header.values_offset ==
+                alignUp(sizeof(Header) + header.count * sizeof(Key)) &&
+            header.values_offset <= bytes &&
+            header.count <= (bytes - header.values_offset) / sizeof(T);
+        if (!valid)
+        {
+            throw std::invalid_argument("frozen_map: not a matching buffer");
+        }
+
+        buffer_ = base;
+        bytes_ = bytes;
+        size_ = static_cast<size_type>(header.count);
+        keys_ = reinterpret_cast<const Key *>(base + header.keys_offset);
+        values_ = reinterpret_cast<const T *>(base + header.values_offset);
+    }
+
+    template <typename Key, typename T>
+    void frozen_map<Key, T>::release() noexcept
+    {
+        if (owner_ == Owner::kHeap)
+        {
+            ::operator delete(const_cast<char *>(buffer_),
+                              std::align_val_t(kAlignment));
+        }
+        else if (owner_ == Owner::kMapping)
+        {
+            munmap(const_cast<char *>(buffer_), bytes_);
+        }
+        buffer_ = nullptr;
+        owner_ = Owner::kNone;
+    }
+
+    template <typename Key, typename T>
+    typename frozen_map<Key, T>::size_type frozen_map<Key, T>::alignUp(
+        size_type offset) noexcept
+    {
+        return (offset + kAlignment - 1) & ~(kAlignment - 1);
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_FROZEN_MAP_H_
@@ -0,0 +1,123 @@
+#ifndef SRC_CONTAINERS_S21_GROWTH_POLICY_H_
+#define SRC_CONTAINERS_S21_GROWTH_POLICY_H_
+
+namespace s21
+{
+    // Growth policies decide the capacity a vector reallocates to once
+    // `required` elements no longer fit into `capacity`. The result is
+    // never less than `required`.
+
+    // The historical behavior: start at 8 elements, then grow by the golden
+    // ratio (approximated as 1 + 5/8 in integer arithmetic).
+    struct golden_growth
+    {
+        static size_t grow(size_t capacity, size_t required, size_t value_size);
+    };
+
+    // Grows by Numerator / Denominator, e.g. factor_growth<3, 2> for 1.5x.
+    template <size_t Numerator, size_t Denominator, size_t Initial = 8>
+    struct factor_growth
+    {
+        static_assert(Numerator > Denominator && Denominator > 0,
+                      "growth factor must be greater than one");
+
+        static size_t grow(size_t capacity, size_t required, size_t value_size);
+    };
+
+    using growth_1_5x = factor_growth<3, 2>;
+    using growth_2x = factor_growth<2, 1>;
+
+    // Applies Base, then rounds allocations of at least one page up to a
+    // whole number of pages so the tail of the last page is not wasted.
+    template <size_t PageSize = 4096, typename Base = growth_2x>
+    struct page_growth
+    {
+        static_assert((PageSize & (PageSize - 1)) == 0,
+                      "page size must be a power of two");
+
+        static size_t grow(size_t capacity, size_t required, size_t value_size);
+    };
+
+    // Applies Base, then rounds the allocation up to the next jemalloc size
+    // class: 8, 16, then 16-byte steps up to 128, then four classes per
+    // doubling. The slack the allocator hands out anyway becomes capacity.
+    template <typename Base = growth_1_5x>
+    struct size_class_growth
+    {
+        static size_t grow(size_t capacity, size_t required, size_t value_size);
+        static size_t size_class(size_t bytes);
+    };
+
+
+    inline size_t golden_growth::grow(size_t capacity, size_t required,
+                                      size_t)
+    {
+        if (capacity == 0)
+        {
+            capacity = 8;
+        }
+        while (capacity < required)
+        {
+            capacity += capacity / 8 * 5 + capacity % 8 * 5 / 8 + 1;
+        }
+        return capacity;
+    }
+
+    template <size_t Numerator, size_t Denominator, size_t Initial>
+    size_t factor_growth<Numerator, Denominator, Initial>::grow(
+        size_t capacity, size_t required, size_t)
+    {
+        size_t grown = Initial;
+        if (capacity >= Initial)
+        {
+            grown = capacity / Denominator * Numerator +
+                    capacity % Denominator * Numerator / Denominator;
+        }
+        return grown < required ? required : grown;
+    }
+
+    template <size_t PageSize, typename Base>
+    size_t page_growth<PageSize, Base>::grow(size_t capacity, size_t required,
+                                             size_t value_size)
+    {
+        size_t grown = Base::grow(capacity, required, value_size);
+        size_t bytes = grown * value_size;
+        if (bytes < PageSize)
+        {
+            return grown;
+        }
+        bytes = (bytes + PageSize - 1) & ~(PageSize - 1);
+        return bytes / value_size;
+    }
+
+    template <typename Base>
+    size_t size_class_growth<Base>::grow(size_t capacity, size_t required,
+                                         size_t value_size)
+    {
+        size_t grown = Base::grow(capacity, required, value_size);
+        return size_class(grown * value_size) / value_size;
+    }
+
+    template <typename Base>
+    size_t size_class_growth<Base>::size_class(size_t bytes)
+    {
+        if (bytes <= 8)
+        {
+            return 8;
+        }
+        if (bytes <= 128)
+        {
+            return (bytes + 15) & ~size_t(15);
+        }
+        // Classes between 2^k and 2^(k+1) are spaced 2^(k-2) apart.
+        size_t group = 128;
+        while (group * 2 < bytes)
+        {
+            group *= 2;
+        }
+        size_t spacing = group / 4;
+        return (bytes + spacing - 1) / spacing * spacing;
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_GROWTH_POLICY_H_
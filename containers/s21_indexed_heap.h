@@ -0,0 +1,360 @@
+#ifndef SRC_CONTAINERS_S21_INDEXED_HEAP_H_
+#define SRC_CONTAINERS_S21_INDEXED_HEAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Addressable d-ary min-heap: push returns a handle through which the
+    // entry's priority can be changed, or the entry erased, in O(log n).
+    // top() is the entry no other entry's priority compares less than.
+    //
+    // Priorities live in the heap array next to their slot index, so
+    // sifting compares contiguous entries; keys and each entry's heap
+    // position live in a side table of slots. A handle stays valid until
+    // its entry is popped or erased. push may then reuse the slot, but a
+    // handle also carries its slot's generation, which every removal
+    // bumps, so a stale handle never reaches the entry that replaced it.
+    template <typename Key, typename Priority, typename Compare = std::less<Priority>,
+              size_t Arity = 4>
+    class indexed_heap
+    {
+        static_assert(Arity >= 2, "a heap needs at least two children per node");
+
+    public:
+        // Indexed heap Member type
+        using key_type = Key;
+        using priority_type = Priority;
+        using priority_compare = Compare;
+        using handle_type = uint64_t;
+        using size_type = size_t;
+
+        static constexpr size_type arity = Arity;
+
+        // Indexed heap Member functions
+        indexed_heap() : heap_(), slots_(), free_(kNone), comp_() {}
+        explicit indexed_heap(const Compare &compare) : heap_(), slots_(), free_(kNone), comp_(compare) {}
+
+        // Indexed heap Element access
+        handle_type top() const;
+        const key_type &key(handle_type handle) const;
+        const priority_type &priority(handle_type handle) const;
+        bool contains(handle_type handle) const noexcept;
+
+        // Indexed heap Capacity
+        bool empty() const noexcept { return heap_.cbegin() == heap_.cend(); }
+        size_type size() const noexcept { return heap_.cend() - heap_.cbegin(); }
+        void reserve(size_type size);
+
+        // Indexed heap Modifiers
+        handle_type push(const key_type &key, const priority_type &priority);
+        void pop();
+        void erase(handle_type handle);
+        // Each moves the entry only in the direction its priority changed.
+        // decrease_key and increase_key throw std::invalid_argument when the
+        // new priority goes the other way.
+        void decrease_key(handle_type handle, const priority_type &priority);
+        void increase_key(handle_type handle, const priority_type &priority);
+        void update(handle_type handle, const priority_type &priority);
+        void clear() noexcept;
+        void swap(indexed_heap &other) noexcept;
+
+    private:
+        static constexpr size_type kNone = static_cast<size_type>(-1);
+        // A handle is its slot's generation above kSlotBits of slot index.
+        static constexpr int kSlotBits = 32;
+        static constexpr uint64_t kMaxSlots = uint64_t(1) << kSlotBits;
+
+        struct Entry
+        {
+            Priority priority;
+            size_type slot;
+        };
+
+        struct Slot
+        {
+            Key key;
+            // Heap position while used, else the next free slot.
+            size_type position;
+            uint32_t generation;
+            bool used;
+        };
+
+        vector<Entry> heap_;
+        vector<Slot> slots_;
+        // Head of the free slots, linked through their positions, so
+        // freeing a slot never allocates.
+        size_type free_;
+        Compare comp_;
+
+        handle_type HandleOf(size_type slot) const noexcept;
+        void Free(size_type slot) noexcept;
+        size_type PositionOf(handle_type handle) const;
+        void Place(size_type position, Entry &&entry);
+        void SiftUp(size_type hole, Entry entry);
+        void SiftDown(size_type hole, Entry entry);
+        void Remove(size_type position);
+    };
+
+
+    // Indexed heap Element access
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    typename indexed_heap<Key, Priority, Compare, Arity>::handle_type
+    indexed_heap<Key, Priority, Compare, Arity>::top() const
+    {
+        if (empty())
+        {
+            throw std::out_of_range("accessing top element of an empty heap");
+        }
+        return HandleOf(heap_.cbegin()->slot);
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    const Key &indexed_heap<Key, Priority, Compare, Arity>::key(handle_type handle) const
+    {
+        PositionOf(handle);
+        return slots_.cbegin()[handle & (kMaxSlots - 1)].key;
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    const Priority &indexed_heap<Key, Priority, Compare, Arity>::priority(handle_type handle) const
+    {
+        return heap_.cbegin()[PositionOf(handle)].priority;
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    bool indexed_heap<Key, Priority, Compare, Arity>::contains(handle_type handle) const noexcept
+    {
+        uint64_t slot = handle & (kMaxSlots - 1);
+        if (slot >= static_cast<uint64_t>(slots_.cend() - slots_.cbegin()))
+        {
+            return false;
+        }
+        const Slot &entry = slots_.cbegin()[slot];
+        return entry.used && entry.generation == handle >> kSlotBits;
+    }
+
+    // Indexed heap Capacity
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::reserve(size_type size)
+    {
+        heap_.reserve(size);
+        slots_.reserve(size);
+    }
+
+    // Indexed heap Modifiers
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    typename indexed_heap<Key, Priority, Compare, Arity>::handle_type
+    indexed_heap<Key, Priority, Compare, Arity>::push(const key_type &key,
+                                                      const priority_type &priority)
+    {
+        // The slot joins the free list first and leaves it only once the
+        // heap has room for the entry, so a throw leaves it reusable.
+        if (free_ == kNone)
+        {
+            if (slots_.size() == kMaxSlots)
+            {
+                throw std::length_error("indexed_heap has run out of handles");
+            }
+            slots_.push_back(Slot{key, kNone, 0, false});
+            free_ = slots_.size() - 1;
+        }
+        else
+        {
+            slots_[free_].key = key;
+        }
+        size_type slot = free_;
+        heap_.push_back(Entry{priority, slot});
+        free_ = slots_[slot].position;
+        slots_[slot].used = true;
+        size_type hole = heap_.size() - 1;
+        SiftUp(hole, std::move(heap_[hole]));
+        return HandleOf(slot);
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::pop()
+    {
+        Remove(PositionOf(top()));
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::erase(handle_type handle)
+    {
+        Remove(PositionOf(handle));
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::decrease_key(handle_type handle,
+                                                                   const priority_type &priority)
+    {
+        size_type position = PositionOf(handle);
+        if (comp_(heap_[position].priority, priority))
+        {
+            throw std::invalid_argument("decrease_key given a greater priority");
+        }
+        SiftUp(position, Entry{priority, heap_[position].slot});
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::increase_key(handle_type handle,
+                                                                   const priority_type &priority)
+    {
+        size_type position = PositionOf(handle);
+        if (comp_(priority, heap_[position].priority))
+        {
+            throw std::invalid_argument("increase_key given a smaller priority");
+        }
+        SiftDown(position, Entry{priority, heap_[position].slot});
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::update(handle_type handle,
+                                                             const priority_type &priority)
+    {
+        size_type position = PositionOf(handle);
+        if (comp_(priority, heap_[position].priority))
+        {
+            SiftUp(position, Entry{priority, heap_[position].slot});
+        }
+        else
+        {
+            SiftDown(position, Entry{priority, heap_[position].slot});
+        }
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::clear() noexcept
+    {
+        // Slots are freed rather than dropped, so handles from before the
+        // clear cannot match entries pushed after it.
+        heap_.clear();
+        for (size_type slot = slots_.size(); slot > 0; --slot)
+        {
+            if (slots_[slot - 1].used)
+            {
+                Free(slot - 1);
+            }
+        }
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::swap(indexed_heap &other) noexcept
+    {
+        std::swap(heap_, other.heap_);
+        std::swap(slots_, other.slots_);
+        std::swap(free_, other.free_);
+        std::swap(comp_, other.comp_);
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    typename indexed_heap<Key, Priority, Compare, Arity>::handle_type
+    indexed_heap<Key, Priority, Compare, Arity>::HandleOf(size_type slot) const noexcept
+    {
+        return static_cast<uint64_t>(slots_.cbegin()[slot].generation) << kSlotBits | slot;
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::Free(size_type slot) noexcept
+    {
+        Slot &entry = slots_[slot];
+        entry.used = false;
+        ++entry.generation;
+        entry.position = free_;
+        free_ = slot;
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    typename indexed_heap<Key, Priority, Compare, Arity>::size_type
+    indexed_heap<Key, Priority, Compare, Arity>::PositionOf(handle_type handle) const
+    {
+        if (!contains(handle))
+        {
+            throw std::out_of_range("Heap does not have an element with the specified handle");
+        }
+        return slots_.cbegin()[handle & (kMaxSlots - 1)].position;
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::Place(size_type position, Entry &&entry)
+    {
+        slots_[entry.slot].position = position;
+        heap_[position] = std::move(entry);
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::SiftUp(size_type hole, Entry entry)
+    {
+        while (hole > 0)
+        {
+            size_type parent = (hole - 1) / Arity;
+            if (!comp_(entry.priority, heap_[parent].priority))
+            {
+                break;
+            }
+            Place(hole, std::move(heap_[parent]));
+            hole = parent;
+        }
+        Place(hole, std::move(entry));
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::SiftDown(size_type hole, Entry entry)
+    {
+        size_type size = heap_.size();
+        for (;;)
+        {
+            size_type first = hole * Arity + 1;
+            if (first >= size)
+            {
+                break;
+            }
+            size_type last = first + Arity < size ? first + Arity : size;
+            size_type best = first;
+            for (size_type child = first + 1; child < last; ++child)
+            {
+                if (comp_(heap_[child].priority, heap_[best].priority))
+                {
+                    best = child;
+                }
+            }
+            if (!comp_(heap_[best].priority, entry.priority))
+            {
+                break;
+            }
+            Place(hole, std::move(heap_[best]));
+            hole = best;
+        }
+        Place(hole, std::move(entry));
+    }
+
+    template <typename Key, typename Priority, typename Compare, size_t Arity>
+    void indexed_heap<Key, Priority, Compare, Arity>::Remove(size_type position)
+    {
+        Free(heap_[position].slot);
+        size_type last = heap_.size() - 1;
+        Entry moved = std::move(heap_[last]);
+        heap_.pop_back();
+        if (position == last)
+        {
+            return;
+        }
+        // The last entry fills the hole and may belong above or below it.
+        if (position > 0 && comp_(moved.priority, heap_[(position - 1) / Arity].priority))
+        {
+            SiftUp(position, std::move(moved));
+        }
+        else
+        {
+            SiftDown(position, std::move(moved));
+        }
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_INDEXED_HEAP_H_
@@ -0,0 +1,118 @@
+#ifndef SRC_CONTAINERS_S21_INLINE_BUFFER_H_
+#define SRC_CONTAINERS_S21_INLINE_BUFFER_H_
+
+#include <cstdint>
+#include <istream>
+#include <new>
+#include <utility>
+
+#include "s21_serialize.h"
+
+namespace s21
+{
+    // Shared by the vectors that construct elements in raw slots of storage
+    // they manage themselves, inline or not: small_vector and
+    // static_vector. `items` holds `size` live elements followed by raw
+    // slots. make_room(amount) is the owner's hook to make space for
+    // `amount` more elements, by growing or by throwing; it returns the
+    // buffer, which may have moved.
+    namespace inline_buffer
+    {
+        // Moves the elements from `index` on `amount` slots right, leaving
+        // [index, index + amount) raw; room for them must already exist.
+        template <typename T>
+        void open_gap(T *items, size_t size, size_t index, size_t amount);
+
+        // Inserts the arguments at `index` and returns the buffer.
+        template <typename T, typename MakeRoom, typename... Args>
+        T *insert_many(T *items, size_t &size, size_t index,
+                       MakeRoom make_room, Args &&...args);
+
+        // Appends `count` serialized elements to an empty buffer.
+        template <typename T, typename MakeRoom>
+        void load(std::istream &is, uint64_t count, const char *corrupt,
+                  size_t &size, MakeRoom make_room);
+    } // namespace inline_buffer
+
+
+    template <typename T>
+    void inline_buffer::open_gap(T *items, size_t size, size_t index,
+                                 size_t amount)
+    {
+        // The tail moves once: slots past the old end are constructed, slots
+        // inside it are assigned, and the vacated slots are left raw.
+        for (size_t i = size; i > index; --i)
+        {
+            size_t target = i - 1 + amount;
+            if (target >= size)
+            {
+                new (items + target) T(std::move(items[i - 1]));
+            }
+            else
+            {
+                items[target] = std::move(items[i - 1]);
+            }
+        }
+
+        size_t vacated_end = (index + amount < size) ? index + amount : size;
+        for (size_t i = index; i < vacated_end; ++i)
+        {
+            items[i].~T();
+        }
+    }
+
+    template <typename T, typename MakeRoom, typename... Args>
+    T *inline_buffer::insert_many(T *items, size_t &size, size_t index,
+                                  MakeRoom make_room, Args &&...args)
+    {
+        if constexpr (sizeof...(args) > 0)
+        {
+            // Arguments may refer to our own elements, so they are
+            // materialized before the tail is moved.
+            T values[] = {T(std::forward<Args>(args))...};
+
+            items = make_room(sizeof...(args));
+            open_gap(items, size, index, sizeof...(args));
+            for (size_t i = 0; i < sizeof...(args); ++i)
+            {
+                new (items + index + i) T(std::move(values[i]));
+            }
+            size += sizeof...(args);
+        }
+        else
+        {
+            (void)size;
+            (void)index;
+            (void)make_room;
+        }
+        return items;
+    }
+
+    template <typename T, typename MakeRoom>
+    void inline_buffer::load(std::istream &is, uint64_t count,
+                             const char *corrupt, size_t &size,
+                             MakeRoom make_room)
+    {
+        serial::read_chunked<T>(count, corrupt, [&](size_t amount) {
+            T *items = make_room(amount);
+            if constexpr (serializer<T>::bulk)
+            {
+                // Such elements may be read straight into raw slots.
+                serial::read_array(is, items + size, amount);
+                size += amount;
+            }
+            else
+            {
+                for (size_t i = 0; i < amount; ++i)
+                {
+                    T item{};
+                    serial::read(is, item);
+                    new (items + size) T(std::move(item));
+                    ++size;
+                }
+            }
+        });
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_INLINE_BUFFER_H_
@@ -0,0 +1,624 @@
+#ifndef SRC_CONTAINERS_S21_INTRUSIVE_LIST_H_
+#define SRC_CONTAINERS_S21_INTRUSIVE_LIST_H_
+
+#include <cstddef>
+
+namespace s21
+{
+    // Links embedded into an element. An object may carry several hooks to
+    // be a member of several lists at once. A hook unlinks itself when the
+    // element is destroyed, and copying an element never copies its links.
+    class intrusive_list_hook
+    {
+    public:
+        intrusive_list_hook() noexcept : prev_(nullptr), next_(nullptr) {}
+        intrusive_list_hook(const intrusive_list_hook &) noexcept
+            : prev_(nullptr), next_(nullptr) {}
+        intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept
+        {
+            return *this;
+        }
+        ~intrusive_list_hook() { unlink(); }
+
+        bool is_linked() const noexcept { return next_ != nullptr; }
+
+        void unlink() noexcept
+        {
+            if (!is_linked())
+            {
+                return;
+            }
+            prev_->next_ = next_;
+            next_->prev_ = prev_;
+            prev_ = nullptr;
+            next_ = nullptr;
+        }
+
+    private:
+        template <typename T, intrusive_list_hook T::*Hook>
+        friend class intrusive_list;
+
+        intrusive_list_hook *prev_;
+        intrusive_list_hook *next_;
+    };
+
+    // Non-owning doubly linked list over elements that embed an
+    // intrusive_list_hook. Nothing is allocated: the list only relinks hooks.
+    // Because an element may unlink itself without knowing its list, size()
+    // walks the list; empty() stays constant time.
+    template <typename T, intrusive_list_hook T::*Hook>
+    class intrusive_list
+    {
+    public:
+        template <typename ret_value>
+        class IntrusiveTempIterator;
+
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = IntrusiveTempIterator<reference>;
+        using const_iterator = IntrusiveTempIterator<const_reference>;
+        using size_type = size_t;
+
+        intrusive_list() noexcept;
+        intrusive_list(const intrusive_list &l) = delete;
+        intrusive_list(intrusive_list &&l) noexcept;
+        ~intrusive_list();
+
+        intrusive_list &operator=(const intrusive_list &l) = delete;
+        intrusive_list &operator=(intrusive_list &&l) noexcept;
+
+        reference front() noexcept;
+        reference back() noexcept;
+        const_reference front() const noexcept;
+        const_reference back() const noexcept;
+
+        iterator begin() noexcept;
+        iterator end() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+
+        void clear() noexcept;
+        iterator insert(iterator pos, reference value) noexcept;
+        iterator erase(iterator pos) noexcept;
+        void push_back(reference value) noexcept;
+        void pop_back() noexcept;
+        void push_front(reference value) noexcept;
+        void pop_front() noexcept;
+        void swap(intrusive_list &other) noexcept;
+        void merge(intrusive_list &other);
+        void splice(const_iterator pos, intrusive_list &other) noexcept;
+        void splice(const_iterator pos, intrusive_list &other,
+                    const_iterator it) noexcept;
+        void splice(const_iterator pos, intrusive_list &other,
+                    const_iterator first, const_iterator last) noexcept;
+        void reverse() noexcept;
+        void unique();
+        void sort();
+
+        template <typename... Args>
+        void insert_many_back(Args &...args) noexcept;
+
+        static iterator iterator_to(reference value) noexcept;
+        static const_iterator iterator_to(const_reference value) noexcept;
+
+    private:
+        using Hook_t = intrusive_list_hook;
+
+        Hook_t sentinel_;
+
+        Hook_t *Sentinel() const noexcept;
+        void InitSentinel() noexcept;
+        void TakeHooks(intrusive_list &other) noexcept;
+        intrusive_list Divide() noexcept;
+        static void Unlink(Hook_t *first, Hook_t *last) noexcept;
+        static void LinkBefore(Hook_t *pos, Hook_t *first,
+                               Hook_t *last) noexcept;
+        static Hook_t *ToHook(const_reference value) noexcept;
+        static std::ptrdiff_t HookOffset() noexcept;
+        static T *ToElement(Hook_t *hook) noexcept;
+    };
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    intrusive_list<T, Hook>::intrusive_list() noexcept
+    {
+        InitSentinel();
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    intrusive_list<T, Hook>::intrusive_list(intrusive_list &&l) noexcept
+    {
+        InitSentinel();
+        TakeHooks(l);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    intrusive_list<T, Hook>::~intrusive_list()
+    {
+        clear();
+        sentinel_.prev_ = nullptr;
+        sentinel_.next_ = nullptr;
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    intrusive_list<T, Hook> &intrusive_list<T, Hook>::operator=(
+        intrusive_list &&l) noexcept
+    {
+        if (this == &l)
+        {
+            return *this;
+        }
+        clear();
+        TakeHooks(l);
+        return *this;
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::reference
+    intrusive_list<T, Hook>::front() noexcept
+    {
+        return *ToElement(sentinel_.next_);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::reference
+    intrusive_list<T, Hook>::back() noexcept
+    {
+        return *ToElement(sentinel_.prev_);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::const_reference
+    intrusive_list<T, Hook>::front() const noexcept
+    {
+        return *ToElement(sentinel_.next_);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::const_reference
+    intrusive_list<T, Hook>::back() const noexcept
+    {
+        return *ToElement(sentinel_.prev_);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::iterator
+    intrusive_list<T, Hook>::begin() noexcept
+    {
+        return iterator(sentinel_.next_);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::iterator
+    intrusive_list<T, Hook>::end() noexcept
+    {
+        return iterator(Sentinel());
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::const_iterator
+    intrusive_list<T, Hook>::begin() const noexcept
+    {
+        return const_iterator(sentinel_.next_);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::const_iterator
+    intrusive_list<T, Hook>::end() const noexcept
+    {
+        return const_iterator(Sentinel());
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::const_iterator
+    intrusive_list<T, Hook>::cbegin() const noexcept
+    {
+        return const_iterator(sentinel_.next_);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::const_iterator
+    intrusive_list<T, Hook>::cend() const noexcept
+    {
+        return const_iterator(Sentinel());
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    bool intrusive_list<T, Hook>::empty() const noexcept
+    {
+        return sentinel_.next_ == Sentinel();
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::size_type
+    intrusive_list<T, Hook>::size() const noexcept
+    {
+        size_type count = 0;
+        for (Hook_t *hook = sentinel_.next_; hook != Sentinel();
+             hook = hook->next_)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::clear() noexcept
+    {
+        Hook_t *current = sentinel_.next_;
+        while (current != Sentinel())
+        {
+            Hook_t *next = current->next_;
+            current->prev_ = nullptr;
+            current->next_ = nullptr;
+            current = next;
+        }
+        InitSentinel();
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::insert(
+        iterator pos, reference value) noexcept
+    {
+        Hook_t *hook = ToHook(value);
+        if (hook != pos.current_)
+        {
+            hook->unlink();
+            LinkBefore(pos.current_, hook, hook);
+        }
+        return iterator(hook);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::iterator intrusive_list<T, Hook>::erase(
+        iterator pos) noexcept
+    {
+        Hook_t *next = pos.current_->next_;
+        pos.current_->unlink();
+        return iterator(next);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::push_back(reference value) noexcept
+    {
+        insert(end(), value);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::pop_back() noexcept
+    {
+        sentinel_.prev_->unlink();
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::push_front(reference value) noexcept
+    {
+        insert(begin(), value);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::pop_front() noexcept
+    {
+        sentinel_.next_->unlink();
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::swap(intrusive_list &other) noexcept
+    {
+        intrusive_list tmp(std::move(other));
+        other.TakeHooks(*this);
+        TakeHooks(tmp);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::merge(intrusive_list &other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        Hook_t *current = sentinel_.next_;
+
+        while (!other.empty() && current != Sentinel())
+        {
+            Hook_t *candidate = other.sentinel_.next_;
+            if (*ToElement(current) > *ToElement(candidate))
+            {
+                Unlink(candidate, candidate);
+                LinkBefore(current, candidate, candidate);
+            }
+            else
+            {
+                current = current->next_;
+            }
+        }
+
+        splice(cend(), other);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                         intrusive_list &other) noexcept
+    {
+        if (this == &other || other.empty())
+        {
+            return;
+        }
+
+        Hook_t *first = other.sentinel_.next_;
+        Hook_t *last = other.sentinel_.prev_;
+
+        Unlink(first, last);
+        LinkBefore(pos.current_, first, last);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                         intrusive_list &,
+                                         const_iterator it) noexcept
+    {
+        Hook_t *hook = it.current_;
+        if (pos.current_ == hook || pos.current_ == hook->next_)
+        {
+            return;
+        }
+
+        Unlink(hook, hook);
+        LinkBefore(pos.current_, hook, hook);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::splice(const_iterator pos,
+                                         intrusive_list &,
+                                         const_iterator first,
+                                         const_iterator last) noexcept
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        Hook_t *first_hook = first.current_;
+        Hook_t *last_hook = last.current_->prev_;
+
+        Unlink(first_hook, last_hook);
+        LinkBefore(pos.current_, first_hook, last_hook);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::reverse() noexcept
+    {
+        Hook_t *current = Sentinel();
+        do
+        {
+            std::swap(current->prev_, current->next_);
+            current = current->prev_;
+        } while (current != Sentinel());
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::unique()
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        Hook_t *current = sentinel_.next_->next_;
+        for (; current != Sentinel(); current = current->next_)
+        {
+            if (*ToElement(current) == *ToElement(current->prev_))
+            {
+                current->prev_->unlink();
+            }
+        }
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::sort()
+    {
+        if (sentinel_.next_ == sentinel_.prev_)
+        {
+            return;
+        }
+
+        intrusive_list second_half = Divide();
+
+        sort();
+        second_half.sort();
+
+        merge(second_half);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    template <typename... Args>
+    void intrusive_list<T, Hook>::insert_many_back(Args &...args) noexcept
+    {
+        (push_back(args), ...);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::iterator
+    intrusive_list<T, Hook>::iterator_to(reference value) noexcept
+    {
+        return iterator(ToHook(value));
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::const_iterator
+    intrusive_list<T, Hook>::iterator_to(const_reference value) noexcept
+    {
+        return const_iterator(ToHook(value));
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::Hook_t *
+    intrusive_list<T, Hook>::Sentinel() const noexcept
+    {
+        return const_cast<Hook_t *>(&sentinel_);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::InitSentinel() noexcept
+    {
+        sentinel_.prev_ = &sentinel_;
+        sentinel_.next_ = &sentinel_;
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::TakeHooks(intrusive_list &other) noexcept
+    {
+        if (other.empty())
+        {
+            InitSentinel();
+            return;
+        }
+
+        sentinel_.next_ = other.sentinel_.next_;
+        sentinel_.prev_ = other.sentinel_.prev_;
+        sentinel_.next_->prev_ = &sentinel_;
+        sentinel_.prev_->next_ = &sentinel_;
+
+        other.InitSentinel();
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    intrusive_list<T, Hook> intrusive_list<T, Hook>::Divide() noexcept
+    {
+        intrusive_list second_part;
+
+        Hook_t *slow = sentinel_.next_;
+        Hook_t *fast = sentinel_.next_;
+        while (fast->next_ != Sentinel() && fast->next_->next_ != Sentinel())
+        {
+            fast = fast->next_->next_;
+            slow = slow->next_;
+        }
+
+        Hook_t *first = slow->next_;
+        Hook_t *last = sentinel_.prev_;
+
+        Unlink(first, last);
+        LinkBefore(second_part.Sentinel(), first, last);
+        return second_part;
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::Unlink(Hook_t *first, Hook_t *last) noexcept
+    {
+        first->prev_->next_ = last->next_;
+        last->next_->prev_ = first->prev_;
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    void intrusive_list<T, Hook>::LinkBefore(Hook_t *pos, Hook_t *first,
+                                             Hook_t *last) noexcept
+    {
+        Hook_t *before = pos->prev_;
+
+        first->prev_ = before;
+        last->next_ = pos;
+        before->next_ = first;
+        pos->prev_ = last;
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    typename intrusive_list<T, Hook>::Hook_t *intrusive_list<T, Hook>::ToHook(
+        const_reference value) noexcept
+    {
+        return const_cast<Hook_t *>(&(value.*Hook));
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    std::ptrdiff_t intrusive_list<T, Hook>::HookOffset() noexcept
+    {
+        // A union member gives storage for a T whose lifetime never starts.
+        // Naming its hook only forms addresses, which is allowed before the
+        // lifetime begins, and the optimiser folds the result to a constant.
+        union Probe
+        {
+            Probe() noexcept {}
+            ~Probe() {}
+            T object;
+        } probe;
+        return reinterpret_cast<const unsigned char *>(&(probe.object.*Hook)) -
+               reinterpret_cast<const unsigned char *>(&probe.object);
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    T *intrusive_list<T, Hook>::ToElement(Hook_t *hook) noexcept
+    {
+        return reinterpret_cast<T *>(reinterpret_cast<unsigned char *>(hook) -
+                                     HookOffset());
+    }
+
+    template <typename T, intrusive_list_hook T::*Hook>
+    template <typename ret_value>
+    class intrusive_list<T, Hook>::IntrusiveTempIterator
+    {
+    public:
+        template <typename>
+        friend class IntrusiveTempIterator;
+        friend class intrusive_list<T, Hook>;
+
+        IntrusiveTempIterator() = default;
+        explicit IntrusiveTempIterator(Hook_t *hook) : current_(hook) {}
+        template <typename U>
+        IntrusiveTempIterator(const IntrusiveTempIterator<U> &it)
+            : current_{it.current_} {}
+
+        ret_value operator*() const { return *ToElement(current_); }
+        std::remove_reference_t<ret_value> *operator->() const
+        {
+            return ToElement(current_);
+        }
+
+        IntrusiveTempIterator &operator++()
+        {
+            current_ = current_->next_;
+            return *this;
+        }
+
+        IntrusiveTempIterator operator++(int)
+        {
+            IntrusiveTempIterator tmp(*this);
+            ++(*this);
+            return tmp;
+        }
+
+        IntrusiveTempIterator &operator--()
+        {
+            current_ = current_->prev_;
+            return *this;
+        }
+
+        IntrusiveTempIterator operator--(int)
+        {
+            IntrusiveTempIterator tmp(*this);
+            --(*this);
+            return tmp;
+        }
+
+        bool operator==(const IntrusiveTempIterator &other) const noexcept
+        {
+            return current_ == other.current_;
+        }
+
+        bool operator!=(const IntrusiveTempIterator &other) const noexcept
+        {
+            return current_ != other.current_;
+        }
+
+    private:
+        Hook_t *current_;
+    };
+
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_INTRUSIVE_LIST_H_
@@ -1,6 +1,8 @@
 #ifndef SRC_CONTAINERS_S21_LIST_H_
 #define SRC_CONTAINERS_S21_LIST_H_
 
+#include "s21_serialize.h"
+
 namespace s21
 {
     template <typename T>
@@ -50,6 +52,9 @@ namespace s21
         void swap(list &other);
         void merge(list &other);
         void splice(const_iterator pos, list &other);
+        void splice(const_iterator pos, list &other, const_iterator it);
+        void splice(const_iterator pos, list &other, const_iterator first,
+                    const_iterator last);
         void reverse();
         void unique();
         void sort();
@@ -63,37 +68,53 @@ namespace s21
         template <typename... Args>
         void insert_many_front(Args &&...args);
 
+        void save(std::ostream &os) const;
+        void load(std::istream &is);
+
     private:
         class Node;
 
-        Node *head_;
-        Node *tail_;
+        struct NodeBase
+        {
+            NodeBase *prev;
+            NodeBase *next;
+        };
+
+        // The sentinel closes the nodes into a ring: sentinel_.next is the
+        // first element, sentinel_.prev the last one and end() points to it.
+        NodeBase sentinel_;
         size_type size_;
 
+        NodeBase *Sentinel() const noexcept;
+        void InitSentinel() noexcept;
+        void TakeNodes(list &other) noexcept;
         void DestroyAllNodes();
-        Node *Extract(iterator pos);
-        Node *Extract(Node *node);
-        void Erase(Node *node);
-        iterator Insert(iterator pos, Node *node);
+        void Erase(NodeBase *node);
+        void Unlink(NodeBase *first, NodeBase *last, size_type count) noexcept;
+        void LinkBefore(NodeBase *pos, NodeBase *first, NodeBase *last,
+                        size_type count) noexcept;
+        static const_reference Value(NodeBase *node) noexcept;
         list Divide();
     };
 
+
     template <typename T>
-    list<T>::list() noexcept : head_(nullptr), tail_(nullptr), size_(0) {}
+    list<T>::list() noexcept : size_(0)
+    {
+        InitSentinel();
+    }
 
     template <typename T>
-    list<T>::list(size_type n) : head_(nullptr), tail_(nullptr), size_(0)
+    list<T>::list(size_type n) : list()
     {
         for (size_type i = 0; i < n; ++i)
         {
             push_back(T());
         }
-        size_ = n;
     }
 
     template <typename T>
-    list<T>::list(std::initializer_list<value_type> const &items)
-        : head_(nullptr), tail_(nullptr), size_(0)
+    list<T>::list(std::initializer_list<value_type> const &items) : list()
     {
         for (auto item : items)
         {
@@ -102,7 +123,7 @@ namespace s21
     }
 
     template <typename T>
-    list<T>::list(const list &l) : head_(nullptr), tail_(nullptr), size_(0)
+    list<T>::list(const list &l) : list()
     {
         for (auto iter = l.cbegin(); iter != l.cend(); ++iter)
         {
@@ -111,15 +132,9 @@ namespace s21
     }
 
     template <typename T>
-    list<T>::list(list &&l) noexcept
+    list<T>::list(list &&l) noexcept : list()
     {
-        head_ = l.head_;
-        tail_ = l.tail_;
-        size_ = l.size_;
-
-        l.head_ = nullptr;
-        l.tail_ = nullptr;
-        l.size_ = 0;
+        TakeNodes(l);
     }
 
     template <typename T>
@@ -153,14 +168,7 @@ namespace s21
         }
 
         DestroyAllNodes();
-
-        head_ = l.head_;
-        tail_ = l.tail_;
-        size_ = l.size_;
-
-        l.head_ = nullptr;
-        l.tail_ = nullptr;
-        l.size_ = 0;
+        TakeNodes(l);
         return *this;
     }
 
@@ -178,37 +186,37 @@ namespace s21
     template <typename T>
     typename list<T>::const_reference list<T>::front() const
     {
-        return head_->data;
+        return Value(sentinel_.next);
     }
 
     template <typename T>
     typename list<T>::const_reference list<T>::back() const
     {
-        return tail_->data;
+        return Value(sentinel_.prev);
     }
 
     template <typename T>
     typename list<T>::iterator list<T>::begin() noexcept
     {
-        return ListIterator(this, head_);
+        return ListIterator(sentinel_.next);
     }
 
     template <typename T>
     typename list<T>::const_iterator list<T>::cbegin() const noexcept
     {
-        return ListConstIterator(this, head_);
+        return ListConstIterator(sentinel_.next);
     }
 
     template <typename T>
     typename list<T>::iterator list<T>::end() noexcept
     {
-        return ListIterator(this, nullptr);
+        return ListIterator(Sentinel());
     }
 
     template <typename T>
     typename list<T>::const_iterator list<T>::cend() const noexcept
     {
-        return ListConstIterator(this, nullptr);
+        return ListConstIterator(Sentinel());
     }
 
     template <typename T>
@@ -239,26 +247,9 @@ namespace s21
     typename list<T>::iterator list<T>::insert(iterator pos,
                                                const_reference value)
     {
-        if (size_ == 0)
-        {
-            push_back(value);
-            return begin();
-        }
-
         Node *inserted = new Node(value);
-        pos.InsertBefore(inserted);
-
-        if (pos == begin())
-        {
-            head_ = inserted;
-        }
-        else if (pos == end())
-        {
-            tail_ = inserted;
-        }
-
-        ++size_;
-        return ListIterator(this, inserted);
+        LinkBefore(pos.current_, inserted, inserted, 1);
+        return ListIterator(inserted);
     }
 
     template <typename T>
@@ -270,37 +261,27 @@ namespace s21
     template <typename T>
     void list<T>::push_back(const_reference value)
     {
-        Node *node = new Node(tail_, nullptr, value);
-        if (empty())
-        {
-            head_ = node;
-        }
-        tail_ = node;
-        ++size_;
+        Node *node = new Node(value);
+        LinkBefore(Sentinel(), node, node, 1);
     }
 
     template <typename T>
     void list<T>::pop_back()
     {
-        Erase(tail_);
+        Erase(sentinel_.prev);
     }
 
     template <typename T>
     void list<T>::push_front(const_reference value)
     {
-        Node *node = new Node(nullptr, head_, value);
-        if (empty())
-        {
-            tail_ = node;
-        }
-        head_ = node;
-        ++size_;
+        Node *node = new Node(value);
+        LinkBefore(sentinel_.next, node, node, 1);
     }
 
     template <typename T>
     void list<T>::pop_front()
     {
-        Erase(head_);
+        Erase(sentinel_.next);
     }
 
     template <typename T>
@@ -317,43 +298,92 @@ namespace s21
             return;
         }
 
-        auto iter = begin();
+        NodeBase *current = sentinel_.next;
 
-        while (other.size() > 0)
+        while (!other.empty() && current != Sentinel())
         {
-            if (iter == end() || *iter > other.front())
+            NodeBase *candidate = other.sentinel_.next;
+            if (Value(current) > Value(candidate))
             {
-                auto node = other.Extract(other.head_);
-                iter = Insert(iter, node);
+                other.Unlink(candidate, candidate, 1);
+                LinkBefore(current, candidate, candidate, 1);
             }
             else
             {
-                ++iter;
+                current = current->next;
             }
         }
+
+        splice(cend(), other);
     }
 
     template <typename T>
     void list<T>::splice(const_iterator pos, list &other)
     {
-        auto iter = ListIterator(this, pos.current_);
-        while (other.size() > 0)
+        if (this == &other || other.empty())
+        {
+            return;
+        }
+
+        size_type count = other.size_;
+        NodeBase *first = other.sentinel_.next;
+        NodeBase *last = other.sentinel_.prev;
+
+        other.Unlink(first, last, count);
+        LinkBefore(pos.current_, first, last, count);
+    }
+
+    template <typename T>
+    void list<T>::splice(const_iterator pos, list &other, const_iterator it)
+    {
+        NodeBase *node = it.current_;
+        if (pos.current_ == node || pos.current_ == node->next)
+        {
+            return;
+        }
+
+        size_type count = (this == &other) ? 0 : 1;
+        other.Unlink(node, node, count);
+        LinkBefore(pos.current_, node, node, count);
+    }
+
+    template <typename T>
+    void list<T>::splice(const_iterator pos, list &other, const_iterator first,
+                         const_iterator last)
+    {
+        if (first == last)
+        {
+            return;
+        }
+
+        NodeBase *first_node = first.current_;
+        NodeBase *last_node = last.current_->prev;
+
+        // Relinking is constant time, only the size bookkeeping of a
+        // transfer between two different lists walks the range.
+        size_type count = 0;
+        if (this != &other)
         {
-            auto node = other.Extract(other.head_);
-            Insert(iter, node);
+            for (NodeBase *node = first_node; node != last.current_;
+                 node = node->next)
+            {
+                ++count;
+            }
         }
+
+        other.Unlink(first_node, last_node, count);
+        LinkBefore(pos.current_, first_node, last_node, count);
     }
 
     template <typename T>
     void list<T>::reverse()
     {
-        Node *current = head_;
-        while (current != nullptr)
+        NodeBase *current = Sentinel();
+        do
         {
             std::swap(current->prev, current->next);
             current = current->prev;
-        }
-        std::swap(head_, tail_);
+        } while (current != Sentinel());
     }
 
     template <typename T>
@@ -364,17 +394,12 @@ namespace s21
             return;
         }
 
-        auto iter = begin();
-        ++iter;
-
-        for (; iter != end(); ++iter)
+        NodeBase *current = sentinel_.next->next;
+        for (; current != Sentinel(); current = current->next)
         {
-            iterator prev(iter);
-            --prev;
-
-            if (*iter == *prev)
+            if (Value(current) == Value(current->prev))
             {
-                Erase(prev.current_);
+                Erase(current->prev);
             }
         }
     }
@@ -400,7 +425,7 @@ namespace s21
     typename list<T>::iterator list<T>::insert_many(const_iterator pos,
                                                     Args &&...args)
     {
-        auto iter = ListIterator(this, pos.current_);
+        auto iter = ListIterator(pos.current_);
 
         if constexpr (sizeof...(args) > 0)
         {
@@ -429,92 +454,101 @@ namespace s21
     }
 
     template <typename T>
-    void list<T>::DestroyAllNodes()
+    void list<T>::save(std::ostream &os) const
     {
-        Node *current = head_;
-        Node *next = nullptr;
+        serial::write_sequence(os, serial_kind::kList, cbegin(), cend(), size_);
+    }
 
-        while (current != nullptr)
-        {
-            next = current->next;
-            delete current;
-            current = next;
-        }
+    template <typename T>
+    void list<T>::load(std::istream &is)
+    {
+        list loaded;
+        serial::read_sequence<value_type>(
+            is, serial_kind::kList,
+            [&loaded](value_type &&item) { loaded.push_back(item); });
+        swap(loaded);
+    }
 
-        head_ = nullptr;
-        tail_ = nullptr;
-        size_ = 0;
+    template <typename T>
+    typename list<T>::NodeBase *list<T>::Sentinel() const noexcept
+    {
+        return const_cast<NodeBase *>(&sentinel_);
     }
 
     template <typename T>
-    typename list<T>::Node *list<T>::Extract(iterator pos)
+    void list<T>::InitSentinel() noexcept
     {
-        return Extract(pos.current_);
+        sentinel_.prev = &sentinel_;
+        sentinel_.next = &sentinel_;
     }
 
     template <typename T>
-    typename list<T>::Node *list<T>::Extract(Node *node)
+    void list<T>::TakeNodes(list &other) noexcept
     {
-        if (node == head_)
+        if (other.empty())
         {
-            head_ = head_->next;
+            return;
         }
 
-        if (node == tail_)
-        {
-            tail_ = tail_->prev;
-        }
+        sentinel_.next = other.sentinel_.next;
+        sentinel_.prev = other.sentinel_.prev;
+        sentinel_.next->prev = &sentinel_;
+        sentinel_.prev->next = &sentinel_;
+        size_ = other.size_;
 
-        if (node->prev != nullptr)
-        {
-            node->prev->next = node->next;
-        }
+        other.InitSentinel();
+        other.size_ = 0;
+    }
 
-        if (node->next != nullptr)
+    template <typename T>
+    void list<T>::DestroyAllNodes()
+    {
+        NodeBase *current = sentinel_.next;
+
+        while (current != Sentinel())
         {
-            node->next->prev = node->prev;
+            NodeBase *next = current->next;
+            delete static_cast<Node *>(current);
+            current = next;
         }
 
-        node->prev = nullptr;
-        node->next = nullptr;
-
-        --size_;
-
-        return node;
+        InitSentinel();
+        size_ = 0;
     }
 
     template <typename T>
-    void list<T>::Erase(Node *node)
+    void list<T>::Erase(NodeBase *node)
     {
-        Node *erased = Extract(node);
-
-        delete erased;
+        Unlink(node, node, 1);
+        delete static_cast<Node *>(node);
     }
 
     template <typename T>
-    typename list<T>::iterator list<T>::Insert(iterator pos, Node *node)
+    void list<T>::Unlink(NodeBase *first, NodeBase *last,
+                         size_type count) noexcept
     {
-        if (size_ == 0)
-        {
-            head_ = node;
-            tail_ = node;
-            ++size_;
-            return begin();
-        }
+        first->prev->next = last->next;
+        last->next->prev = first->prev;
+        size_ -= count;
+    }
 
-        pos.InsertBefore(node);
+    template <typename T>
+    void list<T>::LinkBefore(NodeBase *pos, NodeBase *first, NodeBase *last,
+                             size_type count) noexcept
+    {
+        NodeBase *before = pos->prev;
 
-        if (pos == begin())
-        {
-            head_ = node;
-        }
-        else if (pos == end())
-        {
-            tail_ = node;
-        }
+        first->prev = before;
+        last->next = pos;
+        before->next = first;
+        pos->prev = last;
+        size_ += count;
+    }
 
-        ++size_;
-        return ListIterator(this, node);
+    template <typename T>
+    typename list<T>::const_reference list<T>::Value(NodeBase *node) noexcept
+    {
+        return static_cast<Node *>(node)->data;
     }
 
     template <typename T>
@@ -523,26 +557,19 @@ namespace s21
         list<T> second_part;
         if (size_ > 1)
         {
-            Node *fast = head_;
-            Node *slow = head_;
-
-            size_type new_size = 1;
-
-            while (fast->next != nullptr && fast->next->next != nullptr)
+            size_type new_size = (size_ + 1) / 2;
+            NodeBase *middle = sentinel_.next;
+            for (size_type i = 1; i < new_size; ++i)
             {
-                fast = fast->next->next;
-                slow = slow->next;
-                ++new_size;
+                middle = middle->next;
             }
-            second_part.tail_ = tail_;
-            tail_ = slow;
-            second_part.head_ = slow->next;
 
-            second_part.head_->prev = nullptr;
-            slow->next = nullptr;
+            size_type count = size_ - new_size;
+            NodeBase *first = middle->next;
+            NodeBase *last = sentinel_.prev;
 
-            second_part.size_ = size_ - new_size;
-            size_ = new_size;
+            Unlink(first, last, count);
+            second_part.LinkBefore(second_part.Sentinel(), first, last, count);
         }
         return second_part;
     }
@@ -569,26 +596,23 @@ namespace s21
         bool operator!=(const ListIterator &li) const noexcept;
 
     private:
-        ListIterator(const list<T> *l, Node *cur) noexcept;
+        explicit ListIterator(NodeBase *cur) noexcept;
 
-        void InsertBefore(Node *node);
-
-        Node *current_;
-        const list<T> *list_;
+        NodeBase *current_;
     };
 
     template <typename T>
     list<T>::ListIterator::ListIterator(const ListIterator &li) noexcept
-        : current_(li.current_), list_(li.list_) {}
+        : current_(li.current_) {}
 
     template <typename T>
-    list<T>::ListIterator::ListIterator(const list<T> *l, Node *cur) noexcept
-        : current_(cur), list_(l) {}
+    list<T>::ListIterator::ListIterator(NodeBase *cur) noexcept
+        : current_(cur) {}
 
     template <typename T>
     typename list<T>::reference list<T>::ListIterator::operator*()
     {
-        return current_->data;
+        return static_cast<Node *>(current_)->data;
     }
 
     template <typename T>
@@ -609,14 +633,7 @@ namespace s21
     template <typename T>
     typename list<T>::ListIterator &list<T>::ListIterator::operator--()
     {
-        if (current_ != nullptr)
-        {
-            current_ = current_->prev;
-        }
-        else
-        {
-            current_ = list_->tail_;
-        }
+        current_ = current_->prev;
         return *this;
     }
 
@@ -631,28 +648,13 @@ namespace s21
     template <typename T>
     bool list<T>::ListIterator::operator==(const ListIterator &li) const noexcept
     {
-        return current_ == li.current_ &&
-               (current_ != nullptr || list_->tail_ == li.list_->tail_);
+        return current_ == li.current_;
     }
 
     template <typename T>
     bool list<T>::ListIterator::operator!=(const ListIterator &li) const noexcept
     {
-        return current_ != li.current_ ||
-               (current_ == nullptr && list_->tail_ != li.list_->tail_);
-    }
-
-    template <typename T>
-    void list<T>::ListIterator::InsertBefore(Node *node)
-    {
-        if (current_ != nullptr)
-        {
-            node->InsertBetween(current_->prev, current_);
-        }
-        else
-        {
-            node->InsertBetween(list_->tail_, current_);
-        }
+        return current_ != li.current_;
     }
 
     template <typename T>
@@ -682,49 +684,18 @@ namespace s21
     }
 
     template <typename T>
-    class list<T>::Node
+    class list<T>::Node : public list<T>::NodeBase
     {
     public:
         value_type data;
-        Node *prev;
-        Node *next;
 
-        Node() noexcept;
-        Node(value_type data) noexcept;
-        Node(Node *prev, Node *next, value_type data) noexcept;
-
-        void InsertBetween(Node *prev, Node *next) noexcept;
+        explicit Node(const_reference data);
     };
 
     template <typename T>
-    list<T>::Node::Node() noexcept : next(nullptr), prev(nullptr) {}
-
-    template <typename T>
-    list<T>::Node::Node(value_type data) noexcept
-        : data(data), prev(nullptr), next(nullptr) {}
-
-    template <typename T>
-    list<T>::Node::Node(Node *prev, Node *next, value_type data) noexcept
-        : data(data), prev(prev), next(next)
-    {
-        InsertBetween(prev, next);
-    }
-
-    template <typename T>
-    void list<T>::Node::InsertBetween(Node *prev, Node *next) noexcept
-    {
-        this->prev = prev;
-        this->next = next;
-        if (prev != nullptr)
-        {
-            prev->next = this;
-        }
-        if (next != nullptr)
-        {
-            next->prev = this;
-        }
-    }
+    list<T>::Node::Node(const_reference data)
+        : NodeBase{nullptr, nullptr}, data(data) {}
 
 } // namespace s21
 
-#endif // SRC_CONTAINERS_S21_LIST_H_
\ No newline at end of file
+#endif // SRC_CONTAINERS_S21_LIST_H_
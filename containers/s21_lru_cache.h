@@ -0,0 +1,636 @@
+#ifndef SRC_CONTAINERS_S21_LRU_CACHE_H_
+#define SRC_CONTAINERS_S21_LRU_CACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "s21_intrusive_list.h"
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Which entry a full cache gives up.
+    //   kLru:   the least recently used; every hit relinks the entry.
+    //   kClock: second chance over insertion order; a hit only sets a bit,
+    //           and new entries go in just behind the hand.
+    //   kSieve: like kClock, but new entries go to the head and the hand
+    //           keeps its place, so one-hit wonders leave sooner.
+    enum class eviction_policy
+    {
+        kLru,
+        kClock,
+        kSieve
+    };
+
+    // Default weigher: capacity counts entries.
+    struct unit_weight
+    {
+        template <typename Key, typename T>
+        size_t operator()(const Key &, const T &) const noexcept
+        {
+            return 1;
+        }
+    };
+
+    // Bounded cache with O(1) get, put and eviction. Each entry is one
+    // allocation holding its key, value, hash chain link and an intrusive
+    // recency hook; the index is a chained hash table that doubles when it
+    // holds more entries than buckets. Capacity is in units of Weigh, which
+    // maps (key, value) to a weight, e.g. a byte size; an entry heavier
+    // than the whole capacity is not cached.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+              typename Weigh = unit_weight>
+    class lru_cache
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using size_type = size_t;
+        using hasher = Hash;
+        using weigher = Weigh;
+        // Runs for entries evicted to make room, not for erase(), clear()
+        // or values replaced by put(). It may move the value out.
+        using eviction_callback = std::function<void(const key_type &, mapped_type &)>;
+
+        explicit lru_cache(size_type capacity,
+                           eviction_policy policy = eviction_policy::kLru,
+                           const Weigh &weigh = Weigh());
+        lru_cache(const lru_cache &other) = delete;
+        // A moved-from cache is empty, with the same capacity and policy.
+        lru_cache(lru_cache &&other);
+        ~lru_cache();
+
+        lru_cache &operator=(const lru_cache &other) = delete;
+        lru_cache &operator=(lru_cache &&other);
+
+        // Lookup. get() counts as a use; peek() and contains() do not.
+        // Pointers stay valid until the entry is replaced or leaves.
+        mapped_type *get(const key_type &key);
+        const mapped_type *peek(const key_type &key) const;
+        bool contains(const key_type &key) const;
+
+        // Modifiers. put() inserts or replaces, evicting as needed.
+        void put(const key_type &key, const mapped_type &value);
+        bool erase(const key_type &key);
+        void clear() noexcept;
+        void set_eviction_callback(eviction_callback callback);
+
+        // Capacity
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        size_type weight() const noexcept { return weight_; }
+        size_type capacity() const noexcept { return capacity_; }
+        // Shrinking evicts down to the new capacity.
+        void set_capacity(size_type capacity);
+        eviction_policy policy() const noexcept { return policy_; }
+
+        void swap(lru_cache &other) noexcept;
+
+    private:
+        struct Entry
+        {
+            Entry(const key_type &k, const mapped_type &v) : key(k), value(v) {}
+
+            intrusive_list_hook order;
+            Entry *chain = nullptr;
+            size_t hash = 0;
+            size_type weight = 0;
+            bool visited = false;
+            key_type key;
+            mapped_type value;
+        };
+
+        using Order = intrusive_list<Entry, &Entry::order>;
+
+        static constexpr size_type kInitialBuckets = 16;
+
+        // Front is the newest (kLru: most recently used) end; the hand
+        // sweeps from the back towards the front.
+        Order order_;
+        Entry *hand_;
+        vector<Entry *> buckets_;
+        // 64 - log2(bucket count): BucketOf keeps the top bits.
+        unsigned shift_;
+        size_type size_;
+        size_type weight_;
+        size_type capacity_;
+        eviction_policy policy_;
+        Hash hash_;
+        Weigh weigh_;
+        eviction_callback on_evict_;
+
+        size_t HashOf(const key_type &key) const;
+        size_type BucketOf(size_t hash) const noexcept;
+        Entry *Find(const key_type &key, size_t hash) const;
+        void Link(std::unique_ptr<Entry> owned) noexcept;
+        void Detach(Entry *entry) noexcept;
+        Entry *TowardFront(Entry *entry) noexcept;
+        Entry *PickVictim() noexcept;
+        std::unique_ptr<Entry> Evict();
+        void Rehash(size_type buckets);
+    };
+
+    // lru_cache split over a power-of-two number of shards, each behind its
+    // own mutex, for use from several threads. Every shard holds
+    // capacity / shards of the weight. Lookups return copies: a pointer
+    // would outlive the lock that protects it. The eviction callback runs
+    // under the lock of the evicting shard and must not touch this cache.
+    template <typename Key, typename T, typename Hash = std::hash<Key>,
+              typename Weigh = unit_weight>
+    class sharded_lru_cache
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using size_type = size_t;
+        using cache_type = lru_cache<Key, T, Hash, Weigh>;
+        using eviction_callback = typename cache_type::eviction_callback;
+
+        explicit sharded_lru_cache(size_type capacity,
+                                   eviction_policy policy = eviction_policy::kLru,
+                                   size_type shards = 16, const Weigh &weigh = Weigh());
+        sharded_lru_cache(const sharded_lru_cache &other) = delete;
+        ~sharded_lru_cache() = default;
+
+        sharded_lru_cache &operator=(const sharded_lru_cache &other) = delete;
+
+        std::optional<mapped_type> get(const key_type &key);
+        bool contains(const key_type &key) const;
+        void put(const key_type &key, const mapped_type &value);
+        bool erase(const key_type &key);
+        void clear();
+        void set_eviction_callback(const eviction_callback &callback);
+
+        // Approximate while writers run.
+        size_type size() const;
+        size_type weight() const;
+        size_type shard_count() const noexcept { return count_; }
+
+    private:
+        struct alignas(64) Shard
+        {
+            mutable std::mutex mutex;
+            cache_type cache{0};
+        };
+
+        std::unique_ptr<Shard[]> shards_;
+        size_type count_;
+        Hash hash_;
+
+        Shard &ShardFor(const key_type &key) const;
+    };
+
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    lru_cache<Key, T, Hash, Weigh>::lru_cache(size_type capacity, eviction_policy policy,
+                                              const Weigh &weigh)
+        : order_(),
+          hand_(nullptr),
+          buckets_(kInitialBuckets),
+          shift_(60),
+          size_(0),
+          weight_(0),
+          capacity_(capacity),
+          policy_(policy),
+          hash_(),
+          weigh_(weigh),
+          on_evict_() {}
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    lru_cache<Key, T, Hash, Weigh>::lru_cache(lru_cache &&other)
+        : lru_cache(other.capacity_, other.policy_, other.weigh_)
+    {
+        swap(other);
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    lru_cache<Key, T, Hash, Weigh>::~lru_cache()
+    {
+        clear();
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    lru_cache<Key, T, Hash, Weigh> &lru_cache<Key, T, Hash, Weigh>::operator=(
+        lru_cache &&other)
+    {
+        lru_cache moved(std::move(other));
+        swap(moved);
+        return *this;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    T *lru_cache<Key, T, Hash, Weigh>::get(const key_type &key)
+    {
+        Entry *entry = Find(key, HashOf(key));
+        if (entry == nullptr)
+        {
+            return nullptr;
+        }
+        if (policy_ == eviction_policy::kLru)
+        {
+            if (&order_.front() != entry)
+            {
+                order_.push_front(*entry);
+            }
+        }
+        else
+        {
+            entry->visited = true;
+        }
+        return &entry->value;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    const T *lru_cache<Key, T, Hash, Weigh>::peek(const key_type &key) const
+    {
+        Entry *entry = Find(key, HashOf(key));
+        return entry == nullptr ? nullptr : &entry->value;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    bool lru_cache<Key, T, Hash, Weigh>::contains(const key_type &key) const
+    {
+        return Find(key, HashOf(key)) != nullptr;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void lru_cache<Key, T, Hash, Weigh>::put(const key_type &key, const mapped_type &value)
+    {
+        size_t hash = HashOf(key);
+        size_type weight = weigh_(key, value);
+        // The buckets grow before anything is unlinked, so a failed rehash
+        // leaves the cache, and any old value for the key, untouched.
+        if (size_ >= buckets_.size())
+        {
+            Rehash(buckets_.size() * 2);
+        }
+        // A replaced or evicted entry is reused for the new one, so a full
+        // cache in steady state does not allocate.
+        std::unique_ptr<Entry> spare;
+        if (Entry *old = Find(key, hash))
+        {
+            Detach(old);
+            spare.reset(old);
+        }
+        if (weight > capacity_)
+        {
+            return;
+        }
+        while (weight_ + weight > capacity_)
+        {
+            spare = Evict();
+        }
+        if (spare)
+        {
+            spare->key = key;
+            spare->value = value;
+        }
+        else
+        {
+            spare.reset(new Entry(key, value));
+        }
+        spare->hash = hash;
+        spare->weight = weight;
+        spare->visited = false;
+        Link(std::move(spare));
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    bool lru_cache<Key, T, Hash, Weigh>::erase(const key_type &key)
+    {
+        Entry *entry = Find(key, HashOf(key));
+        if (entry == nullptr)
+        {
+            return false;
+        }
+        Detach(entry);
+        delete entry;
+        return true;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void lru_cache<Key, T, Hash, Weigh>::clear() noexcept
+    {
+        while (!order_.empty())
+        {
+            Entry *entry = &order_.front();
+            order_.pop_front();
+            delete entry;
+        }
+        for (size_type i = 0; i < buckets_.size(); ++i)
+        {
+            buckets_[i] = nullptr;
+        }
+        hand_ = nullptr;
+        size_ = 0;
+        weight_ = 0;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void lru_cache<Key, T, Hash, Weigh>::set_eviction_callback(eviction_callback callback)
+    {
+        on_evict_ = std::move(callback);
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void lru_cache<Key, T, Hash, Weigh>::set_capacity(size_type capacity)
+    {
+        capacity_ = capacity;
+        while (weight_ > capacity_)
+        {
+            Evict();
+        }
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void lru_cache<Key, T, Hash, Weigh>::swap(lru_cache &other) noexcept
+    {
+        order_.swap(other.order_);
+        std::swap(hand_, other.hand_);
+        std::swap(buckets_, other.buckets_);
+        std::swap(shift_, other.shift_);
+        std::swap(size_, other.size_);
+        std::swap(weight_, other.weight_);
+        std::swap(capacity_, other.capacity_);
+        std::swap(policy_, other.policy_);
+        std::swap(hash_, other.hash_);
+        std::swap(weigh_, other.weigh_);
+        std::swap(on_evict_, other.on_evict_);
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    size_t lru_cache<Key, T, Hash, Weigh>::HashOf(const key_type &key) const
+    {
+        return static_cast<size_t>(hash_(key));
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    typename lru_cache<Key, T, Hash, Weigh>::size_type
+    lru_cache<Key, T, Hash, Weigh>::BucketOf(size_t hash) const noexcept
+    {
+        // Fibonacci hashing, as in concurrent_map: the top bits of the
+        // product spread identity hashes of integers.
+        return static_cast<size_type>((static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ull) >> shift_);
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    typename lru_cache<Key, T, Hash, Weigh>::Entry *
+    lru_cache<Key, T, Hash, Weigh>::Find(const key_type &key, size_t hash) const
+    {
+        Entry *entry = buckets_.cbegin()[BucketOf(hash)];
+        while (entry != nullptr && (entry->hash != hash || !(entry->key == key)))
+        {
+            entry = entry->chain;
+        }
+        return entry;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void lru_cache<Key, T, Hash, Weigh>::Link(std::unique_ptr<Entry> owned) noexcept
+    {
+        Entry *entry = owned.release();
+        Entry *&bucket = buckets_[BucketOf(entry->hash)];
+        entry->chain = bucket;
+        bucket = entry;
+
+        if (policy_ == eviction_policy::kClock && hand_ != nullptr)
+        {
+            // Just behind the hand, so the sweep reaches it last.
+            auto behind = Order::iterator_to(*hand_);
+            order_.insert(++behind, *entry);
+        }
+        else
+        {
+            order_.push_front(*entry);
+        }
+        if (policy_ == eviction_policy::kClock && hand_ == nullptr)
+        {
+            hand_ = entry;
+        }
+        ++size_;
+        weight_ += entry->weight;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void lru_cache<Key, T, Hash, Weigh>::Detach(Entry *entry) noexcept
+    {
+        Entry **link = &buckets_[BucketOf(entry->hash)];
+        while (*link != entry)
+        {
+            link = &(*link)->chain;
+        }
+        *link = entry->chain;
+
+        if (hand_ == entry)
+        {
+            hand_ = TowardFront(entry);
+        }
+        entry->order.unlink();
+        --size_;
+        weight_ -= entry->weight;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    typename lru_cache<Key, T, Hash, Weigh>::Entry *
+    lru_cache<Key, T, Hash, Weigh>::TowardFront(Entry *entry) noexcept
+    {
+        // The next entry the hand visits after `entry`. SIEVE restarts
+        // from the back (null) after the front; CLOCK wraps round to it.
+        auto iter = Order::iterator_to(*entry);
+        if (iter != order_.begin())
+        {
+            return &*--iter;
+        }
+        if (policy_ == eviction_policy::kClock && &order_.back() != entry)
+        {
+            return &order_.back();
+        }
+        return nullptr;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    typename lru_cache<Key, T, Hash, Weigh>::Entry *
+    lru_cache<Key, T, Hash, Weigh>::PickVictim() noexcept
+    {
+        if (policy_ == eviction_policy::kLru)
+        {
+            return &order_.back();
+        }
+        Entry *entry = hand_ != nullptr ? hand_ : &order_.back();
+        // Terminates: every visited entry passed is cleared, so a full
+        // round finds one.
+        while (entry->visited)
+        {
+            entry->visited = false;
+            entry = TowardFront(entry);
+            if (entry == nullptr)
+            {
+                entry = &order_.back();
+            }
+        }
+        return entry;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    std::unique_ptr<typename lru_cache<Key, T, Hash, Weigh>::Entry>
+    lru_cache<Key, T, Hash, Weigh>::Evict()
+    {
+        Entry *victim = PickVictim();
+        if (policy_ != eviction_policy::kLru)
+        {
+            // Detach moves the hand on past the victim.
+            hand_ = victim;
+        }
+        Detach(victim);
+        std::unique_ptr<Entry> owned(victim);
+        if (on_evict_)
+        {
+            on_evict_(owned->key, owned->value);
+        }
+        return owned;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void lru_cache<Key, T, Hash, Weigh>::Rehash(size_type buckets)
+    {
+        vector<Entry *> grown(buckets);
+        unsigned shift = shift_;
+        for (size_type count = buckets_.size(); count < buckets; count *= 2)
+        {
+            --shift;
+        }
+        std::swap(shift_, shift);
+        for (size_type i = 0; i < buckets_.size(); ++i)
+        {
+            Entry *entry = buckets_[i];
+            while (entry != nullptr)
+            {
+                Entry *next = entry->chain;
+                Entry *&bucket = grown[BucketOf(entry->hash)];
+                entry->chain = bucket;
+                bucket = entry;
+                entry = next;
+            }
+        }
+        buckets_.swap(grown);
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    sharded_lru_cache<Key, T, Hash, Weigh>::sharded_lru_cache(size_type capacity,
+                                                              eviction_policy policy,
+                                                              size_type shards,
+                                                              const Weigh &weigh)
+        : count_(1), hash_()
+    {
+        while (count_ < shards)
+        {
+            count_ *= 2;
+        }
+        shards_.reset(new Shard[count_]);
+        size_type per_shard = (capacity + count_ - 1) / count_;
+        for (size_type i = 0; i < count_; ++i)
+        {
+            shards_[i].cache = cache_type(per_shard, policy, weigh);
+        }
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    std::optional<T> sharded_lru_cache<Key, T, Hash, Weigh>::get(const key_type &key)
+    {
+        Shard &shard = ShardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        mapped_type *value = shard.cache.get(key);
+        if (value == nullptr)
+        {
+            return std::nullopt;
+        }
+        return *value;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    bool sharded_lru_cache<Key, T, Hash, Weigh>::contains(const key_type &key) const
+    {
+        Shard &shard = ShardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.contains(key);
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void sharded_lru_cache<Key, T, Hash, Weigh>::put(const key_type &key, const mapped_type &value)
+    {
+        Shard &shard = ShardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, value);
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    bool sharded_lru_cache<Key, T, Hash, Weigh>::erase(const key_type &key)
+    {
+        Shard &shard = ShardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.erase(key);
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void sharded_lru_cache<Key, T, Hash, Weigh>::clear()
+    {
+        for (size_type i = 0; i < count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            shards_[i].cache.clear();
+        }
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    void sharded_lru_cache<Key, T, Hash, Weigh>::set_eviction_callback(
+        const eviction_callback &callback)
+    {
+        for (size_type i = 0; i < count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            shards_[i].cache.set_eviction_callback(callback);
+        }
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    typename sharded_lru_cache<Key, T, Hash, Weigh>::size_type
+    sharded_lru_cache<Key, T, Hash, Weigh>::size() const
+    {
+        size_type total = 0;
+        for (size_type i = 0; i < count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            total += shards_[i].cache.size();
+        }
+        return total;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    typename sharded_lru_cache<Key, T, Hash, Weigh>::size_type
+    sharded_lru_cache<Key, T, Hash, Weigh>::weight() const
+    {
+        size_type total = 0;
+        for (size_type i = 0; i < count_; ++i)
+        {
+            std::lock_guard<std::mutex> lock(shards_[i].mutex);
+            total += shards_[i].cache.weight();
+        }
+        return total;
+    }
+
+    template <typename Key, typename T, typename Hash, typename Weigh>
+    typename sharded_lru_cache<Key, T, Hash, Weigh>::Shard &
+    sharded_lru_cache<Key, T, Hash, Weigh>::ShardFor(const key_type &key) const
+    {
+        // Middle bits of the product: each shard's cache indexes its
+        // buckets by the top bits, which must not be constant per shard.
+        uint64_t mixed = static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+        return shards_[static_cast<size_type>(mixed >> 24) & (count_ - 1)];
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_LRU_CACHE_H_
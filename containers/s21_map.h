@@ -35,6 +35,17 @@ namespace s21
             return (*tmp).second;
         }
 
+        const mapped_type &at(const key_type &key) const
+        {
+            const_iterator tmp = this->find(key);
+            if (tmp == this->cend())
+            {
+                throw std::out_of_range(
+                    "Container does not have an element with the specified key");
+            }
+            return (*tmp).second;
+        }
+
         mapped_type &operator[](const key_type &key)
         {
             iterator tmp = this->find(key);
@@ -85,6 +96,16 @@ namespace s21
             return result;
         }
 
+        void save(std::ostream &os) const
+        {
+            this->SaveTree(os, serial_kind::kMap);
+        }
+
+        void load(std::istream &is)
+        {
+            this->LoadTree(is, serial_kind::kMap, true);
+        }
+
     private:
         using Base::lower_bound;
         using Base::upper_bound;
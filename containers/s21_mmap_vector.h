@@ -0,0 +1,542 @@
+#ifndef SRC_CONTAINERS_S21_MMAP_VECTOR_H_
+#define SRC_CONTAINERS_S21_MMAP_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+namespace s21
+{
+    enum class mmap_mode
+    {
+        read_only,
+        read_write
+    };
+
+    // A vector of trivially copyable elements that lives in a file mapped
+    // with MAP_SHARED. Opening maps the file instead of reading it, so it
+    // costs the same for any size. The file holds a 64-byte header and then
+    // the elements in native byte order; its length is the capacity.
+    // Read-only vectors are mapped PROT_READ and refuse modifications.
+    template <typename T>
+    class mmap_vector
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "mmap_vector stores raw bytes of its elements");
+        static_assert(alignof(T) <= 64, "elements must fit header alignment");
+
+    public:
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = T *;
+        using const_iterator = const T *;
+        using size_type = size_t;
+
+        explicit mmap_vector(const char *path,
+                             mmap_mode mode = mmap_mode::read_write);
+        mmap_vector(const mmap_vector &v) = delete;
+        mmap_vector(mmap_vector &&v) noexcept;
+        ~mmap_vector();
+
+        mmap_vector &operator=(const mmap_vector &v) = delete;
+        mmap_vector &operator=(mmap_vector &&v) noexcept;
+
+        // Element access
+        reference at(size_type pos);
+        const_reference at(size_type pos) const;
+        reference operator[](size_type pos);
+        const_reference operator[](size_type pos) const;
+        const_reference front() const;
+        const_reference back() const;
+        T *data() noexcept;
+        const T *data() const noexcept;
+
+        // Iterators
+        iterator begin() noexcept;
+        iterator end() noexcept;
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Capacity
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+        size_type max_size() const noexcept;
+        size_type capacity() const noexcept;
+        bool read_only() const noexcept;
+        void reserve(size_type size);
+        void shrink_to_fit();
+
+        // Modifiers
+        void clear();
+        void push_back(const_reference value);
+        void pop_back();
+        template <typename... Args>
+        void insert_many_back(Args &&...args);
+        void append(const_iterator first, const_iterator last);
+
+        // Flushes dirty pages to the file; waits for the writes to finish
+        // unless `wait` is false.
+        void sync(bool wait = true);
+
+    private:
+        struct Header
+        {
+            char magic[8];
+            uint32_t version;
+            uint32_t value_size;
+            uint64_t size;
+            uint64_t reserved[5];
+        };
+
+        static constexpr char kMagic[8] = {'S', '2', '1', 'M', 'V', 'E', 'C', '\0'};
+        static constexpr uint32_t kVersion = 1;
+        static constexpr size_type kHeaderSize = sizeof(Header);
+
+        int fd_;
+        bool read_only_;
+        char *base_;
+        size_type mapped_;
+
+        Header *header() const noexcept;
+        void requireWritable() const;
+        void growFor(size_type incoming);
+        void resizeFile(size_type capacity);
+        void release() noexcept;
+        [[noreturn]] void fail(const char *what);
+    };
+
+
+    template <typename T>
+    mmap_vector<T>::mmap_vector(const char *path, mmap_mode mode)
+        : fd_(-1),
+          read_only_(mode == mmap_mode::read_only),
+          base_(nullptr),
+          mapped_(0)
+    {
+        fd_ = read_only_ ? open(path, O_RDONLY | O_CLOEXEC)
+                         : open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+        if (fd_ < 0)
+        {
+            fail("mmap_vector: cannot open file");
+        }
+
+        struct stat info;
+        if (fstat(fd_, &info) != 0)
+        {
+            fail("mmap_vector: cannot stat file");
+        }
+        bool created = info.st_size == 0 && !read_only_;
+        if (created && ftruncate(fd_, kHeaderSize) != 0)
+        {
+            fail("mmap_vector: cannot size file");
+        }
+        size_type length = created ? kHeaderSize
+                                   : static_cast<size_type>(info.st_size);
+        if (length < kHeaderSize)
+        {
+            release();
+            throw std::invalid_argument("mmap_vector: file is too short");
+        }
+
+        int prot = read_only_ ? PROT_READ : PROT_READ | PROT_WRITE;
+        void *base = mmap(nullptr, length, prot, MAP_SHARED, fd_, 0);
+        if (base == MAP_FAILED)
+        {
+            fail("mmap_vector: cannot map file");
+        }
+        base_ = static_cast<char *>(base);
+        mapped_ = length;
+
+        if (created)
+        {
+            std::memcpy(header()->magic, kMagic, sizeof(kMagic));
+            header()->version = kVersion;
+            header()->value_size = sizeof(value_type);
+            header()->size = 0;
+        }
+        else if (std::memcmp(header()->magic, kMagic, sizeof(kMagic)) != 0 ||
+                 header()->version != kVersion ||
+                 header()->value_size != sizeof(value_type) ||
+                 (length - kHeaderSize) % sizeof(value_type) != 0 ||
+                 header()->size > capacity())
+        {
+            release();
+            throw std::invalid_argument("mmap_vector: not a matching file");
+        }
+    }
+
+    template <typename T>
+    mmap_vector<T>::mmap_vector(mmap_vector &&v) noexcept
+        : fd_(v.fd_), read_only_(v.read_only_), base_(v.base_),
+          mapped_(v.mapped_)
+    {
+        v.fd_ = -1;
+        v.base_ = nullptr;
+        v.mapped_ = 0;
+    }
+
+    template <typename T>
+    mmap_vector<T>::~mmap_vector()
+    {
+        release();
+    }
+
+    template <typename T>
+    mmap_vector<T> &mmap_vector<T>::operator=(mmap_vector &&v) noexcept
+    {
+        if (this != &v)
+        {
+            release();
+            fd_ = v.fd_;
+            read_only_ = v.read_only_;
+            base_ = v.base_;
+            mapped_ = v.mapped_;
+
+            v.fd_ = -1;
+            v.base_ = nullptr;
+            v.mapped_ = 0;
+        }
+        return *this;
+    }
+
+    // Element access
+    template <typename T>
+    typename mmap_vector<T>::reference mmap_vector<T>::at(size_type pos)
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range("accessing mmap_vector element out of range");
+        }
+        return data()[pos];
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::const_reference mmap_vector<T>::at(
+        size_type pos) const
+    {
+        if (pos >= size())
+        {
+            throw std::out_of_range("accessing mmap_vector element out of range");
+        }
+        return data()[pos];
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::reference mmap_vector<T>::operator[](
+        size_type pos)
+    {
+        return data()[pos];
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::const_reference mmap_vector<T>::operator[](
+        size_type pos) const
+    {
+        return data()[pos];
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::const_reference mmap_vector<T>::front() const
+    {
+        return data()[0];
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::const_reference mmap_vector<T>::back() const
+    {
+        return data()[size() - 1];
+    }
+
+    template <typename T>
+    T *mmap_vector<T>::data() noexcept
+    {
+        return base_ ? reinterpret_cast<T *>(base_ + kHeaderSize) : nullptr;
+    }
+
+    template <typename T>
+    const T *mmap_vector<T>::data() const noexcept
+    {
+        return base_ ? reinterpret_cast<const T *>(base_ + kHeaderSize)
+                     : nullptr;
+    }
+
+    // Iterators
+    template <typename T>
+    typename mmap_vector<T>::iterator mmap_vector<T>::begin() noexcept
+    {
+        return data();
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::iterator mmap_vector<T>::end() noexcept
+    {
+        return data() + size();
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::const_iterator mmap_vector<T>::begin()
+        const noexcept
+    {
+        return data();
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::const_iterator mmap_vector<T>::end()
+        const noexcept
+    {
+        return data() + size();
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::const_iterator mmap_vector<T>::cbegin()
+        const noexcept
+    {
+        return data();
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::const_iterator mmap_vector<T>::cend()
+        const noexcept
+    {
+        return data() + size();
+    }
+
+    // Capacity
+    template <typename T>
+    bool mmap_vector<T>::empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::size_type mmap_vector<T>::size() const noexcept
+    {
+        return base_ ? static_cast<size_type>(header()->size) : 0;
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::size_type mmap_vector<T>::max_size()
+        const noexcept
+    {
+        return (SIZE_MAX - kHeaderSize) / sizeof(value_type);
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::size_type mmap_vector<T>::capacity()
+        const noexcept
+    {
+        return base_ ? (mapped_ - kHeaderSize) / sizeof(value_type) : 0;
+    }
+
+    template <typename T>
+    bool mmap_vector<T>::read_only() const noexcept
+    {
+        return read_only_;
+    }
+
+    template <typename T>
+    void mmap_vector<T>::reserve(size_type size)
+    {
+        requireWritable();
+        if (size > capacity())
+        {
+            resizeFile(size);
+        }
+    }
+
+    template <typename T>
+    void mmap_vector<T>::shrink_to_fit()
+    {
+        requireWritable();
+        if (size() < capacity())
+        {
+            resizeFile(size());
+        }
+    }
+
+    // Modifiers
+    template <typename T>
+    void mmap_vector<T>::clear()
+    {
+        requireWritable();
+        header()->size = 0;
+    }
+
+    template <typename T>
+    void mmap_vector<T>::push_back(const_reference value)
+    {
+        requireWritable();
+        value_type item = value;
+        growFor(1);
+        data()[size()] = item;
+        ++header()->size;
+    }
+
+    template <typename T>
+    void mmap_vector<T>::pop_back()
+    {
+        requireWritable();
+        --header()->size;
+    }
+
+    template <typename T>
+    template <typename... Args>
+    void mmap_vector<T>::insert_many_back(Args &&...args)
+    {
+        if constexpr (sizeof...(args) > 0)
+        {
+            value_type items[] = {value_type(std::forward<Args>(args))...};
+            append(items, items + sizeof...(args));
+        }
+    }
+
+    template <typename T>
+    void mmap_vector<T>::append(const_iterator first, const_iterator last)
+    {
+        requireWritable();
+        size_type amount = static_cast<size_type>(last - first);
+        if (amount == 0)
+        {
+            return;
+        }
+        if (first >= cbegin() && first < cend())
+        {
+            // Appending our own elements: keep their offset across a remap.
+            size_type offset = static_cast<size_type>(first - cbegin());
+            growFor(amount);
+            first = cbegin() + offset;
+        }
+        else
+        {
+            growFor(amount);
+        }
+        std::memcpy(static_cast<void *>(end()), first,
+                    amount * sizeof(value_type));
+        header()->size += amount;
+    }
+
+    template <typename T>
+    void mmap_vector<T>::sync(bool wait)
+    {
+        if (read_only_)
+        {
+            return;
+        }
+        if (msync(base_, mapped_, wait ? MS_SYNC : MS_ASYNC) != 0)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                                    "mmap_vector: cannot sync file");
+        }
+    }
+
+    template <typename T>
+    typename mmap_vector<T>::Header *mmap_vector<T>::header() const noexcept
+    {
+        return reinterpret_cast<Header *>(base_);
+    }
+
+    template <typename T>
+    void mmap_vector<T>::requireWritable() const
+    {
+        if (read_only_)
+        {
+            throw std::invalid_argument("mmap_vector is opened read-only");
+        }
+    }
+
+    template <typename T>
+    void mmap_vector<T>::growFor(size_type incoming)
+    {
+        size_type required = size() + incoming;
+        if (required <= capacity())
+        {
+            return;
+        }
+        size_type grown = capacity() < 8 ? 8 : capacity() * 2;
+        resizeFile(grown < required ? required : grown);
+    }
+
+    template <typename T>
+    void mmap_vector<T>::resizeFile(size_type capacity)
+    {
+        // The file grows before the mapping does and shrinks after it, so
+        // the mapping never covers bytes past the end of the file.
+        size_type length = kHeaderSize + capacity * sizeof(value_type);
+        if (length > mapped_ && ftruncate(fd_, static_cast<off_t>(length)) != 0)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                                    "mmap_vector: cannot grow file");
+        }
+
+#ifdef MREMAP_MAYMOVE
+        void *base = mremap(base_, mapped_, length, MREMAP_MAYMOVE);
+#else
+        // No mremap outside Linux: map the resized file afresh. If that
+        // fails, the old length is mapped back so the vector stays usable.
+        munmap(base_, mapped_);
+        void *base = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_SHARED,
+                          fd_, 0);
+        if (base == MAP_FAILED)
+        {
+            int error = errno;
+            void *old = mmap(nullptr, mapped_, PROT_READ | PROT_WRITE,
+                             MAP_SHARED, fd_, 0);
+            base_ = old == MAP_FAILED ? nullptr : static_cast<char *>(old);
+            mapped_ = old == MAP_FAILED ? 0 : mapped_;
+            errno = error;
+        }
+#endif
+        if (base == MAP_FAILED)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                                    "mmap_vector: cannot remap file");
+        }
+        bool shrunk = length < mapped_;
+        base_ = static_cast<char *>(base);
+        mapped_ = length;
+
+        if (shrunk && ftruncate(fd_, static_cast<off_t>(length)) != 0)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                                    "mmap_vector: cannot shrink file");
+        }
+    }
+
+    template <typename T>
+    void mmap_vector<T>::release() noexcept
+    {
+        if (base_ != nullptr)
+        {
+            munmap(base_, mapped_);
+            base_ = nullptr;
+            mapped_ = 0;
+        }
+        if (fd_ >= 0)
+        {
+            close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    template <typename T>
+    void mmap_vector<T>::fail(const char *what)
+    {
+        int error = errno;
+        release();
+        throw std::system_error(error, std::generic_category(), what);
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_MMAP_VECTOR_H_
@@ -44,9 +44,9 @@ namespace s21
 
         const_iterator end() const noexcept { return iterator(Base::end()); }
 
-        iterator find(const Key &key) noexcept
+        iterator find(const Key &key) const noexcept
         {
-            iterator it = this->lower_bound(key);
+            iterator it(this->lower_bound(key));
             if (it == end() || *it != key)
             {
                 return end();
@@ -63,7 +63,7 @@ namespace s21
 
         void merge(multiset &other) noexcept { Base::merge(other); }
 
-        size_type count(const key_type &key) noexcept
+        size_type count(const key_type &key) const noexcept
         {
             size_t res = 0;
             auto lb = this->lower_bound(key);
@@ -90,6 +90,16 @@ namespace s21
             (result.push_back({insert(std::forward<value_type>(args)), true}), ...);
             return result;
         }
+
+        void save(std::ostream &os) const
+        {
+            this->SaveTree(os, serial_kind::kMultiset);
+        }
+
+        void load(std::istream &is)
+        {
+            this->LoadTree(is, serial_kind::kMultiset, false);
+        }
     };
 
 } // namespace s21
@@ -0,0 +1,295 @@
+#ifndef SRC_CONTAINERS_S21_PARALLEL_H_
+#define SRC_CONTAINERS_S21_PARALLEL_H_
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+
+#include "s21_thread_pool.h"
+
+namespace s21
+{
+    namespace execution
+    {
+        // Runs on the calling thread, like the plain std:: algorithm.
+        struct sequenced_policy
+        {
+        };
+
+        // Splits the range into chunks of `grain` elements and runs them on
+        // `pool` (the global pool when null). A grain of 0 picks about four
+        // chunks per thread; set it higher when per-element work is tiny.
+        struct parallel_policy
+        {
+            thread_pool *pool = nullptr;
+            size_t grain = 0;
+
+            constexpr parallel_policy on(thread_pool &target) const noexcept
+            {
+                return parallel_policy{&target, grain};
+            }
+
+            constexpr parallel_policy with_grain(size_t elements) const noexcept
+            {
+                return parallel_policy{pool, elements};
+            }
+        };
+
+        inline constexpr sequenced_policy seq{};
+        inline constexpr parallel_policy par{};
+    } // namespace execution
+
+    // Random-access ranges only, e.g. s21::vector and s21::array iterators.
+    // Parallel forms require op to be associative (reduce, inclusive_scan)
+    // and f to be safe to call concurrently on different elements.
+    template <typename RandomIt, typename F>
+    void for_each(const execution::sequenced_policy &policy, RandomIt first, RandomIt last, F f);
+    template <typename RandomIt, typename F>
+    void for_each(const execution::parallel_policy &policy, RandomIt first, RandomIt last, F f);
+
+    template <typename RandomIt, typename OutputIt, typename F>
+    OutputIt transform(const execution::sequenced_policy &policy, RandomIt first, RandomIt last, OutputIt out, F f);
+    template <typename RandomIt, typename OutputIt, typename F>
+    OutputIt transform(const execution::parallel_policy &policy, RandomIt first, RandomIt last, OutputIt out, F f);
+
+    template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+    T reduce(const execution::sequenced_policy &policy, RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp());
+    template <typename RandomIt, typename T, typename BinaryOp = std::plus<>>
+    T reduce(const execution::parallel_policy &policy, RandomIt first, RandomIt last, T init, BinaryOp op = BinaryOp());
+
+    template <typename RandomIt, typename Compare = std::less<>>
+    void sort(const execution::sequenced_policy &policy, RandomIt first, RandomIt last, Compare comp = Compare());
+    template <typename RandomIt, typename Compare = std::less<>>
+    void sort(const execution::parallel_policy &policy, RandomIt first, RandomIt last, Compare comp = Compare());
+
+    // out may equal first.
+    template <typename RandomIt, typename OutputIt, typename BinaryOp = std::plus<>>
+    OutputIt inclusive_scan(const execution::sequenced_policy &policy, RandomIt first, RandomIt last, OutputIt out,
+                            BinaryOp op = BinaryOp());
+    template <typename RandomIt, typename OutputIt, typename BinaryOp = std::plus<>>
+    OutputIt inclusive_scan(const execution::parallel_policy &policy, RandomIt first, RandomIt last, OutputIt out,
+                            BinaryOp op = BinaryOp());
+
+    namespace execution
+    {
+        // Calls chunk(index, begin, end) for consecutive slices of [0, n) on
+        // the policy's pool; the caller runs the last slice itself. Returns
+        // the number of slices.
+        template <typename Chunk>
+        size_t ForEachChunk(const parallel_policy &policy, size_t n, Chunk chunk);
+        size_t ChunkCount(const parallel_policy &policy, size_t n);
+    } // namespace execution
+
+
+    inline size_t execution::ChunkCount(const parallel_policy &policy, size_t n)
+    {
+        if (n == 0)
+        {
+            return 0;
+        }
+        thread_pool &pool = policy.pool != nullptr ? *policy.pool : thread_pool::global();
+        size_t grain = policy.grain;
+        if (grain == 0)
+        {
+            size_t target = 4 * (pool.size() + 1);
+            grain = n / target + (n % target != 0);
+        }
+        return n / grain + (n % grain != 0);
+    }
+
+    template <typename Chunk>
+    size_t execution::ForEachChunk(const parallel_policy &policy, size_t n, Chunk chunk)
+    {
+        size_t chunks = ChunkCount(policy, n);
+        if (chunks <= 1)
+        {
+            if (chunks == 1)
+            {
+                chunk(size_t(0), size_t(0), n);
+            }
+            return chunks;
+        }
+        size_t size = n / chunks;
+        size_t extra = n % chunks;
+        // Chunk i starts after i full slices plus one element for each of
+        // the first `extra` slices, which are one longer.
+        auto bound = [size, extra](size_t i) { return i * size + std::min(i, extra); };
+        task_group group(policy.pool != nullptr ? *policy.pool : thread_pool::global());
+        for (size_t i = 0; i + 1 < chunks; ++i)
+        {
+            group.run([&chunk, &bound, i] { chunk(i, bound(i), bound(i + 1)); });
+        }
+        try
+        {
+            chunk(chunks - 1, bound(chunks - 1), n);
+        }
+        catch (...)
+        {
+            group.wait();
+            throw;
+        }
+        group.wait();
+        return chunks;
+    }
+
+    template <typename RandomIt, typename F>
+    void for_each(const execution::sequenced_policy &, RandomIt first, RandomIt last, F f)
+    {
+        std::for_each(first, last, f);
+    }
+
+    template <typename RandomIt, typename F>
+    void for_each(const execution::parallel_policy &policy, RandomIt first, RandomIt last, F f)
+    {
+        execution::ForEachChunk(policy, static_cast<size_t>(last - first), [&](size_t, size_t begin, size_t end) {
+            std::for_each(first + begin, first + end, f);
+        });
+    }
+
+    template <typename RandomIt, typename OutputIt, typename F>
+    OutputIt transform(const execution::sequenced_policy &, RandomIt first, RandomIt last, OutputIt out, F f)
+    {
+        return std::transform(first, last, out, f);
+    }
+
+    template <typename RandomIt, typename OutputIt, typename F>
+    OutputIt transform(const execution::parallel_policy &policy, RandomIt first, RandomIt last, OutputIt out, F f)
+    {
+        size_t n = static_cast<size_t>(last - first);
+        execution::ForEachChunk(policy, n, [&](size_t, size_t begin, size_t end) {
+            std::transform(first + begin, first + end, out + begin, f);
+        });
+        return out + n;
+    }
+
+    template <typename RandomIt, typename T, typename BinaryOp>
+    T reduce(const execution::sequenced_policy &, RandomIt first, RandomIt last, T init, BinaryOp op)
+    {
+        for (; first != last; ++first)
+        {
+            init = op(std::move(init), *first);
+        }
+        return init;
+    }
+
+    template <typename RandomIt, typename T, typename BinaryOp>
+    T reduce(const execution::parallel_policy &policy, RandomIt first, RandomIt last, T init, BinaryOp op)
+    {
+        size_t n = static_cast<size_t>(last - first);
+        size_t chunks = execution::ChunkCount(policy, n);
+        if (chunks == 0)
+        {
+            return init;
+        }
+        // Each chunk folds from its own first element, so init is applied
+        // exactly once and T needs no identity value.
+        std::vector<T> partials(chunks, T(*first));
+        execution::ForEachChunk(policy, n, [&](size_t index, size_t begin, size_t end) {
+            T sum = T(first[begin]);
+            for (size_t i = begin + 1; i < end; ++i)
+            {
+                sum = op(std::move(sum), first[i]);
+            }
+            partials[index] = std::move(sum);
+        });
+        for (T &partial : partials)
+        {
+            init = op(std::move(init), std::move(partial));
+        }
+        return init;
+    }
+
+    template <typename RandomIt, typename Compare>
+    void sort(const execution::sequenced_policy &, RandomIt first, RandomIt last, Compare comp)
+    {
+        std::sort(first, last, comp);
+    }
+
+    template <typename RandomIt, typename Compare>
+    void sort(const execution::parallel_policy &policy, RandomIt first, RandomIt last, Compare comp)
+    {
+        // Sort chunks independently, then merge neighbours in parallel
+        // rounds, doubling the run length each round.
+        size_t n = static_cast<size_t>(last - first);
+        std::vector<size_t> bounds;
+        execution::ForEachChunk(policy, n, [&](size_t, size_t begin, size_t end) {
+            std::sort(first + begin, first + end, comp);
+        });
+        size_t chunks = execution::ChunkCount(policy, n);
+        for (size_t i = 0; i < chunks; ++i)
+        {
+            bounds.push_back(i * (n / chunks) + std::min(i, n % chunks));
+        }
+        bounds.push_back(n);
+        for (size_t width = 1; width < chunks; width *= 2)
+        {
+            size_t pairs = (chunks + 2 * width - 1) / (2 * width);
+            execution::parallel_policy round = policy.with_grain(1);
+            execution::ForEachChunk(round, pairs, [&](size_t, size_t begin, size_t end) {
+                for (size_t pair = begin; pair < end; ++pair)
+                {
+                    size_t left = pair * 2 * width;
+                    size_t middle = std::min(left + width, chunks);
+                    size_t right = std::min(left + 2 * width, chunks);
+                    std::inplace_merge(first + bounds[left], first + bounds[middle], first + bounds[right], comp);
+                }
+            });
+        }
+    }
+
+    template <typename RandomIt, typename OutputIt, typename BinaryOp>
+    OutputIt inclusive_scan(const execution::sequenced_policy &, RandomIt first, RandomIt last, OutputIt out,
+                            BinaryOp op)
+    {
+        if (first == last)
+        {
+            return out;
+        }
+        auto sum = *first;
+        *out = sum;
+        while (++first != last)
+        {
+            sum = op(std::move(sum), *first);
+            *++out = sum;
+        }
+        return ++out;
+    }
+
+    template <typename RandomIt, typename OutputIt, typename BinaryOp>
+    OutputIt inclusive_scan(const execution::parallel_policy &policy, RandomIt first, RandomIt last, OutputIt out,
+                            BinaryOp op)
+    {
+        // Scan each chunk locally, fold the chunk totals into offsets,
+        // then add each chunk's offset to its outputs.
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        size_t n = static_cast<size_t>(last - first);
+        size_t chunks = execution::ChunkCount(policy, n);
+        if (chunks <= 1)
+        {
+            return s21::inclusive_scan(execution::seq, first, last, out, op);
+        }
+        std::vector<value_type> totals(chunks, value_type(*first));
+        execution::ForEachChunk(policy, n, [&](size_t index, size_t begin, size_t end) {
+            s21::inclusive_scan(execution::seq, first + begin, first + end, out + begin, op);
+            totals[index] = out[end - 1];
+        });
+        for (size_t i = 1; i + 1 < chunks; ++i)
+        {
+            totals[i] = op(totals[i - 1], totals[i]);
+        }
+        execution::ForEachChunk(policy, n, [&](size_t index, size_t begin, size_t end) {
+            if (index == 0)
+            {
+                return;
+            }
+            for (size_t i = begin; i < end; ++i)
+            {
+                out[i] = op(totals[index - 1], out[i]);
+            }
+        });
+        return out + n;
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_PARALLEL_H_
@@ -0,0 +1,482 @@
+#ifndef SRC_CONTAINERS_S21_PERSISTENT_MAP_H_
+#define SRC_CONTAINERS_S21_PERSISTENT_MAP_H_
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_map.h"
+#include "s21_persistent_tree.h"
+
+namespace s21
+{
+    // Immutable ordered map with structural sharing. Copies are O(1) and
+    // never change; insert, insert_or_assign and erase return a new map
+    // that copies only the O(log n) nodes on the changed path and shares
+    // the rest. The tree is a left-leaning red-black tree with RBTree's
+    // colours (see PersistentTree), and nodes are reference counted, so a
+    // version frees what only it uses when it dies. Versions may be shared
+    // between threads.
+    //
+    // For batches, transient() gives a mutable map that edits nodes in
+    // place whenever it holds the only reference to them (the count is 1),
+    // and persistent() freezes it again in O(1).
+    template <typename Key, typename T>
+    class persistent_map
+    {
+        struct Counting;
+        using Tree = PersistentTree<std::pair<Key, T>, std::atomic<size_t>,
+                                    Counting>;
+        using Node = typename Tree::Node;
+
+    public:
+        class transient_type;
+
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<key_type, mapped_type>;
+        using reference = const value_type &;
+        using const_reference = const value_type &;
+        using iterator = typename Tree::iterator;
+        using const_iterator = typename Tree::iterator;
+        using size_type = size_t;
+
+        persistent_map() noexcept;
+        persistent_map(std::initializer_list<value_type> const &items);
+        explicit persistent_map(const map<key_type, mapped_type> &items);
+        persistent_map(const persistent_map &other) noexcept;
+        persistent_map(persistent_map &&other) noexcept;
+        ~persistent_map();
+
+        persistent_map &operator=(persistent_map other) noexcept;
+
+        // Iterators stay valid while any copy of this version lives.
+        const_iterator begin() const;
+        const_iterator end() const noexcept;
+
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+
+        const mapped_type &at(const key_type &key) const;
+        const_iterator find(const key_type &key) const;
+        bool contains(const key_type &key) const noexcept;
+        const_iterator lower_bound(const key_type &key) const;
+        const_iterator upper_bound(const key_type &key) const;
+
+        // New versions; *this is left as it was. Unchanged results share
+        // the whole tree.
+        persistent_map insert(const value_type &value) const;
+        persistent_map insert(const key_type &key, const mapped_type &obj) const;
+        persistent_map insert_or_assign(const key_type &key, const mapped_type &obj) const;
+        persistent_map erase(const key_type &key) const;
+
+        transient_type transient() const noexcept;
+
+        void swap(persistent_map &other) noexcept;
+
+    private:
+        // Ownership for the tree: a node held by one reference, reached
+        // through nodes the edit owns, is changed in place; a shared one is
+        // copied. Each step leaves a valid, fully counted tree behind, so
+        // an exception never leaks; the balance may be off until the edit
+        // finishes.
+        struct Counting
+        {
+            static Node *Make(const value_type &value);
+            static void Own(Node *&node);
+            static void Drop(Node *node) noexcept;
+        };
+
+        Node *root_;
+        size_type size_;
+
+        persistent_map(Node *root, size_type size) noexcept;
+
+        static Node *Retain(Node *node) noexcept;
+        static void Release(Node *node) noexcept;
+        static bool InsertRoot(Node *&root, const value_type &value, bool assign);
+        static bool EraseRoot(Node *&root, const key_type &key);
+
+    public:
+        // Mutable view for batch edits. Move-only; must not be shared
+        // between threads, though the versions it produces may be.
+        class transient_type
+        {
+        public:
+            transient_type() noexcept;
+            transient_type(const transient_type &other) = delete;
+            transient_type(transient_type &&other) noexcept;
+            ~transient_type();
+
+            transient_type &operator=(const transient_type &other) = delete;
+            transient_type &operator=(transient_type &&other) noexcept;
+
+            bool empty() const noexcept;
+            size_type size() const noexcept;
+            const mapped_type &at(const key_type &key) const;
+            bool contains(const key_type &key) const noexcept;
+
+            // As on s21::map. If an edit throws, the transient is left empty.
+            bool insert(const key_type &key, const mapped_type &obj);
+            bool insert_or_assign(const key_type &key, const mapped_type &obj);
+            bool erase(const key_type &key);
+
+            // Snapshot of the current contents; further edits copy on write.
+            persistent_map persistent() const noexcept;
+
+        private:
+            friend class persistent_map;
+
+            transient_type(Node *root, size_type size) noexcept;
+
+            template <typename Edit>
+            bool Apply(Edit edit);
+
+            Node *root_;
+            size_type size_;
+        };
+
+    };
+
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::persistent_map() noexcept : root_(nullptr), size_(0) {}
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::persistent_map(std::initializer_list<value_type> const &items) : persistent_map()
+    {
+        transient_type edit;
+        for (const value_type &item : items)
+        {
+            edit.insert(item.first, item.second);
+        }
+        *this = edit.persistent();
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::persistent_map(const map<key_type, mapped_type> &items) : persistent_map()
+    {
+        transient_type edit;
+        for (auto iter = items.cbegin(); iter != items.cend(); ++iter)
+        {
+            edit.insert((*iter).first, (*iter).second);
+        }
+        *this = edit.persistent();
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::persistent_map(const persistent_map &other) noexcept
+        : root_(Retain(other.root_)),
+          size_(other.size_) {}
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::persistent_map(persistent_map &&other) noexcept : root_(other.root_), size_(other.size_)
+    {
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::persistent_map(Node *root, size_type size) noexcept : root_(root), size_(size) {}
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::~persistent_map()
+    {
+        Release(root_);
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T> &persistent_map<Key, T>::operator=(persistent_map other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::const_iterator persistent_map<Key, T>::begin() const
+    {
+        return Tree::begin(root_);
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::const_iterator persistent_map<Key, T>::end() const noexcept
+    {
+        return const_iterator();
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::size_type persistent_map<Key, T>::size() const noexcept
+    {
+        return size_;
+    }
+
+    template <typename Key, typename T>
+    const T &persistent_map<Key, T>::at(const key_type &key) const
+    {
+        const Node *node = Tree::lookup(root_, key);
+        if (node == nullptr)
+        {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return node->data.second;
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::const_iterator persistent_map<Key, T>::find(const key_type &key) const
+    {
+        return Tree::find(root_, key);
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::contains(const key_type &key) const noexcept
+    {
+        return Tree::lookup(root_, key) != nullptr;
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::const_iterator persistent_map<Key, T>::lower_bound(const key_type &key) const
+    {
+        return Tree::lower_bound(root_, key);
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::const_iterator persistent_map<Key, T>::upper_bound(const key_type &key) const
+    {
+        return Tree::upper_bound(root_, key);
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T> persistent_map<Key, T>::insert(const value_type &value) const
+    {
+        if (contains(value.first))
+        {
+            return *this;
+        }
+        persistent_map result(*this);
+        result.size_ += InsertRoot(result.root_, value, false);
+        return result;
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T> persistent_map<Key, T>::insert(const key_type &key, const mapped_type &obj) const
+    {
+        return insert(value_type(key, obj));
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T> persistent_map<Key, T>::insert_or_assign(const key_type &key, const mapped_type &obj) const
+    {
+        persistent_map result(*this);
+        result.size_ += InsertRoot(result.root_, value_type(key, obj), true);
+        return result;
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T> persistent_map<Key, T>::erase(const key_type &key) const
+    {
+        persistent_map result(*this);
+        result.size_ -= EraseRoot(result.root_, key);
+        return result;
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::transient_type persistent_map<Key, T>::transient() const noexcept
+    {
+        return transient_type(Retain(root_), size_);
+    }
+
+    template <typename Key, typename T>
+    void persistent_map<Key, T>::swap(persistent_map &other) noexcept
+    {
+        std::swap(root_, other.root_);
+        std::swap(size_, other.size_);
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::Node *persistent_map<Key, T>::Retain(Node *node) noexcept
+    {
+        if (node != nullptr)
+        {
+            node->mark.fetch_add(1, std::memory_order_relaxed);
+        }
+        return node;
+    }
+
+    template <typename Key, typename T>
+    void persistent_map<Key, T>::Release(Node *node) noexcept
+    {
+        // Loops down the left spine so only right subtrees recurse.
+        while (node != nullptr && node->mark.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            Node *left = node->left;
+            Release(node->right);
+            delete node;
+            node = left;
+        }
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::InsertRoot(Node *&root, const value_type &value, bool assign)
+    {
+        Counting counting;
+        return Tree(counting).insert(root, value, assign);
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::EraseRoot(Node *&root, const key_type &key)
+    {
+        Counting counting;
+        return Tree(counting).erase(root, key);
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::Node *persistent_map<Key, T>::Counting::Make(const value_type &value)
+    {
+        return new Node{value, nullptr, nullptr, Color::kRed, 1};
+    }
+
+    template <typename Key, typename T>
+    void persistent_map<Key, T>::Counting::Own(Node *&node)
+    {
+        // The only reference, reached through nodes we own: nobody else
+        // can see it, so edit in place. Otherwise copy it for this path.
+        if (node->mark.load(std::memory_order_acquire) == 1)
+        {
+            return;
+        }
+        Node *copy = new Node{node->data, node->left, node->right, node->color, 1};
+        Retain(copy->left);
+        Retain(copy->right);
+        Release(node);
+        node = copy;
+    }
+
+    template <typename Key, typename T>
+    void persistent_map<Key, T>::Counting::Drop(Node *node) noexcept
+    {
+        Release(node);
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::transient_type::transient_type() noexcept : root_(nullptr), size_(0) {}
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::transient_type::transient_type(Node *root, size_type size) noexcept
+        : root_(root),
+          size_(size) {}
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::transient_type::transient_type(transient_type &&other) noexcept
+        : root_(other.root_),
+          size_(other.size_)
+    {
+        other.root_ = nullptr;
+        other.size_ = 0;
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T>::transient_type::~transient_type()
+    {
+        Release(root_);
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::transient_type &persistent_map<Key, T>::transient_type::operator=(
+        transient_type &&other) noexcept
+    {
+        std::swap(root_, other.root_);
+        std::swap(size_, other.size_);
+        return *this;
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::transient_type::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    template <typename Key, typename T>
+    typename persistent_map<Key, T>::size_type persistent_map<Key, T>::transient_type::size() const noexcept
+    {
+        return size_;
+    }
+
+    template <typename Key, typename T>
+    const T &persistent_map<Key, T>::transient_type::at(const key_type &key) const
+    {
+        const Node *node = Tree::lookup(root_, key);
+        if (node == nullptr)
+        {
+            throw std::out_of_range("Container does not have an element with the specified key");
+        }
+        return node->data.second;
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::transient_type::contains(const key_type &key) const noexcept
+    {
+        return Tree::lookup(root_, key) != nullptr;
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::transient_type::insert(const key_type &key, const mapped_type &obj)
+    {
+        if (contains(key))
+        {
+            return false;
+        }
+        bool inserted = Apply([&key, &obj](Node *&root) { return InsertRoot(root, value_type(key, obj), false); });
+        size_ += inserted;
+        return inserted;
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::transient_type::insert_or_assign(const key_type &key, const mapped_type &obj)
+    {
+        bool inserted = Apply([&key, &obj](Node *&root) { return InsertRoot(root, value_type(key, obj), true); });
+        size_ += inserted;
+        return inserted;
+    }
+
+    template <typename Key, typename T>
+    bool persistent_map<Key, T>::transient_type::erase(const key_type &key)
+    {
+        bool erased = Apply([&key](Node *&root) { return EraseRoot(root, key); });
+        size_ -= erased;
+        return erased;
+    }
+
+    template <typename Key, typename T>
+    persistent_map<Key, T> persistent_map<Key, T>::transient_type::persistent() const noexcept
+    {
+        return persistent_map(Retain(root_), size_);
+    }
+
+    template <typename Key, typename T>
+    template <typename Edit>
+    bool persistent_map<Key, T>::transient_type::Apply(Edit edit)
+    {
+        try
+        {
+            return edit(root_);
+        }
+        catch (...)
+        {
+            // The tree is sound but may be unbalanced; drop it.
+            Release(root_);
+            root_ = nullptr;
+            size_ = 0;
+            throw;
+        }
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_PERSISTENT_MAP_H_
@@ -0,0 +1,479 @@
+#ifndef SRC_CONTAINERS_S21_PERSISTENT_TREE_H_
+#define SRC_CONTAINERS_S21_PERSISTENT_TREE_H_
+
+#include "s21_rbtree.h"
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Path-copying left-leaning red-black tree (Sedgewick 2008, with the
+    // colours of RBTree), the core of persistent_map and rcu_map. An edit
+    // changes only the nodes it owns and replaces the others on its path,
+    // O(log n) per edit, sharing the rest of the tree with older versions.
+    //
+    // Value is a key/value pair; Mark is the per-node state Ownership keys
+    // on. Ownership decides which nodes an edit may change in place:
+    //   Node *Make(const Value &value)  a red leaf owned by the edit;
+    //   void Own(Node *&node)           replaces node with a copy the edit
+    //                                   owns, children and colour included,
+    //                                   unless it is owned already;
+    //   void Drop(Node *node)           node, a leaf, left the tree.
+    template <typename Value, typename Mark, typename Ownership>
+    class PersistentTree
+    {
+    public:
+        class PersistentTreeIterator;
+
+        struct Node
+        {
+            Value data;
+            Node *left;
+            Node *right;
+            Color color;
+            Mark mark;
+        };
+
+        using value_type = Value;
+        using key_type = typename Value::first_type;
+        using iterator = PersistentTreeIterator;
+
+        explicit PersistentTree(Ownership &ownership) noexcept;
+
+        // Edits of the tree in `root`; both return whether the size
+        // changed. insert() keeps an existing value unless `assign` is set.
+        bool insert(Node *&root, const value_type &value, bool assign);
+        bool erase(Node *&root, const key_type &key);
+
+        static const Node *lookup(const Node *root,
+                                  const key_type &key) noexcept;
+        static iterator begin(const Node *root);
+        static iterator find(const Node *root, const key_type &key);
+        static iterator lower_bound(const Node *root, const key_type &key);
+        static iterator upper_bound(const Node *root, const key_type &key);
+
+        // In-order walk without parent pointers: the stack holds the
+        // ancestors still to be visited.
+        class PersistentTreeIterator
+        {
+        public:
+            PersistentTreeIterator() noexcept;
+
+            const value_type &operator*() const noexcept;
+            const value_type *operator->() const noexcept;
+            PersistentTreeIterator &operator++();
+            PersistentTreeIterator operator++(int);
+            bool operator==(const PersistentTreeIterator &other) const noexcept;
+            bool operator!=(const PersistentTreeIterator &other) const noexcept;
+
+        private:
+            friend class PersistentTree;
+
+            void PushLeft(const Node *node);
+
+            const Node *node_;
+            vector<const Node *> path_;
+        };
+
+    private:
+        Ownership &ownership_;
+
+        template <typename Before>
+        static iterator Descend(const Node *root, Before before);
+        static bool IsRed(const Node *node) noexcept;
+
+        void RotateLeft(Node *&node);
+        void RotateRight(Node *&node);
+        void FlipColors(Node *node);
+        void Balance(Node *&node);
+        void MoveRedLeft(Node *&node);
+        void MoveRedRight(Node *&node);
+        bool Insert(Node *&node, const value_type &value, bool assign);
+        void Erase(Node *&node, const key_type &key);
+        void EraseMin(Node *&node);
+    };
+
+
+    template <typename Value, typename Mark, typename Ownership>
+    PersistentTree<Value, Mark, Ownership>::PersistentTree(
+        Ownership &ownership) noexcept
+        : ownership_(ownership) {}
+
+    template <typename Value, typename Mark, typename Ownership>
+    bool PersistentTree<Value, Mark, Ownership>::insert(
+        Node *&root, const value_type &value, bool assign)
+    {
+        bool inserted = Insert(root, value, assign);
+        root->color = Color::kBlack;
+        return inserted;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    bool PersistentTree<Value, Mark, Ownership>::erase(Node *&root,
+                                                      const key_type &key)
+    {
+        if (lookup(root, key) == nullptr)
+        {
+            return false;
+        }
+        ownership_.Own(root);
+        if (!IsRed(root->left) && !IsRed(root->right))
+        {
+            root->color = Color::kRed;
+        }
+        Erase(root, key);
+        if (root != nullptr)
+        {
+            root->color = Color::kBlack;
+        }
+        return true;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    const typename PersistentTree<Value, Mark, Ownership>::Node *
+    PersistentTree<Value, Mark, Ownership>::lookup(const Node *root,
+                                                   const key_type &key) noexcept
+    {
+        const Node *node = root;
+        while (node != nullptr)
+        {
+            if (key < node->data.first)
+            {
+                node = node->left;
+            }
+            else if (node->data.first < key)
+            {
+                node = node->right;
+            }
+            else
+            {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    typename PersistentTree<Value, Mark, Ownership>::iterator
+    PersistentTree<Value, Mark, Ownership>::begin(const Node *root)
+    {
+        return Descend(root, [](const Node *) { return true; });
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    typename PersistentTree<Value, Mark, Ownership>::iterator
+    PersistentTree<Value, Mark, Ownership>::find(const Node *root,
+                                                 const key_type &key)
+    {
+        iterator iter = lower_bound(root, key);
+        if (iter != iterator() && key < iter->first)
+        {
+            return iterator();
+        }
+        return iter;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    typename PersistentTree<Value, Mark, Ownership>::iterator
+    PersistentTree<Value, Mark, Ownership>::lower_bound(const Node *root,
+                                                        const key_type &key)
+    {
+        return Descend(root, [&key](const Node *node) {
+            return !(node->data.first < key);
+        });
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    typename PersistentTree<Value, Mark, Ownership>::iterator
+    PersistentTree<Value, Mark, Ownership>::upper_bound(const Node *root,
+                                                        const key_type &key)
+    {
+        return Descend(root, [&key](const Node *node) {
+            return key < node->data.first;
+        });
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    template <typename Before>
+    typename PersistentTree<Value, Mark, Ownership>::iterator
+    PersistentTree<Value, Mark, Ownership>::Descend(const Node *root,
+                                                    Before before)
+    {
+        // The answer is the last node we turned left at; the other left
+        // turns above it are exactly its in-order successors on the path.
+        iterator iter;
+        const Node *node = root;
+        while (node != nullptr)
+        {
+            if (before(node))
+            {
+                iter.path_.push_back(node);
+                node = node->left;
+            }
+            else
+            {
+                node = node->right;
+            }
+        }
+        if (!iter.path_.empty())
+        {
+            iter.node_ = iter.path_.back();
+            iter.path_.pop_back();
+        }
+        return iter;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    bool PersistentTree<Value, Mark, Ownership>::IsRed(
+        const Node *node) noexcept
+    {
+        return node != nullptr && node->color == Color::kRed;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::RotateLeft(Node *&node)
+    {
+        ownership_.Own(node->right);
+        Node *right = node->right;
+        node->right = right->left;
+        right->left = node;
+        right->color = node->color;
+        node->color = Color::kRed;
+        node = right;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::RotateRight(Node *&node)
+    {
+        ownership_.Own(node->left);
+        Node *left = node->left;
+        node->left = left->right;
+        left->right = node;
+        left->color = node->color;
+        node->color = Color::kRed;
+        node = left;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::FlipColors(Node *node)
+    {
+        auto flip = [](Node *target) {
+            target->color =
+                target->color == Color::kRed ? Color::kBlack : Color::kRed;
+        };
+        ownership_.Own(node->left);
+        ownership_.Own(node->right);
+        flip(node);
+        flip(node->left);
+        flip(node->right);
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::Balance(Node *&node)
+    {
+        if (IsRed(node->right) && !IsRed(node->left))
+        {
+            RotateLeft(node);
+        }
+        if (IsRed(node->left) && IsRed(node->left->left))
+        {
+            RotateRight(node);
+        }
+        if (IsRed(node->left) && IsRed(node->right))
+        {
+            FlipColors(node);
+        }
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::MoveRedLeft(Node *&node)
+    {
+        FlipColors(node);
+        if (IsRed(node->right->left))
+        {
+            RotateRight(node->right);
+            RotateLeft(node);
+            FlipColors(node);
+        }
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::MoveRedRight(Node *&node)
+    {
+        FlipColors(node);
+        if (IsRed(node->left->left))
+        {
+            RotateRight(node);
+            FlipColors(node);
+        }
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    bool PersistentTree<Value, Mark, Ownership>::Insert(
+        Node *&node, const value_type &value, bool assign)
+    {
+        if (node == nullptr)
+        {
+            node = ownership_.Make(value);
+            return true;
+        }
+        ownership_.Own(node);
+        bool inserted = false;
+        if (value.first < node->data.first)
+        {
+            inserted = Insert(node->left, value, assign);
+        }
+        else if (node->data.first < value.first)
+        {
+            inserted = Insert(node->right, value, assign);
+        }
+        else if (assign)
+        {
+            node->data.second = value.second;
+        }
+        Balance(node);
+        return inserted;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::Erase(Node *&node,
+                                                      const key_type &key)
+    {
+        // The key is known to be present.
+        ownership_.Own(node);
+        if (key < node->data.first)
+        {
+            if (!IsRed(node->left) && !IsRed(node->left->left))
+            {
+                MoveRedLeft(node);
+            }
+            Erase(node->left, key);
+        }
+        else
+        {
+            if (IsRed(node->left))
+            {
+                RotateRight(node);
+            }
+            if (!(node->data.first < key) && node->right == nullptr)
+            {
+                ownership_.Drop(node);
+                node = nullptr;
+                return;
+            }
+            if (!IsRed(node->right) && !IsRed(node->right->left))
+            {
+                MoveRedRight(node);
+            }
+            if (!(node->data.first < key))
+            {
+                const Node *successor = node->right;
+                while (successor->left != nullptr)
+                {
+                    successor = successor->left;
+                }
+                node->data = successor->data;
+                EraseMin(node->right);
+            }
+            else
+            {
+                Erase(node->right, key);
+            }
+        }
+        Balance(node);
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::EraseMin(Node *&node)
+    {
+        if (node->left == nullptr)
+        {
+            ownership_.Drop(node);
+            node = nullptr;
+            return;
+        }
+        ownership_.Own(node);
+        if (!IsRed(node->left) && !IsRed(node->left->left))
+        {
+            MoveRedLeft(node);
+        }
+        EraseMin(node->left);
+        Balance(node);
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    PersistentTree<Value, Mark, Ownership>::PersistentTreeIterator::
+        PersistentTreeIterator() noexcept
+        : node_(nullptr) {}
+
+    template <typename Value, typename Mark, typename Ownership>
+    const Value &PersistentTree<Value, Mark, Ownership>::
+        PersistentTreeIterator::operator*() const noexcept
+    {
+        return node_->data;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    const Value *PersistentTree<Value, Mark, Ownership>::
+        PersistentTreeIterator::operator->() const noexcept
+    {
+        return &node_->data;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    typename PersistentTree<Value, Mark, Ownership>::PersistentTreeIterator &
+    PersistentTree<Value, Mark, Ownership>::PersistentTreeIterator::operator++()
+    {
+        if (node_->right != nullptr)
+        {
+            PushLeft(node_->right);
+        }
+        else if (path_.empty())
+        {
+            node_ = nullptr;
+        }
+        else
+        {
+            node_ = path_.back();
+            path_.pop_back();
+        }
+        return *this;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    typename PersistentTree<Value, Mark, Ownership>::PersistentTreeIterator
+    PersistentTree<Value, Mark, Ownership>::PersistentTreeIterator::operator++(
+        int)
+    {
+        PersistentTreeIterator previous(*this);
+        ++*this;
+        return previous;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    bool PersistentTree<Value, Mark, Ownership>::PersistentTreeIterator::
+    operator==(const PersistentTreeIterator &other) const noexcept
+    {
+        return node_ == other.node_;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    bool PersistentTree<Value, Mark, Ownership>::PersistentTreeIterator::
+    operator!=(const PersistentTreeIterator &other) const noexcept
+    {
+        return node_ != other.node_;
+    }
+
+    template <typename Value, typename Mark, typename Ownership>
+    void PersistentTree<Value, Mark, Ownership>::PersistentTreeIterator::
+        PushLeft(const Node *node)
+    {
+        while (node->left != nullptr)
+        {
+            path_.push_back(node);
+            node = node->left;
+        }
+        node_ = node;
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_PERSISTENT_TREE_H_
@@ -0,0 +1,808 @@
+#ifndef SRC_CONTAINERS_S21_PERSISTENT_VECTOR_H_
+#define SRC_CONTAINERS_S21_PERSISTENT_VECTOR_H_
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21
+{
+    // Immutable vector with structural sharing: a 32-way radix trie of
+    // full leaves plus a separate tail leaf (Bagwell's and Clojure's
+    // PersistentVector). Copies are O(1); push_back, pop_back and set
+    // return a new vector that copies one root-to-leaf path, at most
+    // log32(n) nodes, and pushes touch only the tail until it fills.
+    // Nodes are reference counted; versions may be shared between threads.
+    //
+    // transient() gives a mutable vector for batches: it edits in place
+    // every node it holds the only reference to, so a run of push_backs
+    // costs about as much as on s21::vector.
+    template <typename T>
+    class persistent_vector
+    {
+    public:
+        class PersistentVectorIterator;
+        class transient_type;
+
+        using value_type = T;
+        using reference = const T &;
+        using const_reference = const T &;
+        using iterator = PersistentVectorIterator;
+        using const_iterator = PersistentVectorIterator;
+        using size_type = size_t;
+
+        persistent_vector() noexcept;
+        persistent_vector(std::initializer_list<value_type> const &items);
+        persistent_vector(const persistent_vector &other) noexcept;
+        persistent_vector(persistent_vector &&other) noexcept;
+        ~persistent_vector();
+
+        persistent_vector &operator=(persistent_vector other) noexcept;
+
+        // Iterators stay valid while this object lives unchanged.
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+
+        const_reference at(size_type pos) const;
+        const_reference operator[](size_type pos) const noexcept;
+        const_reference front() const noexcept;
+        const_reference back() const noexcept;
+
+        // New versions; *this is left as it was. pop_back() requires a
+        // non-empty vector.
+        persistent_vector push_back(const_reference value) const;
+        persistent_vector pop_back() const;
+        persistent_vector set(size_type pos, const_reference value) const;
+
+        transient_type transient() const noexcept;
+
+        void swap(persistent_vector &other) noexcept;
+
+    private:
+        static constexpr unsigned kBits = 5;
+        static constexpr size_type kWidth = size_type(1) << kBits;
+        static constexpr size_type kMask = kWidth - 1;
+
+        struct Counted
+        {
+            std::atomic<size_t> refs{1};
+        };
+
+        struct Branch : Counted
+        {
+            Counted *children[kWidth] = {};
+        };
+
+        // Leaves in the trie are always full; the tail counts its items.
+        struct Leaf : Counted
+        {
+            union Slots
+            {
+                Slots() {}
+                ~Slots() {}
+                T items[kWidth];
+            };
+
+            size_type count = 0;
+            Slots slots;
+
+            T *items() noexcept;
+            const T *items() const noexcept;
+        };
+
+        // The trie holds elements [0, TailOffset()); the tail holds the
+        // rest. shift_ is the bit offset of the root's index digit.
+        Counted *root_;
+        Leaf *tail_;
+        size_type size_;
+        unsigned shift_;
+
+        size_type TailOffset() const noexcept;
+        Leaf *LeafNodeFor(size_type pos) const noexcept;
+        const T *LeafFor(size_type pos) const noexcept;
+
+        static Counted *Retain(Counted *node) noexcept;
+        static void Release(Counted *node, unsigned shift) noexcept;
+        static void Release(Leaf *leaf) noexcept;
+        static Leaf *CopyLeaf(const Leaf *leaf, size_type count);
+
+        // Edits through slots holding one reference each, so a throw
+        // leaves a fully counted structure that the owner can release.
+        static void OwnLeaf(Leaf *&leaf);
+        static Branch *OwnBranch(Counted *&node, unsigned shift);
+        void Push(const_reference value);
+        void Pop();
+        void Set(size_type pos, const_reference value);
+        void PushTail(Counted *&node, unsigned shift, Leaf *leaf);
+        static Counted *NewPath(unsigned shift, Leaf *leaf);
+        void PopTail(Counted *&node, unsigned shift);
+
+    public:
+        // Mutable view for batch edits. Move-only; must not be shared
+        // between threads, though the versions it produces may be.
+        class transient_type
+        {
+        public:
+            transient_type() noexcept = default;
+            transient_type(const transient_type &other) = delete;
+            transient_type(transient_type &&other) noexcept = default;
+            ~transient_type() = default;
+
+            transient_type &operator=(const transient_type &other) = delete;
+            transient_type &operator=(transient_type &&other) noexcept = default;
+
+            bool empty() const noexcept;
+            size_type size() const noexcept;
+            const_reference operator[](size_type pos) const noexcept;
+
+            // If an edit throws, the transient is left empty.
+            void push_back(const_reference value);
+            void pop_back();
+            void set(size_type pos, const_reference value);
+
+            // Snapshot of the current contents; further edits copy on write.
+            persistent_vector persistent() const noexcept;
+
+        private:
+            friend class persistent_vector;
+
+            explicit transient_type(const persistent_vector &source) noexcept;
+
+            template <typename Edit>
+            void Apply(Edit edit);
+
+            persistent_vector items_;
+        };
+
+        // Caches the current leaf, so walking costs one trie descent per
+        // 32 elements.
+        class PersistentVectorIterator
+        {
+        public:
+            PersistentVectorIterator() noexcept;
+
+            const_reference operator*() const noexcept;
+            const value_type *operator->() const noexcept;
+            PersistentVectorIterator &operator++() noexcept;
+            PersistentVectorIterator operator++(int) noexcept;
+            PersistentVectorIterator &operator--() noexcept;
+            PersistentVectorIterator operator--(int) noexcept;
+            bool operator==(const PersistentVectorIterator &other) const noexcept;
+            bool operator!=(const PersistentVectorIterator &other) const noexcept;
+
+        private:
+            friend class persistent_vector;
+
+            PersistentVectorIterator(const persistent_vector *owner, size_type pos) noexcept;
+            void Sync() noexcept;
+
+            const persistent_vector *owner_;
+            size_type pos_;
+            const T *leaf_;
+        };
+    };
+
+
+    template <typename T>
+    T *persistent_vector<T>::Leaf::items() noexcept
+    {
+        return slots.items;
+    }
+
+    template <typename T>
+    const T *persistent_vector<T>::Leaf::items() const noexcept
+    {
+        return slots.items;
+    }
+
+    template <typename T>
+    persistent_vector<T>::persistent_vector() noexcept : root_(nullptr), tail_(nullptr), size_(0), shift_(kBits) {}
+
+    template <typename T>
+    persistent_vector<T>::persistent_vector(std::initializer_list<value_type> const &items) : persistent_vector()
+    {
+        for (const value_type &item : items)
+        {
+            Push(item);
+        }
+    }
+
+    template <typename T>
+    persistent_vector<T>::persistent_vector(const persistent_vector &other) noexcept
+        : root_(Retain(other.root_)),
+          tail_(static_cast<Leaf *>(Retain(other.tail_))),
+          size_(other.size_),
+          shift_(other.shift_) {}
+
+    template <typename T>
+    persistent_vector<T>::persistent_vector(persistent_vector &&other) noexcept : persistent_vector()
+    {
+        swap(other);
+    }
+
+    template <typename T>
+    persistent_vector<T>::~persistent_vector()
+    {
+        Release(root_, shift_);
+        Release(tail_);
+    }
+
+    template <typename T>
+    persistent_vector<T> &persistent_vector<T>::operator=(persistent_vector other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::const_iterator persistent_vector<T>::begin() const noexcept
+    {
+        return const_iterator(this, 0);
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::const_iterator persistent_vector<T>::end() const noexcept
+    {
+        return const_iterator(this, size_);
+    }
+
+    template <typename T>
+    bool persistent_vector<T>::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::size_type persistent_vector<T>::size() const noexcept
+    {
+        return size_;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::const_reference persistent_vector<T>::at(size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("accessing persistent_vector element out of range");
+        }
+        return (*this)[pos];
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::const_reference persistent_vector<T>::operator[](size_type pos) const noexcept
+    {
+        return LeafFor(pos)[pos & kMask];
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::const_reference persistent_vector<T>::front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::const_reference persistent_vector<T>::back() const noexcept
+    {
+        return (*this)[size_ - 1];
+    }
+
+    template <typename T>
+    persistent_vector<T> persistent_vector<T>::push_back(const_reference value) const
+    {
+        persistent_vector result(*this);
+        result.Push(value);
+        return result;
+    }
+
+    template <typename T>
+    persistent_vector<T> persistent_vector<T>::pop_back() const
+    {
+        persistent_vector result(*this);
+        result.Pop();
+        return result;
+    }
+
+    template <typename T>
+    persistent_vector<T> persistent_vector<T>::set(size_type pos, const_reference value) const
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("accessing persistent_vector element out of range");
+        }
+        persistent_vector result(*this);
+        result.Set(pos, value);
+        return result;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::transient_type persistent_vector<T>::transient() const noexcept
+    {
+        return transient_type(*this);
+    }
+
+    template <typename T>
+    void persistent_vector<T>::swap(persistent_vector &other) noexcept
+    {
+        std::swap(root_, other.root_);
+        std::swap(tail_, other.tail_);
+        std::swap(size_, other.size_);
+        std::swap(shift_, other.shift_);
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::size_type persistent_vector<T>::TailOffset() const noexcept
+    {
+        return size_ < kWidth ? 0 : ((size_ - 1) >> kBits) << kBits;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::Leaf *persistent_vector<T>::LeafNodeFor(size_type pos) const noexcept
+    {
+        if (pos >= TailOffset())
+        {
+            return tail_;
+        }
+        Counted *node = root_;
+        for (unsigned shift = shift_; shift > 0; shift -= kBits)
+        {
+            node = static_cast<Branch *>(node)->children[(pos >> shift) & kMask];
+        }
+        return static_cast<Leaf *>(node);
+    }
+
+    template <typename T>
+    const T *persistent_vector<T>::LeafFor(size_type pos) const noexcept
+    {
+        return LeafNodeFor(pos)->items();
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::Counted *persistent_vector<T>::Retain(Counted *node) noexcept
+    {
+        if (node != nullptr)
+        {
+            node->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+        return node;
+    }
+
+    template <typename T>
+    void persistent_vector<T>::Release(Counted *node, unsigned shift) noexcept
+    {
+        // shift 0 is a leaf; above that, children sit one digit lower.
+        if (shift == 0)
+        {
+            Release(static_cast<Leaf *>(node));
+            return;
+        }
+        if (node == nullptr || node->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return;
+        }
+        Branch *branch = static_cast<Branch *>(node);
+        for (Counted *child : branch->children)
+        {
+            Release(child, shift - kBits);
+        }
+        delete branch;
+    }
+
+    template <typename T>
+    void persistent_vector<T>::Release(Leaf *leaf) noexcept
+    {
+        if (leaf == nullptr || leaf->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+            return;
+        }
+        T *items = leaf->items();
+        for (size_type i = 0; i < leaf->count; ++i)
+        {
+            items[i].~T();
+        }
+        delete leaf;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::Leaf *persistent_vector<T>::CopyLeaf(const Leaf *leaf, size_type count)
+    {
+        Leaf *copy = new Leaf;
+        try
+        {
+            for (; copy->count < count; ++copy->count)
+            {
+                new (copy->items() + copy->count) T(leaf->items()[copy->count]);
+            }
+        }
+        catch (...)
+        {
+            Release(copy);
+            throw;
+        }
+        return copy;
+    }
+
+    template <typename T>
+    void persistent_vector<T>::OwnLeaf(Leaf *&leaf)
+    {
+        // The only reference, reached through nodes we own: edit in place.
+        if (leaf->refs.load(std::memory_order_acquire) == 1)
+        {
+            return;
+        }
+        Leaf *copy = CopyLeaf(leaf, leaf->count);
+        Release(leaf);
+        leaf = copy;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::Branch *persistent_vector<T>::OwnBranch(Counted *&node, unsigned shift)
+    {
+        Branch *branch = static_cast<Branch *>(node);
+        if (branch->refs.load(std::memory_order_acquire) == 1)
+        {
+            return branch;
+        }
+        Branch *copy = new Branch;
+        for (size_type i = 0; i < kWidth; ++i)
+        {
+            copy->children[i] = Retain(branch->children[i]);
+        }
+        Release(branch, shift);
+        node = copy;
+        return copy;
+    }
+
+    template <typename T>
+    void persistent_vector<T>::Push(const_reference value)
+    {
+        size_type in_tail = size_ - TailOffset();
+        if (tail_ != nullptr && in_tail < kWidth)
+        {
+            OwnLeaf(tail_);
+            new (tail_->items() + tail_->count) T(value);
+            ++tail_->count;
+            ++size_;
+            return;
+        }
+        Leaf *fresh = new Leaf;
+        try
+        {
+            new (fresh->items()) T(value);
+        }
+        catch (...)
+        {
+            delete fresh;
+            throw;
+        }
+        fresh->count = 1;
+        if (tail_ == nullptr)
+        {
+            tail_ = fresh;
+            ++size_;
+            return;
+        }
+        // The tail is full: it moves into the trie, growing a level when
+        // the root is full too.
+        try
+        {
+            if (root_ == nullptr)
+            {
+                root_ = new Branch;
+            }
+            if ((size_ >> kBits) > (size_type(1) << shift_))
+            {
+                Branch *grown = new Branch;
+                grown->children[0] = root_;
+                root_ = grown;
+                shift_ += kBits;
+                grown->children[1] = NewPath(shift_ - kBits, tail_);
+            }
+            else
+            {
+                PushTail(root_, shift_, tail_);
+            }
+        }
+        catch (...)
+        {
+            Release(fresh);
+            throw;
+        }
+        tail_ = fresh;
+        ++size_;
+    }
+
+    template <typename T>
+    void persistent_vector<T>::PushTail(Counted *&node, unsigned shift, Leaf *leaf)
+    {
+        // The trie takes over the tail's reference only once it is linked.
+        Branch *branch = OwnBranch(node, shift);
+        size_type index = ((size_ - 1) >> shift) & kMask;
+        if (shift == kBits)
+        {
+            branch->children[index] = leaf;
+        }
+        else if (branch->children[index] != nullptr)
+        {
+            PushTail(branch->children[index], shift - kBits, leaf);
+        }
+        else
+        {
+            branch->children[index] = NewPath(shift - kBits, leaf);
+        }
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::Counted *persistent_vector<T>::NewPath(unsigned shift, Leaf *leaf)
+    {
+        if (shift == 0)
+        {
+            return leaf;
+        }
+        Branch *branch = new Branch;
+        try
+        {
+            branch->children[0] = NewPath(shift - kBits, leaf);
+        }
+        catch (...)
+        {
+            delete branch;
+            throw;
+        }
+        return branch;
+    }
+
+    template <typename T>
+    void persistent_vector<T>::Pop()
+    {
+        if (size_ - TailOffset() > 1)
+        {
+            OwnLeaf(tail_);
+            --tail_->count;
+            tail_->items()[tail_->count].~T();
+            --size_;
+            return;
+        }
+        if (size_ == 1)
+        {
+            Release(tail_);
+            tail_ = nullptr;
+            size_ = 0;
+            return;
+        }
+        // The tail empties: the trie's last leaf becomes the tail.
+        Leaf *last = static_cast<Leaf *>(Retain(LeafNodeFor(size_ - 2)));
+        try
+        {
+            PopTail(root_, shift_);
+        }
+        catch (...)
+        {
+            Release(last);
+            throw;
+        }
+        Release(tail_);
+        tail_ = last;
+        --size_;
+        if (shift_ > kBits && static_cast<Branch *>(root_)->children[1] == nullptr)
+        {
+            Counted *only = Retain(static_cast<Branch *>(root_)->children[0]);
+            Release(root_, shift_);
+            root_ = only;
+            shift_ -= kBits;
+        }
+        else if (size_ <= kWidth && root_ != nullptr)
+        {
+            Release(root_, shift_);
+            root_ = nullptr;
+        }
+    }
+
+    template <typename T>
+    void persistent_vector<T>::PopTail(Counted *&node, unsigned shift)
+    {
+        Branch *branch = OwnBranch(node, shift);
+        size_type index = ((size_ - 2) >> shift) & kMask;
+        if (shift > kBits)
+        {
+            PopTail(branch->children[index], shift - kBits);
+        }
+        else
+        {
+            Release(static_cast<Leaf *>(branch->children[index]));
+            branch->children[index] = nullptr;
+        }
+        if (index == 0 && branch->children[0] == nullptr && shift != shift_)
+        {
+            Release(node, shift);
+            node = nullptr;
+        }
+    }
+
+    template <typename T>
+    void persistent_vector<T>::Set(size_type pos, const_reference value)
+    {
+        if (pos >= TailOffset())
+        {
+            OwnLeaf(tail_);
+            tail_->items()[pos & kMask] = value;
+            return;
+        }
+        Counted **slot = &root_;
+        for (unsigned shift = shift_; shift > 0; shift -= kBits)
+        {
+            Branch *branch = OwnBranch(*slot, shift);
+            slot = &branch->children[(pos >> shift) & kMask];
+        }
+        Leaf *leaf = static_cast<Leaf *>(*slot);
+        OwnLeaf(leaf);
+        *slot = leaf;
+        leaf->items()[pos & kMask] = value;
+    }
+
+    template <typename T>
+    persistent_vector<T>::transient_type::transient_type(const persistent_vector &source) noexcept : items_(source)
+    {
+    }
+
+    template <typename T>
+    bool persistent_vector<T>::transient_type::empty() const noexcept
+    {
+        return items_.empty();
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::size_type persistent_vector<T>::transient_type::size() const noexcept
+    {
+        return items_.size();
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::const_reference persistent_vector<T>::transient_type::operator[](
+        size_type pos) const noexcept
+    {
+        return items_[pos];
+    }
+
+    template <typename T>
+    void persistent_vector<T>::transient_type::push_back(const_reference value)
+    {
+        Apply([&value](persistent_vector &items) { items.Push(value); });
+    }
+
+    template <typename T>
+    void persistent_vector<T>::transient_type::pop_back()
+    {
+        Apply([](persistent_vector &items) { items.Pop(); });
+    }
+
+    template <typename T>
+    void persistent_vector<T>::transient_type::set(size_type pos, const_reference value)
+    {
+        if (pos >= items_.size())
+        {
+            throw std::out_of_range("accessing persistent_vector element out of range");
+        }
+        Apply([pos, &value](persistent_vector &items) { items.Set(pos, value); });
+    }
+
+    template <typename T>
+    persistent_vector<T> persistent_vector<T>::transient_type::persistent() const noexcept
+    {
+        return items_;
+    }
+
+    template <typename T>
+    template <typename Edit>
+    void persistent_vector<T>::transient_type::Apply(Edit edit)
+    {
+        try
+        {
+            edit(items_);
+        }
+        catch (...)
+        {
+            items_ = persistent_vector();
+            throw;
+        }
+    }
+
+    template <typename T>
+    persistent_vector<T>::PersistentVectorIterator::PersistentVectorIterator() noexcept
+        : owner_(nullptr),
+          pos_(0),
+          leaf_(nullptr) {}
+
+    template <typename T>
+    persistent_vector<T>::PersistentVectorIterator::PersistentVectorIterator(const persistent_vector *owner,
+                                                                          size_type pos) noexcept
+        : owner_(owner),
+          pos_(pos),
+          leaf_(nullptr)
+    {
+        Sync();
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::const_reference persistent_vector<T>::PersistentVectorIterator::operator*()
+        const noexcept
+    {
+        return leaf_[pos_ & kMask];
+    }
+
+    template <typename T>
+    const T *persistent_vector<T>::PersistentVectorIterator::operator->() const noexcept
+    {
+        return &leaf_[pos_ & kMask];
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::PersistentVectorIterator &
+    persistent_vector<T>::PersistentVectorIterator::operator++() noexcept
+    {
+        ++pos_;
+        if ((pos_ & kMask) == 0)
+        {
+            Sync();
+        }
+        return *this;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::PersistentVectorIterator
+    persistent_vector<T>::PersistentVectorIterator::operator++(int) noexcept
+    {
+        PersistentVectorIterator previous(*this);
+        ++*this;
+        return previous;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::PersistentVectorIterator &
+    persistent_vector<T>::PersistentVectorIterator::operator--() noexcept
+    {
+        bool crosses = (pos_ & kMask) == 0;
+        --pos_;
+        if (crosses || leaf_ == nullptr)
+        {
+            Sync();
+        }
+        return *this;
+    }
+
+    template <typename T>
+    typename persistent_vector<T>::PersistentVectorIterator
+    persistent_vector<T>::PersistentVectorIterator::operator--(int) noexcept
+    {
+        PersistentVectorIterator previous(*this);
+        --*this;
+        return previous;
+    }
+
+    template <typename T>
+    bool persistent_vector<T>::PersistentVectorIterator::operator==(
+        const PersistentVectorIterator &other) const noexcept
+    {
+        return pos_ == other.pos_ && owner_ == other.owner_;
+    }
+
+    template <typename T>
+    bool persistent_vector<T>::PersistentVectorIterator::operator!=(
+        const PersistentVectorIterator &other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    template <typename T>
+    void persistent_vector<T>::PersistentVectorIterator::Sync() noexcept
+    {
+        leaf_ = pos_ < owner_->size_ ? owner_->LeafFor(pos_) : nullptr;
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_PERSISTENT_VECTOR_H_
@@ -0,0 +1,212 @@
+#ifndef SRC_CONTAINERS_S21_PRIORITY_QUEUE_H_
+#define SRC_CONTAINERS_S21_PRIORITY_QUEUE_H_
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Max-heap adapter over a random-access container, ordered by Compare
+    // like std::priority_queue: top() is the element no other element
+    // compares greater than. Arity is the number of children per node; a
+    // 4-ary heap is half as deep as a binary one and keeps all children of
+    // a node in one or two cache lines, which pays off when pops dominate.
+    template <typename T, typename Container = vector<T>,
+              typename Compare = std::less<T>, size_t Arity = 2>
+    class priority_queue
+    {
+        static_assert(Arity >= 2, "a heap needs at least two children per node");
+
+    public:
+        // Priority queue Member type
+        using container_type = Container;
+        using value_compare = Compare;
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using size_type = size_t;
+
+        static constexpr size_type arity = Arity;
+
+        // Priority queue Member functions
+        priority_queue() : c_(), comp_() {}
+        explicit priority_queue(const Compare &compare) : c_(), comp_(compare) {}
+        priority_queue(const Compare &compare, const Container &items);
+        priority_queue(const Compare &compare, Container &&items);
+        template <typename InputIt,
+                  typename = decltype(*std::declval<InputIt &>())>
+        priority_queue(InputIt first, InputIt last,
+                       const Compare &compare = Compare());
+        priority_queue(std::initializer_list<value_type> const &items);
+
+        // Priority queue Element access
+        const_reference top() const { return *c_.cbegin(); }
+
+        // Priority queue Capacity
+        bool empty() const { return c_.cbegin() == c_.cend(); }
+        size_type size() const { return c_.cend() - c_.cbegin(); }
+
+        // Priority queue Modifiers
+        void push(const_reference value);
+        void push(value_type &&value);
+        template <typename... Args>
+        void emplace(Args &&...args);
+        void pop();
+        void swap(priority_queue &other) noexcept;
+
+    private:
+        Container c_;
+        Compare comp_;
+
+        // Heapifies bottom-up from the last parent: O(n) rather than the
+        // O(n log n) of pushing one element at a time.
+        void MakeHeap();
+        void SiftUp(size_type hole, value_type value);
+        void SiftDown(size_type hole, size_type size, value_type value);
+    };
+
+
+    // Priority queue Member functions
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    priority_queue<T, Container, Compare, Arity>::priority_queue(const Compare &compare,
+                                                                 const Container &items)
+        : c_(items), comp_(compare)
+    {
+        MakeHeap();
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    priority_queue<T, Container, Compare, Arity>::priority_queue(const Compare &compare,
+                                                                 Container &&items)
+        : c_(std::move(items)), comp_(compare)
+    {
+        MakeHeap();
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    template <typename InputIt, typename>
+    priority_queue<T, Container, Compare, Arity>::priority_queue(InputIt first, InputIt last,
+                                                                 const Compare &compare)
+        : c_(), comp_(compare)
+    {
+        for (; first != last; ++first)
+        {
+            c_.push_back(*first);
+        }
+        MakeHeap();
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    priority_queue<T, Container, Compare, Arity>::priority_queue(
+        std::initializer_list<value_type> const &items)
+        : priority_queue(items.begin(), items.end()) {}
+
+    // Priority queue Modifiers
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    void priority_queue<T, Container, Compare, Arity>::push(const_reference value)
+    {
+        push(value_type(value));
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    void priority_queue<T, Container, Compare, Arity>::push(value_type &&value)
+    {
+        // The new slot is a hole: the value is placed once, after its
+        // ancestors have been shifted down past it.
+        c_.push_back(std::move(value));
+        size_type hole = c_.size() - 1;
+        SiftUp(hole, std::move(c_[hole]));
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    template <typename... Args>
+    void priority_queue<T, Container, Compare, Arity>::emplace(Args &&...args)
+    {
+        push(value_type(std::forward<Args>(args)...));
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    void priority_queue<T, Container, Compare, Arity>::pop()
+    {
+        size_type last = c_.size() - 1;
+        value_type value = std::move(c_[last]);
+        c_.pop_back();
+        if (last > 0)
+        {
+            SiftDown(0, last, std::move(value));
+        }
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    void priority_queue<T, Container, Compare, Arity>::swap(priority_queue &other) noexcept
+    {
+        std::swap(c_, other.c_);
+        std::swap(comp_, other.comp_);
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    void priority_queue<T, Container, Compare, Arity>::MakeHeap()
+    {
+        size_type size = c_.size();
+        if (size < 2)
+        {
+            return;
+        }
+        for (size_type parent = (size - 2) / Arity + 1; parent-- > 0;)
+        {
+            SiftDown(parent, size, std::move(c_[parent]));
+        }
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    void priority_queue<T, Container, Compare, Arity>::SiftUp(size_type hole, value_type value)
+    {
+        while (hole > 0)
+        {
+            size_type parent = (hole - 1) / Arity;
+            if (!comp_(c_[parent], value))
+            {
+                break;
+            }
+            c_[hole] = std::move(c_[parent]);
+            hole = parent;
+        }
+        c_[hole] = std::move(value);
+    }
+
+    template <typename T, typename Container, typename Compare, size_t Arity>
+    void priority_queue<T, Container, Compare, Arity>::SiftDown(size_type hole, size_type size,
+                                                                value_type value)
+    {
+        for (;;)
+        {
+            size_type first = hole * Arity + 1;
+            if (first >= size)
+            {
+                break;
+            }
+            size_type last = first + Arity < size ? first + Arity : size;
+            size_type best = first;
+            for (size_type child = first + 1; child < last; ++child)
+            {
+                if (comp_(c_[best], c_[child]))
+                {
+                    best = child;
+                }
+            }
+            if (!comp_(value, c_[best]))
+            {
+                break;
+            }
+            c_[hole] = std::move(c_[best]);
+            hole = best;
+        }
+        c_[hole] = std::move(value);
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_PRIORITY_QUEUE_H_
@@ -46,6 +46,22 @@ namespace s21
             list_.insert_many_back(args...);
         }
 
+        // Queue serialization, front to back
+        void save(std::ostream &os) const
+        {
+            serial::write_sequence(os, serial_kind::kQueue, list_.cbegin(),
+                                   list_.cend(), list_.size());
+        }
+
+        void load(std::istream &is)
+        {
+            list<T> loaded;
+            serial::read_sequence<value_type>(
+                is, serial_kind::kQueue,
+                [&loaded](value_type &&item) { loaded.push_back(item); });
+            list_.swap(loaded);
+        }
+
     private:
         list<T> list_;
     };
@@ -54,13 +54,22 @@ namespace s21
         std::pair<iterator, bool> insert(const value_type &value);
         void erase(iterator pos);
         iterator find(key_type key) noexcept;
-        bool contains(key_type key) noexcept;
+        const_iterator find(key_type key) const noexcept;
+        bool contains(key_type key) const noexcept;
         iterator lower_bound(const Key &key) noexcept;
+        const_iterator lower_bound(const Key &key) const noexcept;
         iterator upper_bound(const Key &key) noexcept;
+        const_iterator upper_bound(const Key &key) const noexcept;
         void merge(RBTree &other) noexcept;
         void clear() noexcept;
         void swap(RBTree &other) noexcept;
 
+    protected:
+        // Serialization in key order; loading expects sorted keys, strictly
+        // increasing when `strict`, and builds the tree in linear time.
+        void SaveTree(std::ostream &os, serial_kind kind) const;
+        void LoadTree(std::istream &is, serial_kind kind, bool strict);
+
     private:
         Node *sentinel_ = nullptr;
         Node *root_ = nullptr;
@@ -75,12 +84,21 @@ namespace s21
         std::pair<Node *, bool> InsertNodeDirectly(Node *root, Node *new_node) noexcept;
         void mergeTreeUnique(RBTree &other) noexcept;
         Node *ExtractNode(iterator pos);
+        // Lookups shared by the const and non-const overloads; the sentinel
+        // stands for "not found".
+        Node *FindNode(const Key &key) const noexcept;
+        Node *LowerBoundNode(const Key &key) const noexcept;
+        Node *UpperBoundNode(const Key &key) const noexcept;
         void BalanceAfterInsert(Node *node) noexcept;
         void BalanceAfterRemove(Node *node) noexcept;
         Node *SearchMin(Node *node) noexcept;
         Node *SearchMax(Node *node) noexcept;
         void SetMinMax(Node *node) noexcept;
         void SwapNodesValues(Node *n1, Node *n2) noexcept;
+        void BuildBalanced(vector<Node *> &nodes) noexcept;
+        Node *LinkBalanced(Node **nodes, size_type first, size_type last,
+                           Node *parent, size_type depth,
+                           size_type red_depth) noexcept;
     };
 
     template <typename Key, typename T, bool unique_values>
@@ -243,73 +261,48 @@ namespace s21
     template <typename Key, typename T, bool unique_values>
     typename RBTree<Key, T, unique_values>::iterator RBTree<Key, T, unique_values>::find(Key key) noexcept
     {
-        Node *current = root_;
-        while (current)
-        {
-            if (key == current->data.first)
-            {
-                return iterator(current);
-            }
-            else if (key < current->data.first)
-            {
-                current = current->left;
-            }
-            else
-            {
-                current = current->right;
-            }
-        }
-        return end();
+        return iterator(FindNode(key));
+    }
+
+    template <typename Key, typename T, bool unique_values>
+    typename RBTree<Key, T, unique_values>::const_iterator RBTree<Key, T, unique_values>::find(
+        Key key) const noexcept
+    {
+        return const_iterator(FindNode(key));
     }
 
     template <typename Key, typename T, bool unique_values>
-    bool RBTree<Key, T, unique_values>::contains(Key key) noexcept
+    bool RBTree<Key, T, unique_values>::contains(Key key) const noexcept
     {
-        return find(key) != end();
+        return FindNode(key) != sentinel_;
     }
 
     template <typename Key, typename T, bool unique_values>
     typename RBTree<Key, T, unique_values>::iterator RBTree<Key, T, unique_values>::lower_bound(
         const Key &key) noexcept
     {
-        Node *search = root_;
-        Node *result = nullptr;
+        return iterator(LowerBoundNode(key));
+    }
 
-        while (search != nullptr)
-        {
-            if (search->data.first >= key)
-            {
-                result = search;
-                search = search->left;
-            }
-            else
-            {
-                search = search->right;
-            }
-        }
-        return (result == nullptr ? end() : iterator(result));
+    template <typename Key, typename T, bool unique_values>
+    typename RBTree<Key, T, unique_values>::const_iterator RBTree<Key, T, unique_values>::lower_bound(
+        const Key &key) const noexcept
+    {
+        return const_iterator(LowerBoundNode(key));
     }
 
     template <typename Key, typename T, bool unique_values>
     typename RBTree<Key, T, unique_values>::iterator RBTree<Key, T, unique_values>::upper_bound(
         const Key &key) noexcept
     {
-        Node *search = root_;
-        Node *result = nullptr;
+        return iterator(UpperBoundNode(key));
+    }
 
-        while (search != nullptr)
-        {
-            if (search->data.first > key)
-            {
-                result = search;
-                search = search->left;
-            }
-            else
-            {
-                search = search->right;
-            }
-        }
-        return (result == nullptr ? end() : iterator(result));
+    template <typename Key, typename T, bool unique_values>
+    typename RBTree<Key, T, unique_values>::const_iterator RBTree<Key, T, unique_values>::upper_bound(
+        const Key &key) const noexcept
+    {
+        return const_iterator(UpperBoundNode(key));
     }
 
     template <typename Key, typename T, bool unique_values>
@@ -411,6 +404,49 @@ namespace s21
         std::swap(size_, other.size_);
     }
 
+    template <typename Key, typename T, bool unique_values>
+    void RBTree<Key, T, unique_values>::SaveTree(std::ostream &os, serial_kind kind) const
+    {
+        serial::write_sequence(os, kind, cbegin(), cend(), size_);
+    }
+
+    template <typename Key, typename T, bool unique_values>
+    void RBTree<Key, T, unique_values>::LoadTree(std::istream &is, serial_kind kind, bool strict)
+    {
+        vector<Node *> nodes;
+        try
+        {
+            serial::read_sequence<value_type>(
+                is, kind, [&nodes, strict](value_type &&item)
+                {
+                    if (!nodes.empty())
+                    {
+                        const Key &prev = nodes.back()->data.first;
+                        if (item.first < prev || (strict && !(prev < item.first)))
+                        {
+                            throw std::invalid_argument("s21::load: keys are not sorted");
+                        }
+                    }
+                    // The slot comes first, so a failed push_back leaves
+                    // no node behind; a null one is safe to delete.
+                    nodes.push_back(nullptr);
+                    nodes[nodes.size() - 1] = new Node(std::move(item));
+                });
+        }
+        catch (...)
+        {
+            for (Node *node : nodes)
+            {
+                delete node;
+            }
+            throw;
+        }
+
+        RBTree loaded;
+        loaded.BuildBalanced(nodes);
+        swap(loaded);
+    }
+
     // private functions
 
     template <typename Key, typename T, bool unique_values>
@@ -577,6 +613,73 @@ namespace s21
         return std::make_pair(new_node, true);
     }
 
+    template <typename Key, typename T, bool unique_values>
+    typename RBTree<Key, T, unique_values>::Node *RBTree<Key, T, unique_values>::FindNode(
+        const Key &key) const noexcept
+    {
+        Node *current = root_;
+        while (current)
+        {
+            if (key == current->data.first)
+            {
+                return current;
+            }
+            else if (key < current->data.first)
+            {
+                current = current->left;
+            }
+            else
+            {
+                current = current->right;
+            }
+        }
+        return sentinel_;
+    }
+
+    template <typename Key, typename T, bool unique_values>
+    typename RBTree<Key, T, unique_values>::Node *RBTree<Key, T, unique_values>::LowerBoundNode(
+        const Key &key) const noexcept
+    {
+        Node *search = root_;
+        Node *result = sentinel_;
+
+        while (search != nullptr)
+        {
+            if (search->data.first >= key)
+            {
+                result = search;
+                search = search->left;
+            }
+            else
+            {
+                search = search->right;
+            }
+        }
+        return result;
+    }
+
+    template <typename Key, typename T, bool unique_values>
+    typename RBTree<Key, T, unique_values>::Node *RBTree<Key, T, unique_values>::UpperBoundNode(
+        const Key &key) const noexcept
+    {
+        Node *search = root_;
+        Node *result = sentinel_;
+
+        while (search != nullptr)
+        {
+            if (search->data.first > key)
+            {
+                result = search;
+                search = search->left;
+            }
+            else
+            {
+                search = search->right;
+            }
+        }
+        return result;
+    }
+
     template <typename Key, typename T, bool unique_values>
     typename RBTree<Key, T, unique_values>::Node *RBTree<Key, T, unique_values>::ExtractNode(iterator pos)
     {
@@ -909,6 +1012,47 @@ namespace s21
         }
     }
 
+    template <typename Key, typename T, bool unique_values>
+    void RBTree<Key, T, unique_values>::BuildBalanced(vector<Node *> &nodes) noexcept
+    {
+        size_type count = nodes.size();
+        if (count == 0)
+        {
+            return;
+        }
+        // Splitting at the middle leaves every leaf on the last two levels:
+        // the last level is red, everything above it black, so all paths
+        // share the same black height.
+        size_type red_depth = 0;
+        while ((size_type(2) << red_depth) <= count)
+        {
+            ++red_depth;
+        }
+        root_ = LinkBalanced(nodes.data(), 0, count, sentinel_, 0, red_depth);
+        sentinel_->parent = root_;
+        sentinel_->left = nodes[0];
+        sentinel_->right = nodes[count - 1];
+        size_ = count;
+    }
+
+    template <typename Key, typename T, bool unique_values>
+    typename RBTree<Key, T, unique_values>::Node *RBTree<Key, T, unique_values>::LinkBalanced(
+        Node **nodes, size_type first, size_type last, Node *parent, size_type depth,
+        size_type red_depth) noexcept
+    {
+        if (first == last)
+        {
+            return nullptr;
+        }
+        size_type middle = first + (last - first) / 2;
+        Node *node = nodes[middle];
+        node->parent = parent;
+        node->color = depth == red_depth && depth > 0 ? Color::kRed : Color::kBlack;
+        node->left = LinkBalanced(nodes, first, middle, node, depth + 1, red_depth);
+        node->right = LinkBalanced(nodes, middle + 1, last, node, depth + 1, red_depth);
+        return node;
+    }
+
     template <typename Key, typename T, bool unique_values>
     class RBTree<Key, T, unique_values>::Node
     {
@@ -921,7 +1065,7 @@ namespace s21
 
         Node() : left(this), right(this) {}
         explicit Node(value_type value)
-            : data(value), left(nullptr), right(nullptr) {}
+            : data(std::move(value)), left(nullptr), right(nullptr) {}
 
         Node *NextNode() const noexcept;
         Node *PrevNode() const noexcept;
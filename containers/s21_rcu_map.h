@@ -0,0 +1,421 @@
+#ifndef SRC_CONTAINERS_S21_RCU_MAP_H_
+#define SRC_CONTAINERS_S21_RCU_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "s21_epoch.h"
+#include "s21_map.h"
+#include "s21_persistent_tree.h"
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Read-mostly map whose readers never lock. Every version is an
+    // immutable PersistentTree; a writer builds the next version by copying
+    // only the nodes on the paths it changes, O(log n) per update, and
+    // shares the rest with the previous one. Publishing is a single pointer
+    // store. The replaced nodes are retired to an epoch_domain and freed
+    // after a grace period, once no reader can still hold the old version.
+    //
+    // Writers are serialized by a mutex, so this pays off only when reads
+    // dominate: config, routing and lookup tables.
+    template <typename Key, typename T>
+    class rcu_map
+    {
+        struct Writer;
+        // Node marks are the stamp of the update that created the node.
+        using Tree = PersistentTree<std::pair<Key, T>, uint64_t, Writer>;
+        using Node = typename Tree::Node;
+
+    public:
+        class snapshot;
+
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<key_type, mapped_type>;
+        using size_type = size_t;
+
+        rcu_map();
+        explicit rcu_map(const map<key_type, mapped_type> &items);
+        rcu_map(const rcu_map &other) = delete;
+        // No other thread may use the map any more.
+        ~rcu_map();
+
+        rcu_map &operator=(const rcu_map &other) = delete;
+
+        // Readers; wait-free apart from the first pin on a thread.
+        // read() pins the current version for as long as the snapshot
+        // lives; the rest are one-shot shortcuts.
+        snapshot read() const;
+        std::optional<mapped_type> find(const key_type &key) const;
+        bool contains(const key_type &key) const;
+        size_type size() const;
+        bool empty() const;
+
+        // Writers; each publishes one new version. insert() keeps an
+        // existing value and returns false for it; insert_or_assign()
+        // returns true when the key was new.
+        bool insert(const key_type &key, const mapped_type &obj);
+        bool insert_or_assign(const key_type &key, const mapped_type &obj);
+        bool erase(const key_type &key);
+        void clear();
+
+    private:
+        struct Version
+        {
+            Node *root;
+            size_type size;
+        };
+
+        // Ownership for the tree, guarded by write_mutex_. Nodes stamped
+        // with the update in progress are not yet published and may be
+        // changed in place; published ones are never written, only
+        // replaced and retired.
+        struct Writer
+        {
+            uint64_t stamp = 0;
+            vector<Node *> fresh;
+            vector<Node *> garbage;
+            vector<Node *> discard;
+
+            Node *Make(const value_type &value);
+            void Own(Node *&node);
+            void Drop(Node *node);
+        };
+
+        mutable epoch_domain domain_;
+        std::atomic<Version *> current_;
+        std::mutex write_mutex_;
+        Writer writer_;
+
+        template <typename F>
+        bool Update(F change);
+        static void DestroyTree(Node *node) noexcept;
+
+    public:
+        // One version of the map, frozen. Must stay on the thread that
+        // took it and should be short-lived: it holds back reclamation.
+        class snapshot
+        {
+        public:
+            using iterator = typename Tree::iterator;
+            using const_iterator = typename Tree::iterator;
+
+            const_iterator begin() const;
+            const_iterator end() const noexcept;
+
+            bool empty() const noexcept;
+            size_type size() const noexcept;
+
+            const_iterator find(const key_type &key) const;
+            bool contains(const key_type &key) const noexcept;
+            const_iterator lower_bound(const key_type &key) const;
+            const_iterator upper_bound(const key_type &key) const;
+
+        private:
+            friend class rcu_map;
+
+            snapshot(epoch_domain::guard guard, const Version *version) noexcept;
+
+            epoch_domain::guard guard_;
+            const Node *root_;
+            size_type size_;
+        };
+    };
+
+
+    template <typename Key, typename T>
+    rcu_map<Key, T>::rcu_map() : current_(new Version{nullptr, 0}) {}
+
+    template <typename Key, typename T>
+    rcu_map<Key, T>::rcu_map(const map<key_type, mapped_type> &items) : rcu_map()
+    {
+        // One update for all items: every node is fresh, nothing is copied.
+        Update([this, &items](Version &next) {
+            Tree tree(writer_);
+            for (auto iter = items.cbegin(); iter != items.cend(); ++iter)
+            {
+                next.size += tree.insert(next.root, *iter, false);
+            }
+            return true;
+        });
+    }
+
+    template <typename Key, typename T>
+    rcu_map<Key, T>::~rcu_map()
+    {
+        Version *version = current_.load(std::memory_order_relaxed);
+        DestroyTree(version->root);
+        delete version;
+    }
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::snapshot rcu_map<Key, T>::read() const
+    {
+        epoch_domain::guard guard(domain_);
+        const Version *version = current_.load(std::memory_order_acquire);
+        return snapshot(std::move(guard), version);
+    }
+
+    template <typename Key, typename T>
+    std::optional<T> rcu_map<Key, T>::find(const key_type &key) const
+    {
+        epoch_domain::guard guard(domain_);
+        const Node *node = Tree::lookup(current_.load(std::memory_order_acquire)->root, key);
+        if (node == nullptr)
+        {
+            return std::nullopt;
+        }
+        return node->data.second;
+    }
+
+    template <typename Key, typename T>
+    bool rcu_map<Key, T>::contains(const key_type &key) const
+    {
+        epoch_domain::guard guard(domain_);
+        return Tree::lookup(current_.load(std::memory_order_acquire)->root, key) != nullptr;
+    }
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::size_type rcu_map<Key, T>::size() const
+    {
+        epoch_domain::guard guard(domain_);
+        return current_.load(std::memory_order_acquire)->size;
+    }
+
+    template <typename Key, typename T>
+    bool rcu_map<Key, T>::empty() const
+    {
+        return size() == 0;
+    }
+
+    template <typename Key, typename T>
+    bool rcu_map<Key, T>::insert(const key_type &key, const mapped_type &obj)
+    {
+        return Update([this, &key, &obj](Version &next) {
+            if (Tree::lookup(next.root, key) != nullptr)
+            {
+                return false;
+            }
+            next.size += Tree(writer_).insert(next.root, value_type(key, obj), false);
+            return true;
+        });
+    }
+
+    template <typename Key, typename T>
+    bool rcu_map<Key, T>::insert_or_assign(const key_type &key, const mapped_type &obj)
+    {
+        bool inserted = false;
+        Update([this, &key, &obj, &inserted](Version &next) {
+            inserted = Tree(writer_).insert(next.root, value_type(key, obj), true);
+            next.size += inserted;
+            return true;
+        });
+        return inserted;
+    }
+
+    template <typename Key, typename T>
+    bool rcu_map<Key, T>::erase(const key_type &key)
+    {
+        return Update([this, &key](Version &next) {
+            if (!Tree(writer_).erase(next.root, key))
+            {
+                return false;
+            }
+            --next.size;
+            return true;
+        });
+    }
+
+    template <typename Key, typename T>
+    void rcu_map<Key, T>::clear()
+    {
+        Update([this](Version &next) {
+            if (next.root == nullptr)
+            {
+                return false;
+            }
+            // Every node of the old version goes, so retire them all.
+            vector<Node *> pending;
+            pending.push_back(next.root);
+            while (!pending.empty())
+            {
+                Node *node = pending.back();
+                pending.pop_back();
+                writer_.garbage.push_back(node);
+                if (node->left != nullptr)
+                {
+                    pending.push_back(node->left);
+                }
+                if (node->right != nullptr)
+                {
+                    pending.push_back(node->right);
+                }
+            }
+            next = Version{nullptr, 0};
+            return true;
+        });
+    }
+
+    template <typename Key, typename T>
+    template <typename F>
+    bool rcu_map<Key, T>::Update(F change)
+    {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        Version *previous = current_.load(std::memory_order_relaxed);
+        Version *next = nullptr;
+        ++writer_.stamp;
+        try
+        {
+            next = new Version(*previous);
+            if (!change(*next))
+            {
+                delete next;
+                return false;
+            }
+        }
+        catch (...)
+        {
+            // The old version is untouched; only fresh nodes are ours.
+            delete next;
+            for (Node *node : writer_.fresh)
+            {
+                delete node;
+            }
+            writer_.fresh.clear();
+            writer_.garbage.clear();
+            writer_.discard.clear();
+            throw;
+        }
+        current_.store(next, std::memory_order_release);
+        {
+            epoch_domain::guard guard(domain_);
+            for (Node *node : writer_.garbage)
+            {
+                domain_.retire(node);
+            }
+            domain_.retire(previous);
+        }
+        for (Node *node : writer_.discard)
+        {
+            delete node;
+        }
+        writer_.fresh.clear();
+        writer_.garbage.clear();
+        writer_.discard.clear();
+        return true;
+    }
+
+    template <typename Key, typename T>
+    void rcu_map<Key, T>::DestroyTree(Node *node) noexcept
+    {
+        while (node != nullptr)
+        {
+            DestroyTree(node->right);
+            Node *left = node->left;
+            delete node;
+            node = left;
+        }
+    }
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::Node *rcu_map<Key, T>::Writer::Make(const value_type &value)
+    {
+        // Reserve the slot first so a failed push cannot leak the node.
+        fresh.push_back(nullptr);
+        Node *&slot = fresh[fresh.size() - 1];
+        slot = new Node{value, nullptr, nullptr, Color::kRed, stamp};
+        return slot;
+    }
+
+    template <typename Key, typename T>
+    void rcu_map<Key, T>::Writer::Own(Node *&node)
+    {
+        // Path copying: a published node is never written, only replaced.
+        if (node->mark == stamp)
+        {
+            return;
+        }
+        garbage.push_back(node);
+        Node *copy = Make(node->data);
+        copy->left = node->left;
+        copy->right = node->right;
+        copy->color = node->color;
+        node = copy;
+    }
+
+    template <typename Key, typename T>
+    void rcu_map<Key, T>::Writer::Drop(Node *node)
+    {
+        if (node->mark == stamp)
+        {
+            discard.push_back(node);
+        }
+        else
+        {
+            garbage.push_back(node);
+        }
+    }
+
+    template <typename Key, typename T>
+    rcu_map<Key, T>::snapshot::snapshot(epoch_domain::guard guard, const Version *version) noexcept
+        : guard_(std::move(guard)),
+          root_(version->root),
+          size_(version->size) {}
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::snapshot::const_iterator rcu_map<Key, T>::snapshot::begin() const
+    {
+        return Tree::begin(root_);
+    }
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::snapshot::const_iterator rcu_map<Key, T>::snapshot::end() const noexcept
+    {
+        return const_iterator();
+    }
+
+    template <typename Key, typename T>
+    bool rcu_map<Key, T>::snapshot::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::size_type rcu_map<Key, T>::snapshot::size() const noexcept
+    {
+        return size_;
+    }
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::snapshot::const_iterator rcu_map<Key, T>::snapshot::find(const key_type &key) const
+    {
+        return Tree::find(root_, key);
+    }
+
+    template <typename Key, typename T>
+    bool rcu_map<Key, T>::snapshot::contains(const key_type &key) const noexcept
+    {
+        return Tree::lookup(root_, key) != nullptr;
+    }
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::snapshot::const_iterator rcu_map<Key, T>::snapshot::lower_bound(
+        const key_type &key) const
+    {
+        return Tree::lower_bound(root_, key);
+    }
+
+    template <typename Key, typename T>
+    typename rcu_map<Key, T>::snapshot::const_iterator rcu_map<Key, T>::snapshot::upper_bound(
+        const key_type &key) const
+    {
+        return Tree::upper_bound(root_, key);
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_RCU_MAP_H_
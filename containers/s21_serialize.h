@@ -0,0 +1,390 @@
+#ifndef SRC_CONTAINERS_S21_SERIALIZE_H_
+#define SRC_CONTAINERS_S21_SERIALIZE_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <ios>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace s21
+{
+    // Binary format shared by the containers' save()/load() members.
+    //
+    // Every container starts with a 16-byte header:
+    //   magic "S21S" | version u16 | kind u8 | flags u8 | element count u64
+    // followed by its elements in iteration order. Integers are little
+    // endian. Elements are encoded by serializer<T>:
+    //   - arithmetic and enum types: their bytes in little-endian order;
+    //   - empty types (the mapped type of sets): nothing;
+    //   - std::string: u64 length, then the characters;
+    //   - std::pair: first, then second;
+    //   - anything with save()/load() members, e.g. nested containers.
+    // Other element types, structs included, need a serializer<T>
+    // specialization (save, load and a `bulk` flag): their object
+    // representation has padding and an ABI-dependent layout, so it is
+    // never written implicitly. Contiguous runs of `bulk` elements, whose
+    // encoding is their memory layout, are written and read as one block.
+    enum class serial_kind : uint8_t
+    {
+        kVector = 1,
+        kArray,
+        kList,
+        kMap,
+        kSet,
+        kMultiset,
+        kQueue,
+        kStack,
+        kSmallVector,
+        kUnrolledList,
+        kStaticVector
+    };
+
+    template <typename T, typename Enable = void>
+    struct serializer
+    {
+        static constexpr bool bulk =
+            (std::is_arithmetic_v<T> || std::is_enum_v<T>) &&
+            __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+
+        static void save(std::ostream &os, const T &value);
+        static void load(std::istream &is, T &value);
+    };
+
+    template <>
+    struct serializer<std::string>
+    {
+        static constexpr bool bulk = false;
+
+        static void save(std::ostream &os, const std::string &value);
+        static void load(std::istream &is, std::string &value);
+    };
+
+    template <typename First, typename Second>
+    struct serializer<std::pair<First, Second>>
+    {
+        static constexpr bool bulk = false;
+
+        static void save(std::ostream &os, const std::pair<First, Second> &value);
+        static void load(std::istream &is, std::pair<First, Second> &value);
+    };
+
+    namespace serial
+    {
+        inline constexpr char kMagic[4] = {'S', '2', '1', 'S'};
+        inline constexpr uint16_t kVersion = 1;
+
+        // Whether T has its own save(std::ostream &) and load(std::istream &).
+        template <typename T, typename = void>
+        struct has_members : std::false_type
+        {
+        };
+        template <typename T>
+        struct has_members<
+            T, std::void_t<decltype(std::declval<const T &>().save(
+                               std::declval<std::ostream &>())),
+                           decltype(std::declval<T &>().load(
+                               std::declval<std::istream &>()))>>
+            : std::true_type
+        {
+        };
+
+        template <typename T>
+        void write(std::ostream &os, const T &value);
+        template <typename T>
+        void read(std::istream &is, T &value);
+        template <typename T>
+        void write_array(std::ostream &os, const T *items, size_t count);
+        template <typename T>
+        void read_array(std::istream &is, T *items, size_t count);
+
+        void write_header(std::ostream &os, serial_kind kind, uint64_t count);
+        // Validates the header and returns the element count.
+        uint64_t read_header(std::istream &is, serial_kind kind);
+
+        // Header plus count elements from [first, last).
+        template <typename InputIt>
+        void write_sequence(std::ostream &os, serial_kind kind, InputIt first,
+                            InputIt last, uint64_t count);
+        // Reads a header and hands each element of type T to sink(T &&).
+        template <typename T, typename Sink>
+        void read_sequence(std::istream &is, serial_kind kind, Sink sink);
+
+        // Loads into contiguous storage grow by at most this many bytes of
+        // elements at a time, so storage follows the payload that actually
+        // arrives rather than the count a header claims.
+        inline constexpr size_t kChunkBytes = size_t(1) << 16;
+        // Calls read_chunk(n) until `count` elements of T have been read.
+        // A stream that ends early means the count was corrupt, reported as
+        // std::invalid_argument(corrupt).
+        template <typename T, typename ReadChunk>
+        void read_chunked(uint64_t count, const char *corrupt,
+                          ReadChunk read_chunk);
+
+        template <typename T>
+        void write_scalar(std::ostream &os, T value);
+        template <typename T>
+        void read_scalar(std::istream &is, T &value);
+        void read_bytes(std::istream &is, char *bytes, size_t count);
+        void check_written(std::ostream &os);
+    } // namespace serial
+
+
+    template <typename T, typename Enable>
+    void serializer<T, Enable>::save(std::ostream &os, const T &value)
+    {
+        if constexpr (std::is_empty_v<T>)
+        {
+            (void)os;
+            (void)value;
+        }
+        else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            serial::write_scalar(os, value);
+        }
+        else
+        {
+            static_assert(serial::has_members<T>::value,
+                          "specialize s21::serializer for this element type");
+            value.save(os);
+        }
+    }
+
+    template <typename T, typename Enable>
+    void serializer<T, Enable>::load(std::istream &is, T &value)
+    {
+        if constexpr (std::is_empty_v<T>)
+        {
+            (void)is;
+            (void)value;
+        }
+        else if constexpr (std::is_arithmetic_v<T> || std::is_enum_v<T>)
+        {
+            serial::read_scalar(is, value);
+        }
+        else
+        {
+            static_assert(serial::has_members<T>::value,
+                          "specialize s21::serializer for this element type");
+            value.load(is);
+        }
+    }
+
+    inline void serializer<std::string>::save(std::ostream &os,
+                                              const std::string &value)
+    {
+        serial::write_scalar(os, static_cast<uint64_t>(value.size()));
+        os.write(value.data(), static_cast<std::streamsize>(value.size()));
+    }
+
+    inline void serializer<std::string>::load(std::istream &is,
+                                              std::string &value)
+    {
+        uint64_t length = 0;
+        serial::read_scalar(is, length);
+        if (length > value.max_size())
+        {
+            throw std::invalid_argument("s21::load: corrupt string length");
+        }
+        value.resize(static_cast<size_t>(length));
+        serial::read_bytes(is, value.data(), value.size());
+    }
+
+    template <typename First, typename Second>
+    void serializer<std::pair<First, Second>>::save(
+        std::ostream &os, const std::pair<First, Second> &value)
+    {
+        serial::write(os, value.first);
+        serial::write(os, value.second);
+    }
+
+    template <typename First, typename Second>
+    void serializer<std::pair<First, Second>>::load(
+        std::istream &is, std::pair<First, Second> &value)
+    {
+        serial::read(is, value.first);
+        serial::read(is, value.second);
+    }
+
+    template <typename T>
+    void serial::write(std::ostream &os, const T &value)
+    {
+        serializer<std::remove_cv_t<T>>::save(os, value);
+    }
+
+    template <typename T>
+    void serial::read(std::istream &is, T &value)
+    {
+        // Empty types carry no bytes, which also covers the const
+        // placeholder sets use as their mapped type.
+        if constexpr (!std::is_empty_v<T>)
+        {
+            serializer<T>::load(is, value);
+        }
+    }
+
+    template <typename T>
+    void serial::write_array(std::ostream &os, const T *items, size_t count)
+    {
+        if constexpr (serializer<T>::bulk)
+        {
+            os.write(reinterpret_cast<const char *>(items),
+                     static_cast<std::streamsize>(count * sizeof(T)));
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                write(os, items[i]);
+            }
+        }
+    }
+
+    template <typename T>
+    void serial::read_array(std::istream &is, T *items, size_t count)
+    {
+        if constexpr (serializer<T>::bulk)
+        {
+            read_bytes(is, reinterpret_cast<char *>(items), count * sizeof(T));
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                read(is, items[i]);
+            }
+        }
+    }
+
+    inline void serial::write_header(std::ostream &os, serial_kind kind,
+                                     uint64_t count)
+    {
+        os.write(kMagic, sizeof(kMagic));
+        write_scalar(os, kVersion);
+        write_scalar(os, static_cast<uint8_t>(kind));
+        write_scalar(os, static_cast<uint8_t>(0));
+        write_scalar(os, count);
+    }
+
+    inline uint64_t serial::read_header(std::istream &is, serial_kind kind)
+    {
+        char magic[sizeof(kMagic)];
+        uint16_t version = 0;
+        uint8_t stored_kind = 0;
+        uint8_t flags = 0;
+        uint64_t count = 0;
+
+        read_bytes(is, magic, sizeof(magic));
+        read_scalar(is, version);
+        read_scalar(is, stored_kind);
+        read_scalar(is, flags);
+        read_scalar(is, count);
+
+        if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0)
+        {
+            throw std::invalid_argument("s21::load: not an s21 container");
+        }
+        if (version != kVersion || flags != 0)
+        {
+            throw std::invalid_argument("s21::load: unsupported format version");
+        }
+        if (stored_kind != static_cast<uint8_t>(kind))
+        {
+            throw std::invalid_argument("s21::load: different container kind");
+        }
+        return count;
+    }
+
+    template <typename InputIt>
+    void serial::write_sequence(std::ostream &os, serial_kind kind,
+                                InputIt first, InputIt last, uint64_t count)
+    {
+        write_header(os, kind, count);
+        for (; first != last; ++first)
+        {
+            write(os, *first);
+        }
+        check_written(os);
+    }
+
+    template <typename T, typename Sink>
+    void serial::read_sequence(std::istream &is, serial_kind kind, Sink sink)
+    {
+        uint64_t count = read_header(is, kind);
+        for (uint64_t i = 0; i < count; ++i)
+        {
+            T item{};
+            read(is, item);
+            sink(std::move(item));
+        }
+    }
+
+    template <typename T, typename ReadChunk>
+    void serial::read_chunked(uint64_t count, const char *corrupt,
+                              ReadChunk read_chunk)
+    {
+        const uint64_t chunk = kChunkBytes / sizeof(T) + 1;
+        try
+        {
+            for (uint64_t done = 0; done < count;)
+            {
+                size_t amount =
+                    static_cast<size_t>(std::min(count - done, chunk));
+                read_chunk(amount);
+                done += amount;
+            }
+        }
+        catch (const std::ios_base::failure &)
+        {
+            throw std::invalid_argument(corrupt);
+        }
+    }
+
+    template <typename T>
+    void serial::write_scalar(std::ostream &os, T value)
+    {
+        char bytes[sizeof(T)];
+        std::memcpy(bytes, &value, sizeof(T));
+        if constexpr (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+        {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        os.write(bytes, sizeof(T));
+    }
+
+    template <typename T>
+    void serial::read_scalar(std::istream &is, T &value)
+    {
+        char bytes[sizeof(T)];
+        read_bytes(is, bytes, sizeof(T));
+        if constexpr (__BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__)
+        {
+            std::reverse(bytes, bytes + sizeof(T));
+        }
+        std::memcpy(&value, bytes, sizeof(T));
+    }
+
+    inline void serial::read_bytes(std::istream &is, char *bytes, size_t count)
+    {
+        is.read(bytes, static_cast<std::streamsize>(count));
+        if (static_cast<size_t>(is.gcount()) != count)
+        {
+            throw std::ios_base::failure("s21::load: unexpected end of stream");
+        }
+    }
+
+    inline void serial::check_written(std::ostream &os)
+    {
+        if (!os)
+        {
+            throw std::ios_base::failure("s21::save: stream write failed");
+        }
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_SERIALIZE_H_
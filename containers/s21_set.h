@@ -34,7 +34,7 @@ namespace s21
 
         const_iterator end() const noexcept { return iterator(Base::end()); }
 
-        iterator find(key_type key) noexcept { return iterator(Base::find(key)); }
+        iterator find(key_type key) const noexcept { return iterator(Base::find(key)); }
 
         void swap(set &other) { Base::swap(other); }
 
@@ -50,7 +50,7 @@ namespace s21
 
         void merge(set &other) { Grandbase::merge(other); }
 
-        bool contains(const value_type &value) { return find(value) != end(); }
+        bool contains(const value_type &value) const { return find(value) != end(); }
 
         template <typename... Args>
         vector<std::pair<iterator, bool>> insert_many(Args &&...args)
@@ -61,6 +61,16 @@ namespace s21
             return result;
         }
 
+        void save(std::ostream &os) const
+        {
+            this->SaveTree(os, serial_kind::kSet);
+        }
+
+        void load(std::istream &is)
+        {
+            this->LoadTree(is, serial_kind::kSet, true);
+        }
+
     private:
         using Base::count;
         using Base::equal_range;
@@ -0,0 +1,541 @@
+#ifndef SRC_CONTAINERS_S21_SKIPLIST_MAP_H_
+#define SRC_CONTAINERS_S21_SKIPLIST_MAP_H_
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21
+{
+    // Ordered map for many threads at once, as a lock-free skip list
+    // (Herlihy & Shavit, ch. 14; Fraser's helping on insert). A node is
+    // erased by setting the low bit of its next pointers, top level down,
+    // the bottom level last; the thread that wins the bottom bit owns the
+    // erase, and every traversal that meets a marked node unlinks it.
+    // Unlinked nodes go to an epoch_domain, so readers never see freed
+    // memory. Values are immutable once inserted.
+    //
+    // Iterators pin the map's epoch while they live: they stay valid
+    // across concurrent inserts and erases (an erased element is simply
+    // skipped) but must stay on the thread that created them, and a
+    // long-lived iterator holds back reclamation.
+    template <typename Key, typename T>
+    class skiplist_map
+    {
+    public:
+        class SkipListIterator;
+
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<key_type, mapped_type>;
+        using reference = const value_type &;
+        using const_reference = const value_type &;
+        using iterator = SkipListIterator;
+        using const_iterator = SkipListIterator;
+        using size_type = size_t;
+
+        skiplist_map();
+        skiplist_map(const skiplist_map &other) = delete;
+        // No other thread may use the map any more.
+        ~skiplist_map();
+
+        skiplist_map &operator=(const skiplist_map &other) = delete;
+
+        // Iterators, in key order
+        iterator begin();
+        iterator end() noexcept;
+
+        // Capacity; size() is exact only when no writer runs.
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+
+        // Modifiers
+        std::pair<iterator, bool> insert(const value_type &value);
+        std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
+        bool erase(const key_type &key);
+
+        // Lookup
+        iterator find(const key_type &key);
+        bool contains(const key_type &key);
+        iterator lower_bound(const key_type &key);
+        iterator upper_bound(const key_type &key);
+
+    private:
+        struct Node
+        {
+            Node(const value_type &value, int levels);
+
+            value_type data;
+            int height;
+            // Erase needs both its own unlinking pass and the inserter's
+            // last link done before the node can be retired.
+            std::atomic<int> owners;
+            std::atomic<uintptr_t> *next;
+        };
+
+        // With one node in four promoted per level, 16 levels cover 4^16
+        // elements before the search degrades.
+        static constexpr int kMaxLevel = 16;
+
+        std::atomic<uintptr_t> head_[kMaxLevel];
+        std::atomic<size_type> size_;
+        epoch_domain domain_;
+
+        static Node *Ptr(uintptr_t link) noexcept;
+        static uintptr_t Raw(Node *node) noexcept;
+        static bool Marked(uintptr_t link) noexcept;
+        static Node *NewNode(const value_type &value, int height);
+        static void DeleteNode(void *node) noexcept;
+        static int RandomHeight() noexcept;
+
+        std::atomic<uintptr_t> &Next(Node *pred, int level) noexcept;
+        bool Find(const key_type &key, Node **preds, Node **succs);
+        Node *Seek(const key_type &key, bool upper);
+        void Release(Node *node);
+
+    public:
+        class SkipListIterator
+        {
+        public:
+            SkipListIterator() noexcept;
+
+            const_reference operator*() const noexcept;
+            const value_type *operator->() const noexcept;
+            SkipListIterator &operator++() noexcept;
+            SkipListIterator operator++(int) noexcept;
+            bool operator==(const SkipListIterator &other) const noexcept;
+            bool operator!=(const SkipListIterator &other) const noexcept;
+
+        private:
+            friend class skiplist_map;
+
+            SkipListIterator(Node *node, epoch_domain::guard guard) noexcept;
+
+            Node *node_;
+            epoch_domain::guard guard_;
+        };
+    };
+
+
+    template <typename Key, typename T>
+    skiplist_map<Key, T>::Node::Node(const value_type &value, int levels)
+        : data(value),
+          height(levels),
+          owners(2),
+          next(reinterpret_cast<std::atomic<uintptr_t> *>(this + 1)) {}
+
+    template <typename Key, typename T>
+    skiplist_map<Key, T>::skiplist_map() : size_(0)
+    {
+        for (std::atomic<uintptr_t> &link : head_)
+        {
+            link.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    template <typename Key, typename T>
+    skiplist_map<Key, T>::~skiplist_map()
+    {
+        Node *node = Ptr(head_[0].load());
+        while (node != nullptr)
+        {
+            Node *next = Ptr(node->next[0].load());
+            DeleteNode(node);
+            node = next;
+        }
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::iterator skiplist_map<Key, T>::begin()
+    {
+        epoch_domain::guard guard(domain_);
+        Node *node = Ptr(head_[0].load());
+        while (node != nullptr && Marked(node->next[0].load()))
+        {
+            node = Ptr(node->next[0].load());
+        }
+        return node == nullptr ? end() : iterator(node, std::move(guard));
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::iterator skiplist_map<Key, T>::end() noexcept
+    {
+        return iterator();
+    }
+
+    template <typename Key, typename T>
+    bool skiplist_map<Key, T>::empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::size_type skiplist_map<Key, T>::size() const noexcept
+    {
+        return size_.load(std::memory_order_relaxed);
+    }
+
+    template <typename Key, typename T>
+    std::pair<typename skiplist_map<Key, T>::iterator, bool> skiplist_map<Key, T>::insert(const value_type &value)
+    {
+        epoch_domain::guard guard(domain_);
+        Node *preds[kMaxLevel];
+        Node *succs[kMaxLevel];
+        const int height = RandomHeight();
+        Node *node = nullptr;
+        while (true)
+        {
+            if (Find(value.first, preds, succs))
+            {
+                if (node != nullptr)
+                {
+                    DeleteNode(node);
+                }
+                return std::make_pair(iterator(succs[0], std::move(guard)), false);
+            }
+            if (node == nullptr)
+            {
+                node = NewNode(value, height);
+            }
+            for (int level = 0; level < height; ++level)
+            {
+                node->next[level].store(Raw(succs[level]), std::memory_order_relaxed);
+            }
+            // Linking the bottom level is the insert's linearization point.
+            uintptr_t expected = Raw(succs[0]);
+            if (Next(preds[0], 0).compare_exchange_strong(expected, Raw(node)))
+            {
+                break;
+            }
+        }
+        size_.fetch_add(1, std::memory_order_relaxed);
+        for (int level = 1; level < height; ++level)
+        {
+            bool linked = false;
+            while (!linked)
+            {
+                uintptr_t own = node->next[level].load();
+                if (Marked(own))
+                {
+                    // Being erased: stop building the tower.
+                    level = height;
+                    break;
+                }
+                if (own != Raw(succs[level]) && !node->next[level].compare_exchange_strong(own, Raw(succs[level])))
+                {
+                    continue;
+                }
+                uintptr_t expected = Raw(succs[level]);
+                linked = Next(preds[level], level).compare_exchange_strong(expected, Raw(node));
+                if (!linked)
+                {
+                    Find(value.first, preds, succs);
+                    if (succs[0] != node)
+                    {
+                        level = height;
+                        break;
+                    }
+                }
+            }
+        }
+        if (Marked(node->next[0].load()))
+        {
+            // An erase may have swept before our last link; sweep again.
+            Find(value.first, preds, succs);
+        }
+        iterator result(node, guard);
+        Release(node);
+        return std::make_pair(result, true);
+    }
+
+    template <typename Key, typename T>
+    std::pair<typename skiplist_map<Key, T>::iterator, bool> skiplist_map<Key, T>::insert(const key_type &key,
+                                                                                         const mapped_type &obj)
+    {
+        return insert(value_type(key, obj));
+    }
+
+    template <typename Key, typename T>
+    bool skiplist_map<Key, T>::erase(const key_type &key)
+    {
+        epoch_domain::guard guard(domain_);
+        Node *preds[kMaxLevel];
+        Node *succs[kMaxLevel];
+        if (!Find(key, preds, succs))
+        {
+            return false;
+        }
+        Node *victim = succs[0];
+        for (int level = victim->height - 1; level >= 1; --level)
+        {
+            uintptr_t link = victim->next[level].load();
+            while (!Marked(link) && !victim->next[level].compare_exchange_weak(link, link | 1))
+            {
+            }
+        }
+        uintptr_t link = victim->next[0].load();
+        while (true)
+        {
+            if (Marked(link))
+            {
+                return false;
+            }
+            if (victim->next[0].compare_exchange_strong(link, link | 1))
+            {
+                break;
+            }
+        }
+        size_.fetch_sub(1, std::memory_order_relaxed);
+        Find(key, preds, succs);
+        Release(victim);
+        return true;
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::iterator skiplist_map<Key, T>::find(const key_type &key)
+    {
+        epoch_domain::guard guard(domain_);
+        Node *node = Seek(key, false);
+        if (node == nullptr || key < node->data.first)
+        {
+            return end();
+        }
+        return iterator(node, std::move(guard));
+    }
+
+    template <typename Key, typename T>
+    bool skiplist_map<Key, T>::contains(const key_type &key)
+    {
+        epoch_domain::guard guard(domain_);
+        Node *node = Seek(key, false);
+        return node != nullptr && !(key < node->data.first);
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::iterator skiplist_map<Key, T>::lower_bound(const key_type &key)
+    {
+        epoch_domain::guard guard(domain_);
+        Node *node = Seek(key, false);
+        return node == nullptr ? end() : iterator(node, std::move(guard));
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::iterator skiplist_map<Key, T>::upper_bound(const key_type &key)
+    {
+        epoch_domain::guard guard(domain_);
+        Node *node = Seek(key, true);
+        return node == nullptr ? end() : iterator(node, std::move(guard));
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::Node *skiplist_map<Key, T>::Ptr(uintptr_t link) noexcept
+    {
+        return reinterpret_cast<Node *>(link & ~uintptr_t(1));
+    }
+
+    template <typename Key, typename T>
+    uintptr_t skiplist_map<Key, T>::Raw(Node *node) noexcept
+    {
+        return reinterpret_cast<uintptr_t>(node);
+    }
+
+    template <typename Key, typename T>
+    bool skiplist_map<Key, T>::Marked(uintptr_t link) noexcept
+    {
+        return (link & 1) != 0;
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::Node *skiplist_map<Key, T>::NewNode(const value_type &value, int height)
+    {
+        // The tower of next pointers lives right behind the node.
+        void *raw = ::operator new(sizeof(Node) + sizeof(std::atomic<uintptr_t>) * static_cast<size_t>(height));
+        Node *node;
+        try
+        {
+            node = new (raw) Node(value, height);
+        }
+        catch (...)
+        {
+            ::operator delete(raw);
+            throw;
+        }
+        for (int level = 0; level < height; ++level)
+        {
+            new (&node->next[level]) std::atomic<uintptr_t>(0);
+        }
+        return node;
+    }
+
+    template <typename Key, typename T>
+    void skiplist_map<Key, T>::DeleteNode(void *node) noexcept
+    {
+        Node *typed = static_cast<Node *>(node);
+        typed->~Node();
+        ::operator delete(node);
+    }
+
+    template <typename Key, typename T>
+    int skiplist_map<Key, T>::RandomHeight() noexcept
+    {
+        static thread_local uint64_t state = 0x9E3779B97F4A7C15ull ^ reinterpret_cast<uintptr_t>(&state);
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        uint64_t bits = state;
+        int height = 1;
+        while (height < kMaxLevel && (bits & 3) == 0)
+        {
+            ++height;
+            bits >>= 2;
+        }
+        return height;
+    }
+
+    template <typename Key, typename T>
+    std::atomic<uintptr_t> &skiplist_map<Key, T>::Next(Node *pred, int level) noexcept
+    {
+        return pred == nullptr ? head_[level] : pred->next[level];
+    }
+
+    template <typename Key, typename T>
+    bool skiplist_map<Key, T>::Find(const key_type &key, Node **preds, Node **succs)
+    {
+        // Fills the last node before key and the first at or after it on
+        // every level (null stands for the head and for the end),
+        // unlinking marked nodes on the way.
+    retry:
+        Node *pred = nullptr;
+        for (int level = kMaxLevel - 1; level >= 0; --level)
+        {
+            Node *curr = Ptr(Next(pred, level).load());
+            while (curr != nullptr)
+            {
+                uintptr_t succ = curr->next[level].load();
+                while (Marked(succ))
+                {
+                    uintptr_t expected = Raw(curr);
+                    if (!Next(pred, level).compare_exchange_strong(expected, succ & ~uintptr_t(1)))
+                    {
+                        goto retry;
+                    }
+                    curr = Ptr(succ);
+                    if (curr == nullptr)
+                    {
+                        break;
+                    }
+                    succ = curr->next[level].load();
+                }
+                if (curr == nullptr || !(curr->data.first < key))
+                {
+                    break;
+                }
+                pred = curr;
+                curr = Ptr(succ);
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return succs[0] != nullptr && !(key < succs[0]->data.first);
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::Node *skiplist_map<Key, T>::Seek(const key_type &key, bool upper)
+    {
+        // Read-only descent: skips marked nodes without unlinking them, so
+        // readers never write to shared memory.
+        Node *pred = nullptr;
+        Node *curr = nullptr;
+        for (int level = kMaxLevel - 1; level >= 0; --level)
+        {
+            curr = Ptr(Next(pred, level).load());
+            while (curr != nullptr)
+            {
+                uintptr_t succ = curr->next[level].load();
+                if (Marked(succ))
+                {
+                    curr = Ptr(succ);
+                    continue;
+                }
+                bool before = upper ? !(key < curr->data.first) : curr->data.first < key;
+                if (!before)
+                {
+                    break;
+                }
+                pred = curr;
+                curr = Ptr(succ);
+            }
+        }
+        return curr;
+    }
+
+    template <typename Key, typename T>
+    void skiplist_map<Key, T>::Release(Node *node)
+    {
+        if (node->owners.fetch_sub(1) == 1)
+        {
+            domain_.retire(static_cast<void *>(node), &DeleteNode);
+        }
+    }
+
+    template <typename Key, typename T>
+    skiplist_map<Key, T>::SkipListIterator::SkipListIterator() noexcept : node_(nullptr) {}
+
+    template <typename Key, typename T>
+    skiplist_map<Key, T>::SkipListIterator::SkipListIterator(Node *node, epoch_domain::guard guard) noexcept
+        : node_(node),
+          guard_(std::move(guard)) {}
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::const_reference skiplist_map<Key, T>::SkipListIterator::operator*() const noexcept
+    {
+        return node_->data;
+    }
+
+    template <typename Key, typename T>
+    const typename skiplist_map<Key, T>::value_type *skiplist_map<Key, T>::SkipListIterator::operator->() const noexcept
+    {
+        return &node_->data;
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::SkipListIterator &skiplist_map<Key, T>::SkipListIterator::operator++() noexcept
+    {
+        Node *next = Ptr(node_->next[0].load());
+        while (next != nullptr && Marked(next->next[0].load()))
+        {
+            next = Ptr(next->next[0].load());
+        }
+        node_ = next;
+        if (node_ == nullptr)
+        {
+            guard_.release();
+        }
+        return *this;
+    }
+
+    template <typename Key, typename T>
+    typename skiplist_map<Key, T>::SkipListIterator skiplist_map<Key, T>::SkipListIterator::operator++(int) noexcept
+    {
+        SkipListIterator previous(*this);
+        ++*this;
+        return previous;
+    }
+
+    template <typename Key, typename T>
+    bool skiplist_map<Key, T>::SkipListIterator::operator==(const SkipListIterator &other) const noexcept
+    {
+        return node_ == other.node_;
+    }
+
+    template <typename Key, typename T>
+    bool skiplist_map<Key, T>::SkipListIterator::operator!=(const SkipListIterator &other) const noexcept
+    {
+        return node_ != other.node_;
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_SKIPLIST_MAP_H_
@@ -0,0 +1,557 @@
+#ifndef SRC_CONTAINERS_S21_SMALL_VECTOR_H_
+#define SRC_CONTAINERS_S21_SMALL_VECTOR_H_
+
+#include "s21_inline_buffer.h"
+
+namespace s21
+{
+    // Vector that keeps up to N elements inside the object itself and only
+    // spills to the heap past N. Elements are constructed on demand and are
+    // moved (not copied) between inline and heap storage.
+    template <typename T, size_t N = 8>
+    class small_vector
+    {
+        static_assert(N > 0, "small_vector needs at least one inline slot");
+
+    public:
+        // Small vector Member Type
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = T *;
+        using const_iterator = const T *;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+        // Small vector Member functions
+        small_vector() noexcept;
+        explicit small_vector(size_type n);
+        small_vector(std::initializer_list<value_type> const &items);
+        small_vector(const small_vector &v);
+        small_vector(small_vector &&v) noexcept;
+        ~small_vector();
+
+        small_vector &operator=(const small_vector &v);
+        small_vector &operator=(small_vector &&v) noexcept;
+        small_vector &operator=(std::initializer_list<value_type> const &items);
+
+        // Small vector Element access
+        reference at(size_type pos);
+        const_reference at(size_type pos) const;
+        reference operator[](size_type pos);
+        const_reference operator[](size_type pos) const;
+        const_reference front() const;
+        const_reference back() const;
+        T *data() noexcept;
+        const T *data() const noexcept;
+
+        // Small vector iterators
+        iterator begin() noexcept;
+        iterator end() noexcept;
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Small vector capacity
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+        size_type max_size() const noexcept;
+        void reserve(size_type size);
+        size_type capacity() const noexcept;
+        void shrink_to_fit();
+        bool is_inline() const noexcept;
+        static constexpr size_type inline_capacity() noexcept { return N; }
+
+        // Small vector modifiers
+        void clear() noexcept;
+        iterator insert(iterator pos, const_reference value);
+        void erase(iterator pos);
+        void push_back(const_reference value);
+        void pop_back();
+        void swap(small_vector &other);
+
+        template <typename... Args>
+        iterator insert_many(const_iterator pos, Args &&...args);
+        template <typename... Args>
+        void insert_many_back(Args &&...args);
+
+        // Small vector serialization
+        void save(std::ostream &os) const;
+        void load(std::istream &is);
+
+    private:
+        union InlineStorage
+        {
+            InlineStorage() {}
+            ~InlineStorage() {}
+            T items[N];
+        };
+
+        T *arr_;
+        size_type size_;
+        size_type capacity_;
+        InlineStorage inline_;
+
+        void stealFrom(small_vector &other) noexcept;
+        void relocateTo(T *storage, size_type capacity);
+        T *growFor(size_type incoming_amount);
+        void destroyElements() noexcept;
+        void releaseStorage() noexcept;
+        static T *allocateArray(size_type capacity);
+        static void freeArray(T *arr) noexcept;
+    };
+
+    // Small vector Member functions
+    template <typename T, size_t N>
+    small_vector<T, N>::small_vector() noexcept
+        : arr_(inline_.items), size_(0), capacity_(N) {}
+
+    template <typename T, size_t N>
+    small_vector<T, N>::small_vector(size_type n) : small_vector()
+    {
+        reserve(n);
+        for (; size_ < n; ++size_)
+        {
+            new (arr_ + size_) value_type();
+        }
+    }
+
+    template <typename T, size_t N>
+    small_vector<T, N>::small_vector(std::initializer_list<value_type> const &items)
+        : small_vector()
+    {
+        reserve(items.size());
+        for (const auto &item : items)
+        {
+            new (arr_ + size_++) value_type(item);
+        }
+    }
+
+    template <typename T, size_t N>
+    small_vector<T, N>::small_vector(const small_vector &v) : small_vector()
+    {
+        reserve(v.size_);
+        for (; size_ < v.size_; ++size_)
+        {
+            new (arr_ + size_) value_type(v.arr_[size_]);
+        }
+    }
+
+    template <typename T, size_t N>
+    small_vector<T, N>::small_vector(small_vector &&v) noexcept : small_vector()
+    {
+        stealFrom(v);
+    }
+
+    template <typename T, size_t N>
+    small_vector<T, N>::~small_vector()
+    {
+        destroyElements();
+        releaseStorage();
+    }
+
+    template <typename T, size_t N>
+    small_vector<T, N> &small_vector<T, N>::operator=(const small_vector &v)
+    {
+        if (this == &v)
+        {
+            return *this;
+        }
+        clear();
+        reserve(v.size_);
+        for (; size_ < v.size_; ++size_)
+        {
+            new (arr_ + size_) value_type(v.arr_[size_]);
+        }
+        return *this;
+    }
+
+    template <typename T, size_t N>
+    small_vector<T, N> &small_vector<T, N>::operator=(small_vector &&v) noexcept
+    {
+        if (this == &v)
+        {
+            return *this;
+        }
+        destroyElements();
+        releaseStorage();
+        stealFrom(v);
+        return *this;
+    }
+
+    template <typename T, size_t N>
+    small_vector<T, N> &small_vector<T, N>::operator=(
+        std::initializer_list<value_type> const &items)
+    {
+        clear();
+        reserve(items.size());
+        for (const auto &item : items)
+        {
+            new (arr_ + size_++) value_type(item);
+        }
+        return *this;
+    }
+
+    // Small vector Element access
+    template <typename T, size_t N>
+    typename small_vector<T, N>::reference small_vector<T, N>::at(size_type pos)
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("accessing small_vector element out of range");
+        }
+        return arr_[pos];
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::const_reference
+    small_vector<T, N>::at(size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("accessing small_vector element out of range");
+        }
+        return arr_[pos];
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::reference small_vector<T, N>::operator[](
+        size_type pos)
+    {
+        return arr_[pos];
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::const_reference small_vector<T, N>::operator[](
+        size_type pos) const
+    {
+        return arr_[pos];
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::const_reference small_vector<T, N>::front() const
+    {
+        return arr_[0];
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::const_reference small_vector<T, N>::back() const
+    {
+        return arr_[size_ - 1];
+    }
+
+    template <typename T, size_t N>
+    T *small_vector<T, N>::data() noexcept
+    {
+        return arr_;
+    }
+
+    template <typename T, size_t N>
+    const T *small_vector<T, N>::data() const noexcept
+    {
+        return arr_;
+    }
+
+    // Small vector iterators
+    template <typename T, size_t N>
+    typename small_vector<T, N>::iterator small_vector<T, N>::begin() noexcept
+    {
+        return arr_;
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::iterator small_vector<T, N>::end() noexcept
+    {
+        return arr_ + size_;
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::const_iterator small_vector<T, N>::cbegin()
+        const noexcept
+    {
+        return arr_;
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::const_iterator small_vector<T, N>::cend()
+        const noexcept
+    {
+        return arr_ + size_;
+    }
+
+    // Small vector capacity
+    template <typename T, size_t N>
+    bool small_vector<T, N>::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::size_type small_vector<T, N>::size() const noexcept
+    {
+        return size_;
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::size_type small_vector<T, N>::max_size()
+        const noexcept
+    {
+        return SIZE_MAX / sizeof(value_type);
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::reserve(size_type size)
+    {
+        if (size <= capacity_)
+        {
+            return;
+        }
+        relocateTo(allocateArray(size), size);
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::size_type small_vector<T, N>::capacity()
+        const noexcept
+    {
+        return capacity_;
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::shrink_to_fit()
+    {
+        if (is_inline() || size_ == capacity_)
+        {
+            return;
+        }
+        if (size_ <= N)
+        {
+            relocateTo(inline_.items, N);
+        }
+        else
+        {
+            relocateTo(allocateArray(size_), size_);
+        }
+    }
+
+    template <typename T, size_t N>
+    bool small_vector<T, N>::is_inline() const noexcept
+    {
+        return arr_ == inline_.items;
+    }
+
+    // Small vector modifiers
+    template <typename T, size_t N>
+    void small_vector<T, N>::clear() noexcept
+    {
+        destroyElements();
+        size_ = 0;
+    }
+
+    template <typename T, size_t N>
+    typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+        iterator pos, const_reference value)
+    {
+        return insert_many(pos, value);
+    }
+
+    template <typename T, size_t N>
+    template <typename... Args>
+    typename small_vector<T, N>::iterator small_vector<T, N>::insert_many(
+        const_iterator pos, Args &&...args)
+    {
+        size_type index = pos - cbegin();
+        T *items = inline_buffer::insert_many(
+            arr_, size_, index,
+            [this](size_type amount) { return growFor(amount); },
+            std::forward<Args>(args)...);
+        return items + index;
+    }
+
+    template <typename T, size_t N>
+    template <typename... Args>
+    void small_vector<T, N>::insert_many_back(Args &&...args)
+    {
+        insert_many(cend(), std::forward<Args>(args)...);
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::erase(iterator pos)
+    {
+        for (iterator next = pos + 1; next != end(); ++pos, ++next)
+        {
+            *pos = std::move(*next);
+        }
+        pop_back();
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::push_back(const_reference value)
+    {
+        if (size_ < capacity_)
+        {
+            new (arr_ + size_) value_type(value);
+            ++size_;
+            return;
+        }
+
+        value_type item(value);
+        growFor(1);
+        new (arr_ + size_) value_type(std::move(item));
+        ++size_;
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::pop_back()
+    {
+        --size_;
+        arr_[size_].~value_type();
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::swap(small_vector &other)
+    {
+        std::swap(*this, other);
+    }
+
+    // Small vector serialization
+    template <typename T, size_t N>
+    void small_vector<T, N>::save(std::ostream &os) const
+    {
+        serial::write_header(os, serial_kind::kSmallVector, size_);
+        serial::write_array(os, arr_, size_);
+        serial::check_written(os);
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::load(std::istream &is)
+    {
+        uint64_t count = serial::read_header(is, serial_kind::kSmallVector);
+        if (count > max_size())
+        {
+            throw std::invalid_argument("s21::load: corrupt small_vector size");
+        }
+
+        small_vector loaded;
+        inline_buffer::load<value_type>(
+            is, count, "s21::load: corrupt small_vector size", loaded.size_,
+            [&loaded](size_type amount) { return loaded.growFor(amount); });
+        swap(loaded);
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::stealFrom(small_vector &other) noexcept
+    {
+        if (other.is_inline())
+        {
+            arr_ = inline_.items;
+            capacity_ = N;
+            for (size_ = 0; size_ < other.size_; ++size_)
+            {
+                new (arr_ + size_) value_type(std::move(other.arr_[size_]));
+            }
+            other.clear();
+            return;
+        }
+
+        arr_ = other.arr_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+
+        other.arr_ = other.inline_.items;
+        other.size_ = 0;
+        other.capacity_ = N;
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::relocateTo(T *storage, size_type capacity)
+    {
+        // If a move throws, the elements stay in the old storage; the ones
+        // already moved are destroyed and the new storage is freed.
+        size_type moved = 0;
+        try
+        {
+            for (; moved < size_; ++moved)
+            {
+                new (storage + moved) value_type(std::move(arr_[moved]));
+            }
+        }
+        catch (...)
+        {
+            for (size_type i = 0; i < moved; ++i)
+            {
+                storage[i].~value_type();
+            }
+            if (storage != inline_.items)
+            {
+                freeArray(storage);
+            }
+            throw;
+        }
+        destroyElements();
+        releaseStorage();
+        arr_ = storage;
+        capacity_ = capacity;
+    }
+
+    template <typename T, size_t N>
+    T *small_vector<T, N>::growFor(size_type incoming_amount)
+    {
+        if (size_ + incoming_amount <= capacity_)
+        {
+            return arr_;
+        }
+
+        size_type capacity = capacity_ * 2;
+        if (capacity < size_ + incoming_amount)
+        {
+            capacity = size_ + incoming_amount;
+        }
+        relocateTo(allocateArray(capacity), capacity);
+        return arr_;
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::destroyElements() noexcept
+    {
+        for (size_type i = 0; i < size_; ++i)
+        {
+            arr_[i].~value_type();
+        }
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::releaseStorage() noexcept
+    {
+        if (!is_inline())
+        {
+            freeArray(arr_);
+        }
+        arr_ = inline_.items;
+        capacity_ = N;
+    }
+
+    template <typename T, size_t N>
+    T *small_vector<T, N>::allocateArray(size_type capacity)
+    {
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            return static_cast<T *>(::operator new(
+                capacity * sizeof(value_type), std::align_val_t(alignof(T))));
+        }
+        return static_cast<T *>(::operator new(capacity * sizeof(value_type)));
+    }
+
+    template <typename T, size_t N>
+    void small_vector<T, N>::freeArray(T *arr) noexcept
+    {
+        if constexpr (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+        {
+            ::operator delete(arr, std::align_val_t(alignof(T)));
+        }
+        else
+        {
+            ::operator delete(arr);
+        }
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_SMALL_VECTOR_H_
@@ -0,0 +1,247 @@
+#ifndef SRC_CONTAINERS_S21_SORTED_VECTOR_VIEW_H_
+#define SRC_CONTAINERS_S21_SORTED_VECTOR_VIEW_H_
+
+#include "s21_eytzinger.h"
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Lookup view over a sorted contiguous range, e.g. an s21::vector used
+    // as a table. Searches are branchless: the loop always runs log2(n)
+    // steps and picks the next half with a conditional move, so it costs
+    // no mispredictions. build_index() adds an Eytzinger-ordered copy of
+    // the keys for ranges past the cache, where the search prefetches a
+    // few levels ahead. The view does not own the range; the index goes
+    // stale if the range changes and must be rebuilt.
+    template <typename T>
+    class sorted_vector_view
+    {
+    public:
+        using value_type = T;
+        using const_reference = const T &;
+        using const_iterator = const T *;
+        using iterator = const_iterator;
+        using size_type = size_t;
+
+        sorted_vector_view() noexcept;
+        sorted_vector_view(const_iterator first, const_iterator last) noexcept;
+        template <typename Container>
+        explicit sorted_vector_view(Container &source) noexcept;
+
+        // Element access
+        const_reference operator[](size_type pos) const noexcept;
+        const_iterator data() const noexcept;
+
+        // Iterators
+        const_iterator begin() const noexcept;
+        const_iterator end() const noexcept;
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Capacity
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+
+        // Lookup
+        const_iterator lower_bound(const value_type &key) const noexcept;
+        const_iterator upper_bound(const value_type &key) const noexcept;
+        const_iterator find(const value_type &key) const noexcept;
+        bool contains(const value_type &key) const noexcept;
+
+        // Eytzinger index
+        void build_index();
+        void drop_index() noexcept;
+        bool has_index() const noexcept;
+
+    private:
+        // Below this many bytes the range sits in L1/L2 and prefetching
+        // only adds instructions.
+        static constexpr size_type kPrefetchBytes = 64 * 1024;
+
+        const T *data_;
+        size_type size_;
+        vector<T> index_;
+        bool indexed_;
+
+        template <bool kUpper, bool kPrefetch>
+        const_iterator branchlessSearch(const value_type &key) const noexcept;
+        size_type rank(size_type k) const noexcept;
+        template <bool kUpper>
+        const_iterator search(const value_type &key) const noexcept;
+    };
+
+
+    template <typename T>
+    sorted_vector_view<T>::sorted_vector_view() noexcept : data_(nullptr), size_(0), indexed_(false) {}
+
+    template <typename T>
+    sorted_vector_view<T>::sorted_vector_view(const_iterator first, const_iterator last) noexcept
+        : data_(first),
+          size_(static_cast<size_type>(last - first)),
+          indexed_(false) {}
+
+    template <typename T>
+    template <typename Container>
+    sorted_vector_view<T>::sorted_vector_view(Container &source) noexcept
+        : sorted_vector_view(source.begin(), source.end()) {}
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_reference sorted_vector_view<T>::operator[](size_type pos) const noexcept
+    {
+        return data_[pos];
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::data() const noexcept
+    {
+        return data_;
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::begin() const noexcept
+    {
+        return data_;
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::end() const noexcept
+    {
+        return data_ + size_;
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::cend() const noexcept
+    {
+        return end();
+    }
+
+    template <typename T>
+    bool sorted_vector_view<T>::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::size_type sorted_vector_view<T>::size() const noexcept
+    {
+        return size_;
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::lower_bound(const value_type &key) const noexcept
+    {
+        return search<false>(key);
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::upper_bound(const value_type &key) const noexcept
+    {
+        return search<true>(key);
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::find(const value_type &key) const noexcept
+    {
+        const_iterator iter = lower_bound(key);
+        return iter != end() && !(key < *iter) ? iter : end();
+    }
+
+    template <typename T>
+    bool sorted_vector_view<T>::contains(const value_type &key) const noexcept
+    {
+        return find(key) != end();
+    }
+
+    template <typename T>
+    void sorted_vector_view<T>::build_index()
+    {
+        vector<T> index(size_);
+        eytzinger::layout(data_, size_, index.begin());
+        index_.swap(index);
+        indexed_ = true;
+    }
+
+    template <typename T>
+    void sorted_vector_view<T>::drop_index() noexcept
+    {
+        vector<T>().swap(index_);
+        indexed_ = false;
+    }
+
+    template <typename T>
+    bool sorted_vector_view<T>::has_index() const noexcept
+    {
+        return indexed_;
+    }
+
+    template <typename T>
+    typename sorted_vector_view<T>::size_type sorted_vector_view<T>::rank(size_type k) const noexcept
+    {
+        // In-order position of node k, computed instead of stored so a
+        // lookup costs no second cache miss. In a perfect tree with the
+        // same depth as ours, the node at depth d sits at odd multiple
+        // (2(k - 2^d) + 1) of 2^(depth - d), minus one; then subtract the
+        // bottom-level slots before it that our partial last level lacks.
+        const int depth = 63 - __builtin_clzll(size_);
+        const int level = 63 - __builtin_clzll(k);
+        const size_type offset = k - (size_type(1) << level);
+        const size_type perfect = ((2 * offset + 1) << (depth - level)) - 1;
+        const size_type leaves = size_ - ((size_type(1) << depth) - 1);
+        const size_type slots = (perfect + 1) / 2;
+        return slots > leaves ? perfect - (slots - leaves) : perfect;
+    }
+
+    template <typename T>
+    template <bool kUpper>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::search(const value_type &key) const noexcept
+    {
+        if (size_ == 0)
+        {
+            return data_;
+        }
+        if (indexed_)
+        {
+            size_type k = kUpper ? eytzinger::upper_bound(index_.cbegin(), size_, key)
+                                 : eytzinger::lower_bound(index_.cbegin(), size_, key);
+            return k == 0 ? end() : data_ + rank(k);
+        }
+        if (size_ * sizeof(T) >= kPrefetchBytes)
+        {
+            return branchlessSearch<kUpper, true>(key);
+        }
+        return branchlessSearch<kUpper, false>(key);
+    }
+
+    template <typename T>
+    template <bool kUpper, bool kPrefetch>
+    typename sorted_vector_view<T>::const_iterator sorted_vector_view<T>::branchlessSearch(const value_type &key) const noexcept
+    {
+        // The answer stays within [base, base + n]; each step drops the
+        // half that cannot hold it without branching on the comparison.
+        const T *base = data_;
+        size_type n = size_;
+        while (n > 1)
+        {
+            size_type half = n / 2;
+            if (kPrefetch)
+            {
+                // Both candidates for the next midpoint.
+                __builtin_prefetch(base + half / 2);
+                __builtin_prefetch(base + half + half / 2);
+            }
+            bool right = kUpper ? !(key < base[half]) : base[half] < key;
+            base = right ? base + half : base;
+            n -= half;
+        }
+        bool past = kUpper ? !(key < *base) : *base < key;
+        return base + past;
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_SORTED_VECTOR_VIEW_H_
@@ -45,6 +45,22 @@ namespace s21
             list_.insert_many_back(args...);
         }
 
+        // Stack serialization, bottom to top
+        void save(std::ostream &os) const
+        {
+            serial::write_sequence(os, serial_kind::kStack, list_.cbegin(),
+                                   list_.cend(), list_.size());
+        }
+
+        void load(std::istream &is)
+        {
+            list<T> loaded;
+            serial::read_sequence<value_type>(
+                is, serial_kind::kStack,
+                [&loaded](value_type &&item) { loaded.push_back(item); });
+            list_.swap(loaded);
+        }
+
     private:
         list<T> list_;
     };
@@ -0,0 +1,415 @@
+#ifndef SRC_CONTAINERS_S21_STATIC_VECTOR_H_
+#define SRC_CONTAINERS_S21_STATIC_VECTOR_H_
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_inline_buffer.h"
+
+namespace s21
+{
+    // Vector with a fixed capacity of N elements stored inside the object:
+    // it never touches the heap. Unlike s21::array, slots past size() hold
+    // no objects; elements are constructed when added and destroyed when
+    // removed. Growing past N throws std::length_error.
+    template <typename T, size_t N>
+    class static_vector
+    {
+        static_assert(N > 0, "static_vector needs at least one slot");
+
+    public:
+        // Static vector Member Type
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = T *;
+        using const_iterator = const T *;
+        using size_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+        // Static vector Member functions
+        static_vector() noexcept : size_(0) {}
+        explicit static_vector(size_type n);
+        static_vector(std::initializer_list<value_type> const &items);
+        static_vector(const static_vector &v);
+        static_vector(static_vector &&v) noexcept(
+            std::is_nothrow_move_constructible_v<T>);
+        ~static_vector();
+
+        static_vector &operator=(const static_vector &v);
+        static_vector &operator=(static_vector &&v) noexcept(
+            std::is_nothrow_move_constructible_v<T>);
+        static_vector &operator=(
+            std::initializer_list<value_type> const &items);
+
+        // Static vector Element access
+        reference at(size_type pos);
+        reference operator[](size_type pos);
+        const_reference front() const;
+        const_reference back() const;
+        T *data() noexcept;
+
+        // Static vector iterators
+        iterator begin() noexcept;
+        iterator end() noexcept;
+        const_iterator cbegin() const noexcept;
+        const_iterator cend() const noexcept;
+
+        // Static vector capacity
+        constexpr bool empty() const noexcept { return size_ == 0; }
+        constexpr size_type size() const noexcept { return size_; }
+        static constexpr size_type max_size() noexcept { return N; }
+        static constexpr size_type capacity() noexcept { return N; }
+        void reserve(size_type size);
+        void shrink_to_fit() noexcept {}
+
+        // Static vector modifiers
+        void clear() noexcept;
+        iterator insert(iterator pos, const_reference value);
+        void erase(iterator pos);
+        iterator erase(const_iterator first, const_iterator last);
+        void push_back(const_reference value);
+        void push_back(value_type &&value);
+        void pop_back();
+        void swap(static_vector &other);
+
+        template <typename... Args>
+        iterator insert_many(const_iterator pos, Args &&...args);
+        template <typename... Args>
+        void insert_many_back(Args &&...args);
+
+        // Static vector serialization
+        void save(std::ostream &os) const;
+        void load(std::istream &is);
+
+    private:
+        union Storage
+        {
+            Storage() {}
+            ~Storage() {}
+            T items[N];
+        };
+
+        size_type size_;
+        Storage storage_;
+
+        T *checkRoomFor(size_type incoming_amount);
+        void destroyFrom(size_type index) noexcept;
+    };
+
+    // Static vector Member functions
+    template <typename T, size_t N>
+    static_vector<T, N>::static_vector(size_type n) : static_vector()
+    {
+        checkRoomFor(n);
+        for (; size_ < n; ++size_)
+        {
+            new (storage_.items + size_) value_type();
+        }
+    }
+
+    template <typename T, size_t N>
+    static_vector<T, N>::static_vector(
+        std::initializer_list<value_type> const &items)
+        : static_vector()
+    {
+        checkRoomFor(items.size());
+        for (const auto &item : items)
+        {
+            new (storage_.items + size_++) value_type(item);
+        }
+    }
+
+    template <typename T, size_t N>
+    static_vector<T, N>::static_vector(const static_vector &v) : static_vector()
+    {
+        for (; size_ < v.size_; ++size_)
+        {
+            new (storage_.items + size_) value_type(v.storage_.items[size_]);
+        }
+    }
+
+    template <typename T, size_t N>
+    static_vector<T, N>::static_vector(static_vector &&v) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+        : static_vector()
+    {
+        // Inline storage cannot be stolen: elements move one by one and
+        // the source is left empty.
+        for (; size_ < v.size_; ++size_)
+        {
+            new (storage_.items + size_)
+                value_type(std::move(v.storage_.items[size_]));
+        }
+        v.clear();
+    }
+
+    template <typename T, size_t N>
+    static_vector<T, N>::~static_vector()
+    {
+        destroyFrom(0);
+    }
+
+    template <typename T, size_t N>
+    static_vector<T, N> &static_vector<T, N>::operator=(const static_vector &v)
+    {
+        if (this == &v)
+        {
+            return *this;
+        }
+        clear();
+        for (; size_ < v.size_; ++size_)
+        {
+            new (storage_.items + size_) value_type(v.storage_.items[size_]);
+        }
+        return *this;
+    }
+
+    template <typename T, size_t N>
+    static_vector<T, N> &
+    static_vector<T, N>::operator=(static_vector &&v) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+    {
+        if (this == &v)
+        {
+            return *this;
+        }
+        clear();
+        for (; size_ < v.size_; ++size_)
+        {
+            new (storage_.items + size_)
+                value_type(std::move(v.storage_.items[size_]));
+        }
+        v.clear();
+        return *this;
+    }
+
+    template <typename T, size_t N>
+    static_vector<T, N> &static_vector<T, N>::operator=(
+        std::initializer_list<value_type> const &items)
+    {
+        checkRoomFor(items.size() > size_ ? items.size() - size_ : 0);
+        clear();
+        for (const auto &item : items)
+        {
+            new (storage_.items + size_++) value_type(item);
+        }
+        return *this;
+    }
+
+    // Static vector Element access
+    template <typename T, size_t N>
+    typename static_vector<T, N>::reference
+    static_vector<T, N>::at(size_type pos)
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range(
+                "accessing static_vector element out of range");
+        }
+        return storage_.items[pos];
+    }
+
+    template <typename T, size_t N>
+    typename static_vector<T, N>::reference
+    static_vector<T, N>::operator[](size_type pos)
+    {
+        return storage_.items[pos];
+    }
+
+    template <typename T, size_t N>
+    typename static_vector<T, N>::const_reference
+    static_vector<T, N>::front() const
+    {
+        return storage_.items[0];
+    }
+
+    template <typename T, size_t N>
+    typename static_vector<T, N>::const_reference
+    static_vector<T, N>::back() const
+    {
+        return storage_.items[size_ - 1];
+    }
+
+    template <typename T, size_t N>
+    T *static_vector<T, N>::data() noexcept
+    {
+        return storage_.items;
+    }
+
+    // Static vector iterators
+    template <typename T, size_t N>
+    typename static_vector<T, N>::iterator static_vector<T, N>::begin() noexcept
+    {
+        return storage_.items;
+    }
+
+    template <typename T, size_t N>
+    typename static_vector<T, N>::iterator static_vector<T, N>::end() noexcept
+    {
+        return storage_.items + size_;
+    }
+
+    template <typename T, size_t N>
+    typename static_vector<T, N>::const_iterator
+    static_vector<T, N>::cbegin() const noexcept
+    {
+        return storage_.items;
+    }
+
+    template <typename T, size_t N>
+    typename static_vector<T, N>::const_iterator
+    static_vector<T, N>::cend() const noexcept
+    {
+        return storage_.items + size_;
+    }
+
+    // Static vector capacity
+    template <typename T, size_t N>
+    void static_vector<T, N>::reserve(size_type size)
+    {
+        if (size > N)
+        {
+            throw std::length_error(
+                "static_vector cannot reserve past its capacity");
+        }
+    }
+
+    // Static vector modifiers
+    template <typename T, size_t N>
+    void static_vector<T, N>::clear() noexcept
+    {
+        destroyFrom(0);
+    }
+
+    template <typename T, size_t N>
+    typename static_vector<T, N>::iterator
+    static_vector<T, N>::insert(iterator pos, const_reference value)
+    {
+        return insert_many(pos, value);
+    }
+
+    template <typename T, size_t N>
+    void static_vector<T, N>::erase(iterator pos)
+    {
+        erase(pos, pos + 1);
+    }
+
+    template <typename T, size_t N>
+    typename static_vector<T, N>::iterator
+    static_vector<T, N>::erase(const_iterator first, const_iterator last)
+    {
+        iterator dest = begin() + (first - cbegin());
+        iterator tail = begin() + (last - cbegin());
+        if (dest == tail)
+        {
+            return dest;
+        }
+        iterator out = std::move(tail, end(), dest);
+        destroyFrom(out - begin());
+        return dest;
+    }
+
+    template <typename T, size_t N>
+    void static_vector<T, N>::push_back(const_reference value)
+    {
+        checkRoomFor(1);
+        new (storage_.items + size_) value_type(value);
+        ++size_;
+    }
+
+    template <typename T, size_t N>
+    void static_vector<T, N>::push_back(value_type &&value)
+    {
+        checkRoomFor(1);
+        new (storage_.items + size_) value_type(std::move(value));
+        ++size_;
+    }
+
+    template <typename T, size_t N>
+    void static_vector<T, N>::pop_back()
+    {
+        --size_;
+        storage_.items[size_].~value_type();
+    }
+
+    template <typename T, size_t N>
+    void static_vector<T, N>::swap(static_vector &other)
+    {
+        std::swap(*this, other);
+    }
+
+    template <typename T, size_t N>
+    template <typename... Args>
+    typename static_vector<T, N>::iterator
+    static_vector<T, N>::insert_many(const_iterator pos, Args &&...args)
+    {
+        size_type index = pos - cbegin();
+        if constexpr (sizeof...(args) > 0)
+        {
+            // Fail before building the arguments when they cannot fit.
+            checkRoomFor(sizeof...(args));
+        }
+        inline_buffer::insert_many(
+            storage_.items, size_, index,
+            [this](size_type amount) { return checkRoomFor(amount); },
+            std::forward<Args>(args)...);
+        return storage_.items + index;
+    }
+
+    template <typename T, size_t N>
+    template <typename... Args>
+    void static_vector<T, N>::insert_many_back(Args &&...args)
+    {
+        insert_many(cend(), std::forward<Args>(args)...);
+    }
+
+    // Static vector serialization
+    template <typename T, size_t N>
+    void static_vector<T, N>::save(std::ostream &os) const
+    {
+        serial::write_header(os, serial_kind::kStaticVector, size_);
+        serial::write_array(os, storage_.items, size_);
+        serial::check_written(os);
+    }
+
+    template <typename T, size_t N>
+    void static_vector<T, N>::load(std::istream &is)
+    {
+        uint64_t count = serial::read_header(is, serial_kind::kStaticVector);
+        if (count > N)
+        {
+            throw std::invalid_argument(
+                "s21::load: corrupt static_vector size");
+        }
+
+        static_vector loaded;
+        inline_buffer::load<value_type>(
+            is, count, "s21::load: corrupt static_vector size", loaded.size_,
+            [&loaded](size_type amount)
+            { return loaded.checkRoomFor(amount); });
+        swap(loaded);
+    }
+
+    template <typename T, size_t N>
+    T *static_vector<T, N>::checkRoomFor(size_type incoming_amount)
+    {
+        if (incoming_amount > N - size_)
+        {
+            throw std::length_error("static_vector capacity exceeded");
+        }
+        return storage_.items;
+    }
+
+    template <typename T, size_t N>
+    void static_vector<T, N>::destroyFrom(size_type index) noexcept
+    {
+        for (size_type i = index; i < size_; ++i)
+        {
+            storage_.items[i].~value_type();
+        }
+        size_ = index;
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_STATIC_VECTOR_H_
@@ -0,0 +1,201 @@
+#ifndef SRC_CONTAINERS_S21_STORAGE_POLICY_H_
+#define SRC_CONTAINERS_S21_STORAGE_POLICY_H_
+
+#include <sys/mman.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace s21
+{
+    // Storage policies own a vector's buffer. allocate returns `capacity`
+    // value-initialized elements; reallocate moves the first `size` of them
+    // into a buffer of `new_capacity` value-initialized elements and
+    // releases the old one.
+
+    // Plain new[] / delete[], the default.
+    struct new_storage
+    {
+        template <typename T>
+        static T *allocate(size_t capacity);
+        template <typename T>
+        static T *reallocate(T *arr, size_t size, size_t capacity,
+                             size_t new_capacity);
+        template <typename T>
+        static void deallocate(T *arr, size_t capacity) noexcept;
+    };
+
+    // For trivial types only. Buffers of at least Threshold bytes are
+    // anonymous mappings advised to use transparent huge pages: they are
+    // zero-filled lazily by the kernel and grow with mremap, without
+    // copying. Smaller buffers come from calloc.
+    template <size_t Threshold = (size_t(1) << 21)>
+    struct mmap_storage
+    {
+        template <typename T>
+        static T *allocate(size_t capacity);
+        template <typename T>
+        static T *reallocate(T *arr, size_t size, size_t capacity,
+                             size_t new_capacity);
+        template <typename T>
+        static void deallocate(T *arr, size_t capacity) noexcept;
+
+    private:
+        static bool isMapped(size_t bytes) noexcept;
+        static void *mapBytes(size_t bytes);
+        static void *allocateBytes(size_t bytes);
+        static void freeBytes(void *ptr, size_t bytes) noexcept;
+    };
+
+
+    template <typename T>
+    T *new_storage::allocate(size_t capacity)
+    {
+        return new T[capacity]();
+    }
+
+    template <typename T>
+    T *new_storage::reallocate(T *arr, size_t size, size_t capacity,
+                               size_t new_capacity)
+    {
+        T *reallocated = new T[new_capacity]();
+        for (size_t i = 0; i < size && i < new_capacity; ++i)
+        {
+            reallocated[i] = std::move(arr[i]);
+        }
+        deallocate(arr, capacity);
+        return reallocated;
+    }
+
+    template <typename T>
+    void new_storage::deallocate(T *arr, size_t) noexcept
+    {
+        delete[] arr;
+    }
+
+    template <size_t Threshold>
+    template <typename T>
+    T *mmap_storage<Threshold>::allocate(size_t capacity)
+    {
+        static_assert(std::is_trivial_v<T>,
+                      "mmap_storage relies on zero pages for value-init");
+
+        return static_cast<T *>(allocateBytes(capacity * sizeof(T)));
+    }
+
+    template <size_t Threshold>
+    template <typename T>
+    T *mmap_storage<Threshold>::reallocate(T *arr, size_t size,
+                                           size_t capacity,
+                                           size_t new_capacity)
+    {
+        size_t old_bytes = capacity * sizeof(T);
+        size_t new_bytes = new_capacity * sizeof(T);
+
+        if (arr != nullptr && isMapped(old_bytes) && isMapped(new_bytes))
+        {
+#ifdef MREMAP_MAYMOVE
+            void *moved = mremap(arr, old_bytes, new_bytes, MREMAP_MAYMOVE);
+            if (moved == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+#ifdef MADV_HUGEPAGE
+            madvise(moved, new_bytes, MADV_HUGEPAGE);
+#endif
+            return static_cast<T *>(moved);
+#endif
+        }
+        if (arr != nullptr && !isMapped(old_bytes) && !isMapped(new_bytes))
+        {
+            void *grown = std::realloc(arr, new_bytes ? new_bytes : 1);
+            if (grown == nullptr)
+            {
+                throw std::bad_alloc();
+            }
+            if (new_bytes > old_bytes)
+            {
+                std::memset(static_cast<char *>(grown) + old_bytes, 0,
+                            new_bytes - old_bytes);
+            }
+            return static_cast<T *>(grown);
+        }
+
+        T *reallocated = allocate<T>(new_capacity);
+        if (size > new_capacity)
+        {
+            size = new_capacity;
+        }
+        if (size > 0)
+        {
+            std::memcpy(reallocated, arr, size * sizeof(T));
+        }
+        deallocate(arr, capacity);
+        return reallocated;
+    }
+
+    template <size_t Threshold>
+    template <typename T>
+    void mmap_storage<Threshold>::deallocate(T *arr, size_t capacity) noexcept
+    {
+        if (arr != nullptr)
+        {
+            freeBytes(arr, capacity * sizeof(T));
+        }
+    }
+
+    template <size_t Threshold>
+    bool mmap_storage<Threshold>::isMapped(size_t bytes) noexcept
+    {
+        return bytes >= Threshold;
+    }
+
+    template <size_t Threshold>
+    void *mmap_storage<Threshold>::mapBytes(size_t bytes)
+    {
+        void *ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (ptr == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+#ifdef MADV_HUGEPAGE
+        // Only advice: without transparent huge pages this is a no-op.
+        madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+        return ptr;
+    }
+
+    template <size_t Threshold>
+    void *mmap_storage<Threshold>::allocateBytes(size_t bytes)
+    {
+        if (isMapped(bytes))
+        {
+            return mapBytes(bytes);
+        }
+        void *ptr = std::calloc(bytes ? bytes : 1, 1);
+        if (ptr == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+    template <size_t Threshold>
+    void mmap_storage<Threshold>::freeBytes(void *ptr, size_t bytes) noexcept
+    {
+        if (isMapped(bytes))
+        {
+            munmap(ptr, bytes);
+        }
+        else
+        {
+            std::free(ptr);
+        }
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_STORAGE_POLICY_H_
@@ -0,0 +1,519 @@
+#ifndef SRC_CONTAINERS_S21_THREAD_POOL_H_
+#define SRC_CONTAINERS_S21_THREAD_POOL_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "s21_list.h"
+#include "s21_ws_deque.h"
+
+namespace s21
+{
+    // Work-stealing scheduler. Each worker owns a Chase-Lev deque: it
+    // pushes and pops its own tasks at the bottom without locks, so nested
+    // work stays hot in its cache, and steals from the top of the others'
+    // deques when it runs dry. Threads outside the pool post into a shared
+    // injection list, which workers drain oldest first. A pool of zero
+    // workers is valid: whoever waits runs the tasks.
+    class thread_pool
+    {
+    public:
+        using size_type = size_t;
+        using task_type = std::function<void()>;
+
+        // Per-worker counters, for tuning grain sizes and spotting idle
+        // workers. Updated by the owning worker only.
+        struct worker_stats
+        {
+            uint64_t executed = 0;
+            uint64_t stolen = 0;
+            uint64_t failed_steals = 0;
+            uint64_t sleeps = 0;
+            uint64_t idle_ns = 0;
+        };
+
+        explicit thread_pool(size_type threads = default_threads());
+        thread_pool(const thread_pool &other) = delete;
+        // Runs whatever is still queued, then joins the workers.
+        ~thread_pool();
+
+        thread_pool &operator=(const thread_pool &other) = delete;
+
+        // Number of worker threads.
+        size_type size() const noexcept;
+        // One worker per hardware thread, less the caller's own.
+        static size_type default_threads() noexcept;
+        // Pool shared by callers that do not pass their own.
+        static thread_pool &global();
+
+        // Queues a task, which must not throw. From a worker of this pool
+        // it goes to that worker's deque, otherwise to the injection list.
+        void post(task_type task);
+        // Queues fn and returns a future for its result or exception.
+        // Blocking on the future inside a task ties up a worker; nested
+        // work should use task_group, whose wait() helps instead.
+        template <typename F>
+        auto submit(F &&fn) -> std::future<std::invoke_result_t<std::decay_t<F> &>>;
+        // Calls body(i) for every i in [first, last), splitting the range
+        // in halves down to `grain` indices (0 picks about eight pieces
+        // per thread) so idle workers steal large pieces first.
+        template <typename F>
+        void parallel_for(size_type first, size_type last, F body, size_type grain = 0);
+        // Returns once every task posted so far has finished, running
+        // queued tasks meanwhile. Not for use from inside a task.
+        void wait();
+        // Runs one queued task on the calling thread, if there is one.
+        bool run_pending();
+
+        worker_stats stats(size_type worker) const;
+        void reset_stats() noexcept;
+
+    private:
+        struct alignas(64) Worker
+        {
+            ws_deque<task_type *> deque;
+            std::atomic<uint64_t> executed{0};
+            std::atomic<uint64_t> stolen{0};
+            std::atomic<uint64_t> failed_steals{0};
+            std::atomic<uint64_t> sleeps{0};
+            std::atomic<uint64_t> idle_ns{0};
+        };
+
+        // Yields before a worker with nothing to do goes to sleep.
+        static constexpr int kSpins = 64;
+
+        size_type size_;
+        std::unique_ptr<Worker[]> workers_;
+        std::mutex injection_mutex_;
+        list<task_type *> injection_;
+        std::vector<std::thread> threads_;
+        std::atomic<size_type> queued_;
+        std::atomic<size_type> outstanding_;
+        std::atomic<size_type> sleeping_;
+        std::mutex sleep_mutex_;
+        std::condition_variable wake_;
+        bool stopping_;
+
+        static thread_pool *&CurrentPool() noexcept;
+        static size_type &CurrentIndex() noexcept;
+        static void Bump(std::atomic<uint64_t> &counter, uint64_t amount = 1) noexcept;
+
+        Worker *Self() noexcept;
+        void WorkerLoop(size_type index);
+        bool TakeTask(task_type *&task);
+        void Execute(task_type *task);
+        template <typename F>
+        void SplitFor(size_type first, size_type last, F &body, size_type grain);
+    };
+
+    // Fork-join scope over a pool: run() queues tasks, wait() returns once
+    // all of them are done, running queued tasks itself in the meantime so
+    // nested groups cannot starve the pool. The first exception a task
+    // throws is rethrown from wait().
+    class task_group
+    {
+    public:
+        using size_type = size_t;
+
+        explicit task_group(thread_pool &pool = thread_pool::global()) noexcept;
+        task_group(const task_group &other) = delete;
+        ~task_group();
+
+        task_group &operator=(const task_group &other) = delete;
+
+        template <typename F>
+        void run(F &&task);
+        void wait();
+
+    private:
+        thread_pool &pool_;
+        std::atomic<size_type> pending_;
+        std::mutex error_mutex_;
+        std::exception_ptr error_;
+
+        void drain() noexcept;
+    };
+
+
+    inline thread_pool::thread_pool(size_type threads)
+        : size_(threads),
+          workers_(new Worker[threads == 0 ? 1 : threads]),
+          queued_(0),
+          outstanding_(0),
+          sleeping_(0),
+          stopping_(false)
+    {
+        threads_.reserve(threads);
+        for (size_type i = 0; i < threads; ++i)
+        {
+            threads_.emplace_back([this, i] { WorkerLoop(i); });
+        }
+    }
+
+    inline thread_pool::~thread_pool()
+    {
+        wait();
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread &thread : threads_)
+        {
+            thread.join();
+        }
+    }
+
+    inline thread_pool::size_type thread_pool::size() const noexcept
+    {
+        return size_;
+    }
+
+    inline thread_pool::size_type thread_pool::default_threads() noexcept
+    {
+        unsigned hardware = std::thread::hardware_concurrency();
+        return hardware > 1 ? hardware - 1 : 0;
+    }
+
+    inline thread_pool &thread_pool::global()
+    {
+        static thread_pool pool;
+        return pool;
+    }
+
+    inline void thread_pool::post(task_type task)
+    {
+        std::unique_ptr<task_type> node(new task_type(std::move(task)));
+        // Count first so a taker never drives the counters below zero.
+        outstanding_.fetch_add(1);
+        queued_.fetch_add(1);
+        try
+        {
+            Worker *self = Self();
+            if (self != nullptr)
+            {
+                self->deque.push(node.get());
+            }
+            else
+            {
+                std::lock_guard<std::mutex> lock(injection_mutex_);
+                injection_.push_back(node.get());
+            }
+        }
+        catch (...)
+        {
+            queued_.fetch_sub(1);
+            outstanding_.fetch_sub(1);
+            throw;
+        }
+        node.release();
+        // Pairs with the sleeper raising sleeping_ before it re-reads
+        // queued_: one of the two sees the other, so either the sleeper
+        // stays up or we take the lock and wake it.
+        if (sleeping_.load() > 0)
+        {
+            {
+                std::lock_guard<std::mutex> lock(sleep_mutex_);
+            }
+            wake_.notify_one();
+        }
+    }
+
+    template <typename F>
+    auto thread_pool::submit(F &&fn) -> std::future<std::invoke_result_t<std::decay_t<F> &>>
+    {
+        using result_type = std::invoke_result_t<std::decay_t<F> &>;
+        // std::function needs a copyable target; packaged_task is not.
+        auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(fn));
+        std::future<result_type> future = task->get_future();
+        post([task] { (*task)(); });
+        return future;
+    }
+
+    template <typename F>
+    void thread_pool::parallel_for(size_type first, size_type last, F body, size_type grain)
+    {
+        if (first >= last)
+        {
+            return;
+        }
+        if (grain == 0)
+        {
+            size_type pieces = 8 * (size_ + 1);
+            grain = (last - first) / pieces + 1;
+        }
+        SplitFor(first, last, body, grain);
+    }
+
+    template <typename F>
+    void thread_pool::SplitFor(size_type first, size_type last, F &body, size_type grain)
+    {
+        // Hand off the upper half until the rest fits the grain; thieves
+        // take from the top of the deque, i.e. the biggest halves.
+        task_group group(*this);
+        while (last - first > grain)
+        {
+            size_type middle = first + (last - first) / 2;
+            group.run([this, middle, last, &body, grain] { SplitFor(middle, last, body, grain); });
+            last = middle;
+        }
+        try
+        {
+            for (size_type i = first; i < last; ++i)
+            {
+                body(i);
+            }
+        }
+        catch (...)
+        {
+            group.wait();
+            throw;
+        }
+        group.wait();
+    }
+
+    inline void thread_pool::wait()
+    {
+        while (outstanding_.load() != 0)
+        {
+            if (!run_pending())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    inline bool thread_pool::run_pending()
+    {
+        task_type *task = nullptr;
+        if (!TakeTask(task))
+        {
+            return false;
+        }
+        Execute(task);
+        return true;
+    }
+
+    inline thread_pool::worker_stats thread_pool::stats(size_type worker) const
+    {
+        const Worker &source = workers_[worker];
+        worker_stats result;
+        result.executed = source.executed.load(std::memory_order_relaxed);
+        result.stolen = source.stolen.load(std::memory_order_relaxed);
+        result.failed_steals = source.failed_steals.load(std::memory_order_relaxed);
+        result.sleeps = source.sleeps.load(std::memory_order_relaxed);
+        result.idle_ns = source.idle_ns.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    inline void thread_pool::reset_stats() noexcept
+    {
+        for (size_type i = 0; i < size_; ++i)
+        {
+            workers_[i].executed.store(0, std::memory_order_relaxed);
+            workers_[i].stolen.store(0, std::memory_order_relaxed);
+            workers_[i].failed_steals.store(0, std::memory_order_relaxed);
+            workers_[i].sleeps.store(0, std::memory_order_relaxed);
+            workers_[i].idle_ns.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    inline thread_pool *&thread_pool::CurrentPool() noexcept
+    {
+        static thread_local thread_pool *pool = nullptr;
+        return pool;
+    }
+
+    inline thread_pool::size_type &thread_pool::CurrentIndex() noexcept
+    {
+        static thread_local size_type index = 0;
+        return index;
+    }
+
+    inline void thread_pool::Bump(std::atomic<uint64_t> &counter, uint64_t amount) noexcept
+    {
+        // Single writer: a plain load and store, no locked instruction.
+        counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    inline thread_pool::Worker *thread_pool::Self() noexcept
+    {
+        return CurrentPool() == this ? &workers_[CurrentIndex()] : nullptr;
+    }
+
+    inline void thread_pool::WorkerLoop(size_type index)
+    {
+        CurrentPool() = this;
+        CurrentIndex() = index;
+        Worker &self = workers_[index];
+        task_type *task = nullptr;
+        while (true)
+        {
+            if (TakeTask(task))
+            {
+                Execute(task);
+                continue;
+            }
+            auto idle_start = std::chrono::steady_clock::now();
+            bool woken = false;
+            for (int spin = 0; spin < kSpins && !woken; ++spin)
+            {
+                std::this_thread::yield();
+                woken = queued_.load() > 0;
+            }
+            bool stop = false;
+            if (!woken)
+            {
+                std::unique_lock<std::mutex> lock(sleep_mutex_);
+                sleeping_.fetch_add(1);
+                wake_.wait(lock, [this] { return stopping_ || queued_.load() > 0; });
+                sleeping_.fetch_sub(1);
+                stop = stopping_ && queued_.load() == 0;
+                Bump(self.sleeps);
+            }
+            auto idle = std::chrono::steady_clock::now() - idle_start;
+            Bump(self.idle_ns, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(idle).count()));
+            if (stop)
+            {
+                return;
+            }
+        }
+    }
+
+    inline bool thread_pool::TakeTask(task_type *&task)
+    {
+        Worker *self = Self();
+        bool found = self != nullptr && self->deque.pop(task);
+        if (!found)
+        {
+            // Workers take the oldest injected task, the biggest piece of
+            // work. A thread outside the pool is here to help its own wait,
+            // so it takes the newest: helping FIFO would nest one whole
+            // subtree per wait and overflow the caller's stack.
+            std::lock_guard<std::mutex> lock(injection_mutex_);
+            if (!injection_.empty())
+            {
+                task = self != nullptr ? injection_.front() : injection_.back();
+                if (self != nullptr)
+                {
+                    injection_.pop_front();
+                }
+                else
+                {
+                    injection_.pop_back();
+                }
+                found = true;
+            }
+        }
+        // Steal round-robin, starting next to ourselves so thieves spread.
+        size_type start = self != nullptr ? CurrentIndex() + 1 : 0;
+        for (size_type i = 0; !found && i < size_; ++i)
+        {
+            Worker &victim = workers_[(start + i) % size_];
+            if (&victim == self || victim.deque.empty())
+            {
+                continue;
+            }
+            found = victim.deque.steal(task);
+            if (self != nullptr)
+            {
+                Bump(found ? self->stolen : self->failed_steals);
+            }
+        }
+        if (found)
+        {
+            queued_.fetch_sub(1);
+        }
+        return found;
+    }
+
+    inline void thread_pool::Execute(task_type *task)
+    {
+        std::unique_ptr<task_type> owned(task);
+        (*owned)();
+        owned.reset();
+        Worker *self = Self();
+        if (self != nullptr)
+        {
+            Bump(self->executed);
+        }
+        outstanding_.fetch_sub(1);
+    }
+
+    inline task_group::task_group(thread_pool &pool) noexcept : pool_(pool), pending_(0) {}
+
+    inline task_group::~task_group()
+    {
+        drain();
+    }
+
+    template <typename F>
+    void task_group::run(F &&task)
+    {
+        // Counted before posting so wait() cannot miss a task that is
+        // already running; a task that never got posted is uncounted.
+        pending_.fetch_add(1);
+        try
+        {
+            pool_.post([this, task = std::forward<F>(task)]() mutable {
+                try
+                {
+                    task();
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lock(error_mutex_);
+                    if (!error_)
+                    {
+                        error_ = std::current_exception();
+                    }
+                }
+                // Last touch of the group: wait() may return right after.
+                pending_.fetch_sub(1);
+            });
+        }
+        catch (...)
+        {
+            pending_.fetch_sub(1);
+            throw;
+        }
+    }
+
+    inline void task_group::wait()
+    {
+        drain();
+        std::exception_ptr error;
+        {
+            std::lock_guard<std::mutex> lock(error_mutex_);
+            std::swap(error, error_);
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+
+    inline void task_group::drain() noexcept
+    {
+        while (pending_.load() != 0)
+        {
+            if (!pool_.run_pending())
+            {
+                std::this_thread::yield();
+            }
+        }
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_THREAD_POOL_H_
@@ -0,0 +1,388 @@
+#ifndef SRC_CONTAINERS_S21_TIMER_WHEEL_H_
+#define SRC_CONTAINERS_S21_TIMER_WHEEL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+#include "s21_intrusive_list.h"
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Hierarchical timer wheel: kLevels wheels of kSlots slots, where a slot
+    // on level k spans kSlots^k ticks. A timer goes to the lowest level whose
+    // span covers its distance from now, so schedule and cancel are O(1).
+    // When the lower wheel wraps, the next slot of the level above is
+    // cascaded down; each timer moves at most kLevels times before it fires.
+    // Timers further out than the top wheel spans park there and are
+    // re-placed each time their slot comes round.
+    //
+    // Each level also keeps a bitmap of slots that may hold timers, so
+    // advance() jumps straight to the next tick with a slot to visit rather
+    // than stepping through idle ticks. Cancelling leaves its bit set; the
+    // bit is cleared when the slot is next visited.
+    //
+    // Slots are intrusive lists over pooled nodes: after warm-up, scheduling
+    // allocates nothing, and a cancelled or fired node goes back to the
+    // pool's free stack, threaded through the storage of its value. A
+    // timer_id carries the node's generation, so cancelling a timer that
+    // has already fired is a safe no-op rather than a use-after-free.
+    template <typename T>
+    class timer_wheel
+    {
+    public:
+        class timer_id;
+
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using tick_type = uint64_t;
+        using size_type = size_t;
+
+        explicit timer_wheel(tick_type now = 0) noexcept;
+        timer_wheel(const timer_wheel &) = delete;
+        timer_wheel &operator=(const timer_wheel &) = delete;
+        ~timer_wheel();
+
+        // A deadline that is not in the future fires on the next tick.
+        timer_id schedule(tick_type deadline, const_reference value);
+        timer_id schedule(tick_type deadline, value_type &&value);
+        // False when the timer has already fired or been cancelled.
+        bool cancel(timer_id id) noexcept;
+        bool pending(timer_id id) const noexcept;
+
+        // Processes every tick up to and including `now`, handing each
+        // expired value to expired(T &) in batches of one slot per tick.
+        // The callback may schedule or cancel timers. If it throws, the rest
+        // of its batch fires on the next tick. Returns the number of timers
+        // fired.
+        template <typename Callback>
+        size_type advance(tick_type now, Callback expired);
+
+        tick_type now() const noexcept { return now_; }
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+        void clear() noexcept;
+
+    private:
+        static constexpr size_type kSlotBits = 6;
+        static constexpr size_type kSlots = size_type(1) << kSlotBits;
+        static constexpr tick_type kSlotMask = kSlots - 1;
+        static constexpr size_type kLevels = 6;
+        static constexpr size_type kChunkNodes = 256;
+
+        static_assert(kSlots == 64, "one occupancy word per level");
+
+        struct Node
+        {
+            Node() {}
+            ~Node() {}
+
+            intrusive_list_hook hook;
+            tick_type deadline;
+            uint64_t generation = 0;
+            union
+            {
+                T value;
+                Node *next_free;
+            };
+        };
+
+        using Slot = intrusive_list<Node, &Node::hook>;
+
+        Slot wheel_[kLevels][kSlots];
+        uint64_t occupied_[kLevels];
+        Node *free_;
+        vector<Node *> chunks_;
+        tick_type now_;
+        size_type size_;
+
+        Node *Acquire();
+        void Recycle(Node *node) noexcept;
+        void Place(Node *node) noexcept;
+        void Cascade(size_type level) noexcept;
+        tick_type NextVisit() const noexcept;
+        template <typename Callback>
+        size_type Tick(Callback &expired);
+        timer_id Arm(Node *node, tick_type deadline);
+    };
+
+    template <typename T>
+    class timer_wheel<T>::timer_id
+    {
+    public:
+        timer_id() noexcept : node_(nullptr), generation_(0) {}
+
+        bool operator==(const timer_id &other) const noexcept
+        {
+            return node_ == other.node_ && generation_ == other.generation_;
+        }
+        bool operator!=(const timer_id &other) const noexcept { return !(*this == other); }
+
+    private:
+        friend class timer_wheel<T>;
+
+        timer_id(Node *node, uint64_t generation) noexcept
+            : node_(node), generation_(generation) {}
+
+        Node *node_;
+        uint64_t generation_;
+    };
+
+
+    template <typename T>
+    timer_wheel<T>::timer_wheel(tick_type now) noexcept
+        : occupied_(), free_(nullptr), chunks_(), now_(now), size_(0) {}
+
+    template <typename T>
+    timer_wheel<T>::~timer_wheel()
+    {
+        clear();
+        for (size_type i = 0; i < chunks_.size(); ++i)
+        {
+            delete[] chunks_[i];
+        }
+    }
+
+    template <typename T>
+    typename timer_wheel<T>::timer_id timer_wheel<T>::schedule(tick_type deadline,
+                                                               const_reference value)
+    {
+        Node *node = Acquire();
+        try
+        {
+            new (&node->value) T(value);
+        }
+        catch (...)
+        {
+            node->next_free = free_;
+            free_ = node;
+            throw;
+        }
+        return Arm(node, deadline);
+    }
+
+    template <typename T>
+    typename timer_wheel<T>::timer_id timer_wheel<T>::schedule(tick_type deadline,
+                                                               value_type &&value)
+    {
+        Node *node = Acquire();
+        try
+        {
+            new (&node->value) T(std::move(value));
+        }
+        catch (...)
+        {
+            node->next_free = free_;
+            free_ = node;
+            throw;
+        }
+        return Arm(node, deadline);
+    }
+
+    template <typename T>
+    bool timer_wheel<T>::cancel(timer_id id) noexcept
+    {
+        if (!pending(id))
+        {
+            return false;
+        }
+        id.node_->hook.unlink();
+        Recycle(id.node_);
+        return true;
+    }
+
+    template <typename T>
+    bool timer_wheel<T>::pending(timer_id id) const noexcept
+    {
+        // Pooled nodes are never returned to the system before the wheel
+        // dies, so a stale id still points at readable memory. A timer whose
+        // callback is running is already unlinked and no longer pending.
+        return id.node_ != nullptr && id.node_->generation == id.generation_ &&
+               id.node_->hook.is_linked();
+    }
+
+    template <typename T>
+    template <typename Callback>
+    typename timer_wheel<T>::size_type timer_wheel<T>::advance(tick_type now, Callback expired)
+    {
+        size_type fired = 0;
+        while (now_ < now)
+        {
+            tick_type next = size_ == 0 ? now : NextVisit();
+            if (next > now)
+            {
+                // Nothing is cascaded or fired on the way.
+                now_ = now;
+                break;
+            }
+            now_ = next - 1;
+            fired += Tick(expired);
+        }
+        return fired;
+    }
+
+    template <typename T>
+    void timer_wheel<T>::clear() noexcept
+    {
+        for (size_type level = 0; level < kLevels; ++level)
+        {
+            for (size_type slot = 0; slot < kSlots; ++slot)
+            {
+                Slot &list = wheel_[level][slot];
+                while (!list.empty())
+                {
+                    Node *node = &list.front();
+                    list.pop_front();
+                    Recycle(node);
+                }
+            }
+        }
+    }
+
+    template <typename T>
+    typename timer_wheel<T>::Node *timer_wheel<T>::Acquire()
+    {
+        if (free_ == nullptr)
+        {
+            chunks_.push_back(nullptr);
+            Node *chunk = new Node[kChunkNodes];
+            chunks_[chunks_.size() - 1] = chunk;
+            // Stacked so the chunk is handed out front to back.
+            for (size_type i = kChunkNodes; i-- > 0;)
+            {
+                chunk[i].next_free = free_;
+                free_ = &chunk[i];
+            }
+        }
+        Node *node = free_;
+        free_ = node->next_free;
+        return node;
+    }
+
+    template <typename T>
+    void timer_wheel<T>::Recycle(Node *node) noexcept
+    {
+        node->value.~T();
+        // Invalidates every timer_id handed out for this use of the node.
+        ++node->generation;
+        --size_;
+        node->next_free = free_;
+        free_ = node;
+    }
+
+    template <typename T>
+    void timer_wheel<T>::Place(Node *node) noexcept
+    {
+        tick_type delta = node->deadline - now_;
+        size_type level = 0;
+        while (level + 1 < kLevels && delta >> (kSlotBits * (level + 1)) != 0)
+        {
+            ++level;
+        }
+        size_type slot = (node->deadline >> (kSlotBits * level)) & kSlotMask;
+        wheel_[level][slot].push_back(*node);
+        occupied_[level] |= uint64_t(1) << slot;
+    }
+
+    template <typename T>
+    void timer_wheel<T>::Cascade(size_type level) noexcept
+    {
+        // Detach the slot first: timers parked beyond the top wheel may be
+        // placed straight back into it.
+        Slot detached;
+        size_type slot = (now_ >> (kSlotBits * level)) & kSlotMask;
+        detached.splice(detached.cend(), wheel_[level][slot]);
+        occupied_[level] &= ~(uint64_t(1) << slot);
+        while (!detached.empty())
+        {
+            Node *node = &detached.front();
+            detached.pop_front();
+            Place(node);
+        }
+    }
+
+    template <typename T>
+    typename timer_wheel<T>::tick_type timer_wheel<T>::NextVisit() const noexcept
+    {
+        // A level k slot j is visited at ticks b * kSlots^k with
+        // b % kSlots == j. Rotating the bitmap to start just past the
+        // current b finds the nearest occupied slot with one ctz per level.
+        tick_type next = ~tick_type(0);
+        for (size_type level = 0; level < kLevels; ++level)
+        {
+            uint64_t mask = occupied_[level];
+            if (mask == 0)
+            {
+                continue;
+            }
+            size_type shift = kSlotBits * level;
+            tick_type base = (now_ >> shift) + 1;
+            size_type start = base & kSlotMask;
+            uint64_t rotated = (mask >> start) | (mask << ((kSlots - start) & kSlotMask));
+            tick_type block = base + static_cast<tick_type>(__builtin_ctzll(rotated));
+            if (block <= (next >> shift))
+            {
+                next = block << shift;
+            }
+        }
+        return next;
+    }
+
+    template <typename T>
+    template <typename Callback>
+    typename timer_wheel<T>::size_type timer_wheel<T>::Tick(Callback &expired)
+    {
+        ++now_;
+        // Level k wraps when the low k * kSlotBits bits of now are zero;
+        // higher levels cascade first so their timers can still land in the
+        // lower slots being cascaded or fired on this tick.
+        size_type top = 0;
+        while (top + 1 < kLevels && (now_ & ((tick_type(1) << (kSlotBits * (top + 1))) - 1)) == 0)
+        {
+            ++top;
+        }
+        for (size_type level = top; level > 0; --level)
+        {
+            Cascade(level);
+        }
+
+        Slot batch;
+        batch.splice(batch.cend(), wheel_[0][now_ & kSlotMask]);
+        occupied_[0] &= ~(uint64_t(1) << (now_ & kSlotMask));
+        size_type fired = 0;
+        while (!batch.empty())
+        {
+            Node *node = &batch.front();
+            batch.pop_front();
+            try
+            {
+                expired(node->value);
+            }
+            catch (...)
+            {
+                Recycle(node);
+                size_type next = (now_ + 1) & kSlotMask;
+                wheel_[0][next].splice(wheel_[0][next].cend(), batch);
+                occupied_[0] |= uint64_t(1) << next;
+                throw;
+            }
+            Recycle(node);
+            ++fired;
+        }
+        return fired;
+    }
+
+    template <typename T>
+    typename timer_wheel<T>::timer_id timer_wheel<T>::Arm(Node *node, tick_type deadline)
+    {
+        node->deadline = deadline > now_ ? deadline : now_ + 1;
+        ++size_;
+        Place(node);
+        return timer_id(node, node->generation);
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_TIMER_WHEEL_H_
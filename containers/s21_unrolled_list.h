@@ -0,0 +1,866 @@
+#ifndef SRC_CONTAINERS_S21_UNROLLED_LIST_H_
+#define SRC_CONTAINERS_S21_UNROLLED_LIST_H_
+
+#include "s21_serialize.h"
+
+namespace s21
+{
+    // Doubly linked list of fixed-size blocks, each holding up to BlockSize
+    // elements in place. Traversal touches one block per BlockSize elements
+    // instead of one node per element.
+    //
+    // Iterator stability is weaker than in s21::list: insert may move the
+    // elements of the block it lands in (and split it in half when full),
+    // erase may move the elements of its block and of the following one.
+    // Iterators into other blocks are never invalidated.
+    template <typename T, size_t BlockSize = (sizeof(T) < 64 ? 256 / sizeof(T) : 4)>
+    class unrolled_list
+    {
+        static_assert(BlockSize >= 2, "unrolled_list block must hold two elements");
+
+    public:
+        class UnrolledListIterator;
+        class UnrolledListConstIterator;
+
+        using value_type = T;
+        using reference = T &;
+        using const_reference = const T &;
+        using iterator = UnrolledListIterator;
+        using const_iterator = UnrolledListConstIterator;
+        using size_type = size_t;
+
+        unrolled_list() noexcept;
+        explicit unrolled_list(size_type n);
+        unrolled_list(std::initializer_list<value_type> const &items);
+        unrolled_list(const unrolled_list &l);
+        unrolled_list(unrolled_list &&l) noexcept;
+        ~unrolled_list();
+
+        unrolled_list &operator=(const unrolled_list &l);
+        unrolled_list &operator=(unrolled_list &&l) noexcept;
+        unrolled_list &operator=(std::initializer_list<value_type> const &items);
+
+        const_reference front() const;
+        const_reference back() const;
+
+        iterator begin() noexcept;
+        const_iterator cbegin() const noexcept;
+        iterator end() noexcept;
+        const_iterator cend() const noexcept;
+
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+        size_type max_size() const noexcept;
+        size_type block_count() const noexcept;
+        static constexpr size_type block_capacity() noexcept { return BlockSize; }
+
+        void clear();
+        iterator insert(iterator pos, const_reference value);
+        void erase(iterator pos);
+        void push_back(const_reference value);
+        void pop_back();
+        void push_front(const_reference value);
+        void pop_front();
+        void swap(unrolled_list &other);
+        void merge(unrolled_list &other);
+        void splice(const_iterator pos, unrolled_list &other);
+        void reverse();
+        void unique();
+        void sort();
+
+        template <typename... Args>
+        iterator insert_many(const_iterator pos, Args &&...args);
+
+        template <typename... Args>
+        void insert_many_back(Args &&...args);
+
+        template <typename... Args>
+        void insert_many_front(Args &&...args);
+
+        void save(std::ostream &os) const;
+        void load(std::istream &is);
+
+    private:
+        class Block;
+
+        struct BlockBase
+        {
+            BlockBase *prev;
+            BlockBase *next;
+            size_type count;
+        };
+
+        BlockBase sentinel_;
+        size_type size_;
+
+        BlockBase *Sentinel() const noexcept;
+        void InitSentinel() noexcept;
+        void TakeBlocks(unrolled_list &other) noexcept;
+        void DestroyAllBlocks();
+        template <typename... Args>
+        iterator Emplace(iterator pos, Args &&...args);
+        BlockBase *NewBlockAfter(BlockBase *block);
+        void FreeBlock(BlockBase *block) noexcept;
+        BlockBase *SplitBlock(BlockBase *block, size_type from);
+        void MergeWithNext(BlockBase *block);
+        void OpenGap(BlockBase *block, size_type index);
+        void CloseGap(BlockBase *block, size_type index);
+        unrolled_list Divide();
+        static T &Item(BlockBase *block, size_type index) noexcept;
+    };
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize>::unrolled_list() noexcept : size_(0)
+    {
+        InitSentinel();
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize>::unrolled_list(size_type n) : unrolled_list()
+    {
+        for (size_type i = 0; i < n; ++i)
+        {
+            Emplace(end());
+        }
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize>::unrolled_list(
+        std::initializer_list<value_type> const &items)
+        : unrolled_list()
+    {
+        for (const auto &item : items)
+        {
+            push_back(item);
+        }
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize>::unrolled_list(const unrolled_list &l)
+        : unrolled_list()
+    {
+        for (auto iter = l.cbegin(); iter != l.cend(); ++iter)
+        {
+            push_back(*iter);
+        }
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize>::unrolled_list(unrolled_list &&l) noexcept
+        : unrolled_list()
+    {
+        TakeBlocks(l);
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize>::~unrolled_list()
+    {
+        DestroyAllBlocks();
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize> &unrolled_list<T, BlockSize>::operator=(
+        const unrolled_list &l)
+    {
+        if (this == &l)
+        {
+            return *this;
+        }
+
+        DestroyAllBlocks();
+        for (auto iter = l.cbegin(); iter != l.cend(); ++iter)
+        {
+            push_back(*iter);
+        }
+        return *this;
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize> &unrolled_list<T, BlockSize>::operator=(
+        unrolled_list &&l) noexcept
+    {
+        if (this == &l)
+        {
+            return *this;
+        }
+
+        DestroyAllBlocks();
+        TakeBlocks(l);
+        return *this;
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize> &unrolled_list<T, BlockSize>::operator=(
+        std::initializer_list<value_type> const &items)
+    {
+        DestroyAllBlocks();
+        for (const auto &item : items)
+        {
+            push_back(item);
+        }
+        return *this;
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::const_reference
+    unrolled_list<T, BlockSize>::front() const
+    {
+        return Item(sentinel_.next, 0);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::const_reference
+    unrolled_list<T, BlockSize>::back() const
+    {
+        return Item(sentinel_.prev, sentinel_.prev->count - 1);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::iterator
+    unrolled_list<T, BlockSize>::begin() noexcept
+    {
+        return UnrolledListIterator(sentinel_.next, 0);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::const_iterator
+    unrolled_list<T, BlockSize>::cbegin() const noexcept
+    {
+        return UnrolledListConstIterator(sentinel_.next, 0);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::iterator
+    unrolled_list<T, BlockSize>::end() noexcept
+    {
+        return UnrolledListIterator(Sentinel(), 0);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::const_iterator
+    unrolled_list<T, BlockSize>::cend() const noexcept
+    {
+        return UnrolledListConstIterator(Sentinel(), 0);
+    }
+
+    template <typename T, size_t BlockSize>
+    bool unrolled_list<T, BlockSize>::empty() const noexcept
+    {
+        return size_ == 0;
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::size_type
+    unrolled_list<T, BlockSize>::size() const noexcept
+    {
+        return size_;
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::size_type
+    unrolled_list<T, BlockSize>::max_size() const noexcept
+    {
+        return std::numeric_limits<size_type>::max() / sizeof(value_type);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::size_type
+    unrolled_list<T, BlockSize>::block_count() const noexcept
+    {
+        size_type count = 0;
+        for (BlockBase *block = sentinel_.next; block != Sentinel();
+             block = block->next)
+        {
+            ++count;
+        }
+        return count;
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::clear()
+    {
+        DestroyAllBlocks();
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::iterator
+    unrolled_list<T, BlockSize>::insert(iterator pos, const_reference value)
+    {
+        return Emplace(pos, value);
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::erase(iterator pos)
+    {
+        BlockBase *block = pos.block_;
+        CloseGap(block, pos.index_);
+        --size_;
+
+        if (block->count == 0)
+        {
+            FreeBlock(block);
+        }
+        else if (block->count < BlockSize / 4)
+        {
+            MergeWithNext(block);
+        }
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::push_back(const_reference value)
+    {
+        Emplace(end(), value);
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::pop_back()
+    {
+        erase(--end());
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::push_front(const_reference value)
+    {
+        Emplace(begin(), value);
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::pop_front()
+    {
+        erase(begin());
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::swap(unrolled_list &other)
+    {
+        std::swap(*this, other);
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::merge(unrolled_list &other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        unrolled_list result;
+        iterator mine = begin();
+        iterator theirs = other.begin();
+
+        while (mine != end() && theirs != other.end())
+        {
+            if (*mine > *theirs)
+            {
+                result.Emplace(result.end(), std::move(*theirs));
+                ++theirs;
+            }
+            else
+            {
+                result.Emplace(result.end(), std::move(*mine));
+                ++mine;
+            }
+        }
+        for (; mine != end(); ++mine)
+        {
+            result.Emplace(result.end(), std::move(*mine));
+        }
+        for (; theirs != other.end(); ++theirs)
+        {
+            result.Emplace(result.end(), std::move(*theirs));
+        }
+
+        other.clear();
+        *this = std::move(result);
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::splice(const_iterator pos,
+                                             unrolled_list &other)
+    {
+        if (this == &other || other.empty())
+        {
+            return;
+        }
+
+        // Blocks are relinked whole; only a position in the middle of a
+        // block costs a split of that block.
+        BlockBase *before = pos.block_->prev;
+        if (pos.index_ != 0)
+        {
+            before = pos.block_;
+            SplitBlock(pos.block_, pos.index_);
+        }
+
+        BlockBase *after = before->next;
+        BlockBase *first = other.sentinel_.next;
+        BlockBase *last = other.sentinel_.prev;
+
+        first->prev = before;
+        last->next = after;
+        before->next = first;
+        after->prev = last;
+
+        size_ += other.size_;
+        other.InitSentinel();
+        other.size_ = 0;
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::reverse()
+    {
+        BlockBase *current = Sentinel();
+        do
+        {
+            for (size_type i = 0, j = current->count; i + 1 < j; ++i, --j)
+            {
+                std::swap(Item(current, i), Item(current, j - 1));
+            }
+            std::swap(current->prev, current->next);
+            current = current->prev;
+        } while (current != Sentinel());
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::unique()
+    {
+        if (size_ < 2)
+        {
+            return;
+        }
+
+        iterator write = begin();
+        iterator read = begin();
+        size_type kept = 1;
+
+        for (++read; read != end(); ++read)
+        {
+            if (!(*read == *write))
+            {
+                ++write;
+                if (write != read)
+                {
+                    *write = std::move(*read);
+                }
+                ++kept;
+            }
+        }
+
+        while (size_ > kept)
+        {
+            pop_back();
+        }
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::sort()
+    {
+        if (size_ < 2)
+        {
+            return;
+        }
+
+        unrolled_list second_half = Divide();
+
+        sort();
+        second_half.sort();
+
+        merge(second_half);
+    }
+
+    template <typename T, size_t BlockSize>
+    template <typename... Args>
+    typename unrolled_list<T, BlockSize>::iterator
+    unrolled_list<T, BlockSize>::insert_many(const_iterator pos, Args &&...args)
+    {
+        iterator iter(pos.block_, pos.index_);
+
+        if constexpr (sizeof...(args) > 0)
+        {
+            ((iter = ++Emplace(iter, std::forward<Args>(args))), ...);
+            for (size_type i = 0; i < sizeof...(args); ++i)
+            {
+                --iter;
+            }
+        }
+
+        return iter;
+    }
+
+    template <typename T, size_t BlockSize>
+    template <typename... Args>
+    void unrolled_list<T, BlockSize>::insert_many_back(Args &&...args)
+    {
+        (Emplace(end(), std::forward<Args>(args)), ...);
+    }
+
+    template <typename T, size_t BlockSize>
+    template <typename... Args>
+    void unrolled_list<T, BlockSize>::insert_many_front(Args &&...args)
+    {
+        insert_many(cbegin(), std::forward<Args>(args)...);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::BlockBase *
+    unrolled_list<T, BlockSize>::Sentinel() const noexcept
+    {
+        return const_cast<BlockBase *>(&sentinel_);
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::InitSentinel() noexcept
+    {
+        sentinel_.prev = &sentinel_;
+        sentinel_.next = &sentinel_;
+        sentinel_.count = 0;
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::TakeBlocks(unrolled_list &other) noexcept
+    {
+        if (other.empty())
+        {
+            return;
+        }
+
+        sentinel_.next = other.sentinel_.next;
+        sentinel_.prev = other.sentinel_.prev;
+        sentinel_.next->prev = &sentinel_;
+        sentinel_.prev->next = &sentinel_;
+        size_ = other.size_;
+
+        other.InitSentinel();
+        other.size_ = 0;
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::DestroyAllBlocks()
+    {
+        BlockBase *current = sentinel_.next;
+
+        while (current != Sentinel())
+        {
+            BlockBase *next = current->next;
+            for (size_type i = 0; i < current->count; ++i)
+            {
+                Item(current, i).~T();
+            }
+            delete static_cast<Block *>(current);
+            current = next;
+        }
+
+        InitSentinel();
+        size_ = 0;
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::save(std::ostream &os) const
+    {
+        serial::write_sequence(os, serial_kind::kUnrolledList, cbegin(), cend(),
+                               size_);
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::load(std::istream &is)
+    {
+        unrolled_list loaded;
+        serial::read_sequence<value_type>(
+            is, serial_kind::kUnrolledList,
+            [&loaded](value_type &&item) { loaded.push_back(item); });
+        swap(loaded);
+    }
+
+    template <typename T, size_t BlockSize>
+    template <typename... Args>
+    typename unrolled_list<T, BlockSize>::iterator
+    unrolled_list<T, BlockSize>::Emplace(iterator pos, Args &&...args)
+    {
+        // The arguments may refer to an element of this list, so the value
+        // is built before any element is shifted or split off.
+        T value = T(std::forward<Args>(args)...);
+        BlockBase *block = pos.block_;
+        size_type index = pos.index_;
+
+        if (block == Sentinel() || (index == 0 && block->prev != Sentinel() &&
+                                    block->prev->count < BlockSize))
+        {
+            // Appending to the previous block needs no shifting at all.
+            block = block->prev;
+            if (block == Sentinel() || block->count == BlockSize)
+            {
+                block = NewBlockAfter(block);
+            }
+            index = block->count;
+        }
+        else if (block->count == BlockSize)
+        {
+            size_type half = BlockSize / 2;
+            SplitBlock(block, half);
+            if (index > half)
+            {
+                block = block->next;
+                index -= half;
+            }
+        }
+
+        OpenGap(block, index);
+        new (&Item(block, index)) T(std::move(value));
+        ++block->count;
+        ++size_;
+        return UnrolledListIterator(block, index);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::BlockBase *
+    unrolled_list<T, BlockSize>::NewBlockAfter(BlockBase *block)
+    {
+        Block *created = new Block;
+        created->prev = block;
+        created->next = block->next;
+        created->count = 0;
+        block->next->prev = created;
+        block->next = created;
+        return created;
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::FreeBlock(BlockBase *block) noexcept
+    {
+        block->prev->next = block->next;
+        block->next->prev = block->prev;
+        delete static_cast<Block *>(block);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::BlockBase *
+    unrolled_list<T, BlockSize>::SplitBlock(BlockBase *block, size_type from)
+    {
+        BlockBase *tail = NewBlockAfter(block);
+        for (size_type i = from; i < block->count; ++i)
+        {
+            new (&Item(tail, tail->count)) T(std::move(Item(block, i)));
+            Item(block, i).~T();
+            ++tail->count;
+        }
+        block->count = from;
+        return tail;
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::MergeWithNext(BlockBase *block)
+    {
+        BlockBase *next = block->next;
+        if (next == Sentinel() || block->count + next->count > BlockSize)
+        {
+            return;
+        }
+
+        for (size_type i = 0; i < next->count; ++i)
+        {
+            new (&Item(block, block->count)) T(std::move(Item(next, i)));
+            Item(next, i).~T();
+            ++block->count;
+        }
+        FreeBlock(next);
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::OpenGap(BlockBase *block, size_type index)
+    {
+        size_type count = block->count;
+        if (index == count)
+        {
+            return;
+        }
+
+        new (&Item(block, count)) T(std::move(Item(block, count - 1)));
+        for (size_type i = count - 1; i > index; --i)
+        {
+            Item(block, i) = std::move(Item(block, i - 1));
+        }
+        Item(block, index).~T();
+    }
+
+    template <typename T, size_t BlockSize>
+    void unrolled_list<T, BlockSize>::CloseGap(BlockBase *block, size_type index)
+    {
+        for (size_type i = index; i + 1 < block->count; ++i)
+        {
+            Item(block, i) = std::move(Item(block, i + 1));
+        }
+        --block->count;
+        Item(block, block->count).~T();
+    }
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize> unrolled_list<T, BlockSize>::Divide()
+    {
+        unrolled_list second_part;
+
+        if (sentinel_.next == sentinel_.prev)
+        {
+            SplitBlock(sentinel_.next, sentinel_.next->count / 2);
+        }
+
+        BlockBase *last_kept = sentinel_.next;
+        size_type kept = last_kept->count;
+        while (last_kept->next->next != Sentinel() &&
+               kept + last_kept->next->count <= size_ / 2)
+        {
+            last_kept = last_kept->next;
+            kept += last_kept->count;
+        }
+
+        BlockBase *first = last_kept->next;
+        BlockBase *last = sentinel_.prev;
+
+        last_kept->next = Sentinel();
+        sentinel_.prev = last_kept;
+
+        first->prev = second_part.Sentinel();
+        last->next = second_part.Sentinel();
+        second_part.sentinel_.next = first;
+        second_part.sentinel_.prev = last;
+        second_part.size_ = size_ - kept;
+        size_ = kept;
+
+        return second_part;
+    }
+
+    template <typename T, size_t BlockSize>
+    T &unrolled_list<T, BlockSize>::Item(BlockBase *block,
+                                         size_type index) noexcept
+    {
+        return static_cast<Block *>(block)->slots.items[index];
+    }
+
+    template <typename T, size_t BlockSize>
+    class unrolled_list<T, BlockSize>::UnrolledListIterator
+    {
+        friend class unrolled_list<T, BlockSize>;
+
+    public:
+        UnrolledListIterator() noexcept = default;
+        UnrolledListIterator(const UnrolledListIterator &li) noexcept = default;
+
+        reference operator*();
+
+        UnrolledListIterator &operator++();
+        UnrolledListIterator operator++(int);
+
+        UnrolledListIterator &operator--();
+        UnrolledListIterator operator--(int);
+
+        UnrolledListIterator &operator=(const UnrolledListIterator &li) noexcept =
+            default;
+        bool operator==(const UnrolledListIterator &li) const noexcept;
+        bool operator!=(const UnrolledListIterator &li) const noexcept;
+
+    private:
+        UnrolledListIterator(BlockBase *block, size_type index) noexcept;
+
+        BlockBase *block_;
+        size_type index_;
+    };
+
+    template <typename T, size_t BlockSize>
+    unrolled_list<T, BlockSize>::UnrolledListIterator::UnrolledListIterator(
+        BlockBase *block, size_type index) noexcept
+        : block_(block), index_(index) {}
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::reference
+    unrolled_list<T, BlockSize>::UnrolledListIterator::operator*()
+    {
+        return Item(block_, index_);
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::UnrolledListIterator &
+    unrolled_list<T, BlockSize>::UnrolledListIterator::operator++()
+    {
+        if (++index_ == block_->count)
+        {
+            block_ = block_->next;
+            index_ = 0;
+        }
+        return *this;
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::UnrolledListIterator
+    unrolled_list<T, BlockSize>::UnrolledListIterator::operator++(int)
+    {
+        UnrolledListIterator temp(*this);
+        ++(*this);
+        return temp;
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::UnrolledListIterator &
+    unrolled_list<T, BlockSize>::UnrolledListIterator::operator--()
+    {
+        if (index_ == 0)
+        {
+            block_ = block_->prev;
+            index_ = block_->count;
+        }
+        --index_;
+        return *this;
+    }
+
+    template <typename T, size_t BlockSize>
+    typename unrolled_list<T, BlockSize>::UnrolledListIterator
+    unrolled_list<T, BlockSize>::UnrolledListIterator::operator--(int)
+    {
+        UnrolledListIterator temp(*this);
+        --(*this);
+        return temp;
+    }
+
+    template <typename T, size_t BlockSize>
+    bool unrolled_list<T, BlockSize>::UnrolledListIterator::operator==(
+        const UnrolledListIterator &li) const noexcept
+    {
+        return block_ == li.block_ && index_ == li.index_;
+    }
+
+    template <typename T, size_t BlockSize>
+    bool unrolled_list<T, BlockSize>::UnrolledListIterator::operator!=(
+        const UnrolledListIterator &li) const noexcept
+    {
+        return block_ != li.block_ || index_ != li.index_;
+    }
+
+    template <typename T, size_t BlockSize>
+    class unrolled_list<T, BlockSize>::UnrolledListConstIterator
+        : public unrolled_list<T, BlockSize>::UnrolledListIterator
+    {
+        friend class unrolled_list<T, BlockSize>;
+
+    public:
+        UnrolledListConstIterator() noexcept = default;
+        UnrolledListConstIterator(const UnrolledListIterator &li) noexcept
+            : UnrolledListIterator(li) {}
+        using UnrolledListIterator::UnrolledListIterator;
+        const_reference operator*() { return UnrolledListIterator::operator*(); }
+    };
+
+    template <typename T, size_t BlockSize>
+    class unrolled_list<T, BlockSize>::Block
+        : public unrolled_list<T, BlockSize>::BlockBase
+    {
+    public:
+        // Slots stay raw until an element is placed into them.
+        union Slots
+        {
+            Slots() {}
+            ~Slots() {}
+            T items[BlockSize];
+        } slots;
+    };
+
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_UNROLLED_LIST_H_
@@ -1,9 +1,18 @@
 #ifndef SRC_CONTAINERS_S21_VECTOR_H_
 #define SRC_CONTAINERS_S21_VECTOR_H_
 
+#include <functional>
+#include <iterator>
+#include <type_traits>
+
+#include "s21_growth_policy.h"
+#include "s21_serialize.h"
+#include "s21_storage_policy.h"
+
 namespace s21
 {
-    template <typename T>
+    template <typename T, typename GrowthPolicy = golden_growth,
+              typename StoragePolicy = new_storage>
     class vector
     {
     public:
@@ -30,9 +39,11 @@ namespace s21
 
         // Vector Element access
         reference at(size_type pos);
+        const_reference at(size_type pos) const;
         reference operator[](size_type pos);
-        const_reference front();
-        const_reference back();
+        const_reference operator[](size_type pos) const;
+        const_reference front() const;
+        const_reference back() const;
         T *data() noexcept;
 
         // Vector iterators
@@ -42,18 +53,23 @@ namespace s21
         const_iterator cend() const noexcept;
 
         // Vector capacity
-        bool empty() noexcept;
-        size_type size() noexcept;
-        size_type max_size() noexcept;
+        bool empty() const noexcept;
+        size_type size() const noexcept;
+        size_type max_size() const noexcept;
         void reserve(size_type size);
-        size_type capacity() noexcept;
+        size_type capacity() const noexcept;
         void shrink_to_fit();
 
         // Vector modifiers
         void clear() noexcept;
         iterator insert(iterator pos, const_reference value);
+        template <typename InputIt,
+                  typename = decltype(*std::declval<InputIt &>())>
+        iterator insert(const_iterator pos, InputIt first, InputIt last);
         void erase(iterator pos);
+        iterator erase(const_iterator first, const_iterator last);
         void push_back(const_reference value);
+        void push_back(value_type &&value);
         void pop_back();
         void swap(vector &other);
 
@@ -62,48 +78,75 @@ namespace s21
         template <typename... Args>
         void insert_many_back(Args &&...args);
 
+        // Vector serialization
+        void save(std::ostream &os) const;
+        void load(std::istream &is);
+
     private:
         T *arr_;
         size_t size_;
         size_t capacity_;
 
+        // Iterator category, or void for iterators without traits such as
+        // those of the other s21 containers, which are all multi-pass.
+        template <typename It, typename = void>
+        struct CategoryOf
+        {
+            using type = void;
+        };
+        template <typename It>
+        struct CategoryOf<
+            It,
+            std::void_t<typename std::iterator_traits<It>::iterator_category>>
+        {
+            using type = typename std::iterator_traits<It>::iterator_category;
+        };
+
+        template <typename It>
+        bool pointsInto(It first, It last) const noexcept;
+
         void expandArray(size_type incoming_amount = 1);
-        void increaseCapacity();
         void reallocateArray(size_type capacity);
-        void copyToArray(value_type *arr, size_type size);
+        iterator openGap(difference_type index, size_type amount);
+        static void moveRange(value_type *first, value_type *last,
+                              value_type *dest);
         void copyFromArray(const value_type *arr, size_type size);
         void freeArray();
     };
 
 
     // Vector Member functions
-    template <typename T>
-    vector<T>::vector() noexcept : arr_(nullptr), size_(0), capacity_(0) {}
-
-    template <typename T>
-    vector<T>::vector(size_type n)
-        : arr_(new value_type[n]()), size_(n), capacity_(n) {}
-
-    template <typename T>
-    vector<T>::vector(std::initializer_list<value_type> const &items)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy>::vector() noexcept
+        : arr_(nullptr), size_(0), capacity_(0) {}
+
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy>::vector(size_type n)
+        : arr_(StoragePolicy::template allocate<value_type>(n)),
+          size_(n),
+          capacity_(n) {}
+
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy>::vector(
+        std::initializer_list<value_type> const &items)
     {
         size_ = items.size();
         capacity_ = size_;
-        arr_ = new value_type[size_];
+        arr_ = StoragePolicy::template allocate<value_type>(size_);
         copyFromArray(items.begin(), items.size());
     }
 
-    template <typename T>
-    vector<T>::vector(const vector &v)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy>::vector(const vector &v)
     {
         size_ = v.size_;
         capacity_ = v.capacity_;
-        arr_ = new value_type[v.capacity_]();
+        arr_ = StoragePolicy::template allocate<value_type>(v.capacity_);
         copyFromArray(v.arr_, v.size_);
     }
 
-    template <typename T>
-    vector<T>::vector(vector &&v) noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy>::vector(vector &&v) noexcept
     {
         size_ = v.size_;
         capacity_ = v.capacity_;
@@ -114,14 +157,15 @@ namespace s21
         v.arr_ = nullptr;
     }
 
-    template <typename T>
-    vector<T>::~vector()
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy>::~vector()
     {
         freeArray();
     }
 
-    template <typename T>
-    vector<T> &vector<T>::operator=(const vector<T> &v)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy> &
+    vector<T, GrowthPolicy, StoragePolicy>::operator=(const vector &v)
     {
         if (this == &v)
         {
@@ -134,8 +178,9 @@ namespace s21
         return *this;
     }
 
-    template <typename T>
-    vector<T> &vector<T>::operator=(vector<T> &&v) noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy> &
+    vector<T, GrowthPolicy, StoragePolicy>::operator=(vector &&v) noexcept
     {
         if (this == &v)
         {
@@ -153,8 +198,9 @@ namespace s21
         return *this;
     }
 
-    template <typename T>
-    vector<T> &vector<T>::operator=(
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    vector<T, GrowthPolicy, StoragePolicy> &
+    vector<T, GrowthPolicy, StoragePolicy>::operator=(
         std::initializer_list<value_type> const &items)
     {
         clear();
@@ -164,8 +210,9 @@ namespace s21
     }
 
     // Vector Element access
-    template <typename T>
-    typename vector<T>::reference vector<T>::at(size_type pos)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::reference
+    vector<T, GrowthPolicy, StoragePolicy>::at(size_type pos)
     {
         if (pos >= size_)
         {
@@ -174,253 +221,391 @@ namespace s21
         return arr_[pos];
     }
 
-    template <typename T>
-    typename vector<T>::reference vector<T>::operator[](size_type pos)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::const_reference
+    vector<T, GrowthPolicy, StoragePolicy>::at(size_type pos) const
+    {
+        if (pos >= size_)
+        {
+            throw std::out_of_range("accessing vector element out of range");
+        }
+        return arr_[pos];
+    }
+
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::reference
+    vector<T, GrowthPolicy, StoragePolicy>::operator[](size_type pos)
+    {
+        return arr_[pos];
+    }
+
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::const_reference
+    vector<T, GrowthPolicy, StoragePolicy>::operator[](size_type pos) const
     {
         return arr_[pos];
     }
 
-    template <typename T>
-    typename vector<T>::const_reference vector<T>::front()
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::const_reference
+    vector<T, GrowthPolicy, StoragePolicy>::front() const
     {
         return arr_[0];
     }
 
-    template <typename T>
-    typename vector<T>::const_reference vector<T>::back()
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::const_reference
+    vector<T, GrowthPolicy, StoragePolicy>::back() const
     {
         return arr_[size_ - 1];
     }
 
-    template <typename T>
-    T *vector<T>::data() noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    T *vector<T, GrowthPolicy, StoragePolicy>::data() noexcept
     {
         return arr_;
     }
 
     // Vector iterators
-    template <typename T>
-    typename vector<T>::iterator vector<T>::begin() noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::iterator
+    vector<T, GrowthPolicy, StoragePolicy>::begin() noexcept
     {
         return arr_;
     }
 
-    template <typename T>
-    typename vector<T>::const_iterator vector<T>::cbegin() const noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::const_iterator
+    vector<T, GrowthPolicy, StoragePolicy>::cbegin() const noexcept
     {
         return arr_;
     }
 
-    template <typename T>
-    typename vector<T>::iterator vector<T>::end() noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::iterator
+    vector<T, GrowthPolicy, StoragePolicy>::end() noexcept
     {
         return arr_ + size_;
     }
 
-    template <typename T>
-    typename vector<T>::const_iterator vector<T>::cend() const noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::const_iterator
+    vector<T, GrowthPolicy, StoragePolicy>::cend() const noexcept
     {
         return arr_ + size_;
     }
 
     // Vector capacity
-    template <typename T>
-    bool vector<T>::empty() noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    bool vector<T, GrowthPolicy, StoragePolicy>::empty() const noexcept
     {
         return size_ == 0;
     }
 
-    template <typename T>
-    typename vector<T>::size_type vector<T>::size() noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::size_type
+    vector<T, GrowthPolicy, StoragePolicy>::size() const noexcept
     {
         return size_;
     }
 
-    template <typename T>
-    typename vector<T>::size_type vector<T>::max_size() noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::size_type
+    vector<T, GrowthPolicy, StoragePolicy>::max_size() const noexcept
     {
         return SIZE_MAX / sizeof(value_type);
     }
 
-    template <typename T>
-    void vector<T>::reserve(size_type size)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::reserve(size_type size)
     {
         if (size <= capacity_)
         {
             return;
         }
-        auto expanded_arr = new value_type[size]();
-        copyToArray(expanded_arr, size);
-        freeArray();
-        arr_ = expanded_arr;
-        capacity_ = size;
+        reallocateArray(size);
     }
 
-    template <typename T>
-    typename vector<T>::size_type vector<T>::capacity() noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::size_type
+    vector<T, GrowthPolicy, StoragePolicy>::capacity() const noexcept
     {
         return capacity_;
     }
 
-    template <typename T>
-    void vector<T>::shrink_to_fit()
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::shrink_to_fit()
     {
         reallocateArray(size_);
     }
 
     // Vector modifiers
-    template <typename T>
-    void vector<T>::clear() noexcept
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::clear() noexcept
     {
         size_ = 0;
     }
 
-    template <typename T>
-    typename vector<T>::iterator vector<T>::insert(iterator pos,
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::iterator
+    vector<T, GrowthPolicy, StoragePolicy>::insert(iterator pos,
                                                    const_reference value)
     {
-        if (pos == end())
-        {
-            push_back(value);
-            pos = end();
-            return --pos;
-        }
-
         difference_type diff = pos - begin();
+        value_type item = value;
 
-        expandArray();
+        iterator gap = openGap(diff, 1);
+        *gap = std::move(item);
+        return gap;
+    }
 
-        auto insert_pos = begin() + diff;
-        pos = insert_pos;
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    template <typename InputIt, typename>
+    typename vector<T, GrowthPolicy, StoragePolicy>::iterator
+    vector<T, GrowthPolicy, StoragePolicy>::insert(const_iterator pos,
+                                                   InputIt first, InputIt last)
+    {
+        difference_type diff = pos - cbegin();
 
-        value_type evicted_item = *pos;
-        *pos = value;
-        pos++;
+        using category = typename CategoryOf<InputIt>::type;
+        if constexpr (std::is_void_v<category> ||
+                      std::is_base_of_v<std::forward_iterator_tag, category>)
+        {
+            if (!pointsInto(first, last))
+            {
+                size_type amount = 0;
+                if constexpr (!std::is_void_v<category>)
+                {
+                    amount = std::distance(first, last);
+                }
+                else
+                {
+                    for (InputIt iter = first; iter != last; ++iter)
+                    {
+                        ++amount;
+                    }
+                }
+
+                iterator gap = openGap(diff, amount);
+                for (iterator dest = gap; first != last; ++first, ++dest)
+                {
+                    *dest = *first;
+                }
+                return gap;
+            }
+        }
 
-        for (; pos <= end(); ++pos)
+        // A single-pass range cannot be counted without consuming it, and
+        // a range inside this vector would be moved, or freed, by openGap:
+        // either is copied out before the gap is opened.
+        vector items;
+        for (; first != last; ++first)
         {
-            std::swap(*pos, evicted_item);
+            items.push_back(*first);
         }
-        ++size_;
-        return insert_pos;
+        iterator gap = openGap(diff, items.size_);
+        std::move(items.arr_, items.arr_ + items.size_, gap);
+        return gap;
     }
 
-    template <typename T>
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
     template <typename... Args>
-    typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
+    typename vector<T, GrowthPolicy, StoragePolicy>::iterator
+    vector<T, GrowthPolicy, StoragePolicy>::insert_many(const_iterator pos,
                                                         Args &&...args)
     {
-        difference_type diff = pos - begin();
-
-        expandArray(sizeof...(args));
-
-        auto return_pos = begin() + diff;
-
-        [[maybe_unused]] auto insert_pos = return_pos - 1;
+        difference_type diff = pos - cbegin();
 
-        (insert(++insert_pos, value_type(std::forward<Args>(args))), ...);
-        return return_pos;
+        if constexpr (sizeof...(args) > 0)
+        {
+            // Arguments may refer to our own elements, so they are
+            // materialized before the tail is moved.
+            value_type items[] = {value_type(std::forward<Args>(args))...};
+
+            iterator gap = openGap(diff, sizeof...(args));
+            for (size_type i = 0; i < sizeof...(args); ++i)
+            {
+                gap[i] = std::move(items[i]);
+            }
+        }
+        return begin() + diff;
     }
 
-    template <typename T>
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
     template <typename... Args>
-    void vector<T>::insert_many_back(Args &&...args)
+    void vector<T, GrowthPolicy, StoragePolicy>::insert_many_back(
+        Args &&...args)
+    {
+        insert_many(cend(), std::forward<Args>(args)...);
+    }
+
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::erase(iterator pos)
     {
-        expandArray(sizeof...(args));
-        (push_back(value_type(std::forward<Args>(args))), ...);
+        erase(pos, pos + 1);
     }
 
-    template <typename T>
-    void vector<T>::erase(iterator pos)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::iterator
+    vector<T, GrowthPolicy, StoragePolicy>::erase(const_iterator first,
+                                                  const_iterator last)
     {
-        auto next = pos;
-        next++;
+        iterator dest = begin() + (first - cbegin());
+        iterator tail = begin() + (last - cbegin());
+
+        moveRange(tail, end(), dest);
+        size_ -= tail - dest;
+        return dest;
+    }
 
-        for (; next < end(); ++next, ++pos)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::push_back(
+        const_reference value)
+    {
+        if (size_ == capacity_)
         {
-            std::swap(*next, *pos);
+            // The value may live in the storage that is about to move.
+            value_type item = value;
+            expandArray();
+            arr_[size_++] = std::move(item);
+            return;
         }
-        --size_;
+        arr_[size_++] = value;
     }
 
-    template <typename T>
-    void vector<T>::push_back(const_reference value)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::push_back(value_type &&value)
     {
-        expandArray();
-        arr_[size_++] = value;
+        if (size_ == capacity_)
+        {
+            value_type item = std::move(value);
+            expandArray();
+            arr_[size_++] = std::move(item);
+            return;
+        }
+        arr_[size_++] = std::move(value);
     }
 
-    template <typename T>
-    void vector<T>::pop_back()
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::pop_back()
     {
         --size_;
     }
 
-    template <typename T>
-    void vector<T>::swap(vector &other)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::swap(vector &other)
     {
         std::swap(*this, other);
     }
 
-    template <typename T>
-    void vector<T>::expandArray(size_type incoming_amount)
+    // Vector serialization
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::save(std::ostream &os) const
     {
-        if (capacity_ > size_ + incoming_amount)
+        serial::write_header(os, serial_kind::kVector, size_);
+        serial::write_array(os, arr_, size_);
+        serial::check_written(os);
+    }
+
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::load(std::istream &is)
+    {
+        uint64_t count = serial::read_header(is, serial_kind::kVector);
+        if (count > max_size())
         {
-            return;
+            throw std::invalid_argument("s21::load: corrupt vector size");
         }
 
-        if (capacity_ == 0)
+        vector loaded;
+        const char *corrupt = "s21::load: corrupt vector size";
+        serial::read_chunked<value_type>(count, corrupt, [&](size_type amount) {
+            loaded.expandArray(amount);
+            serial::read_array(is, loaded.arr_ + loaded.size_, amount);
+            loaded.size_ += amount;
+        });
+        swap(loaded);
+    }
+
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::expandArray(
+        size_type incoming_amount)
+    {
+        if (capacity_ >= size_ + incoming_amount)
         {
-            capacity_ = 8; 
-            // Vector is initialized with an 
-            // initial capacity of 8 elements.
+            return;
         }
+        reallocateArray(GrowthPolicy::grow(capacity_, size_ + incoming_amount,
+                                           sizeof(value_type)));
+    }
 
-        while (capacity_ < (size_ + incoming_amount))
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::reallocateArray(
+        size_type capacity)
+    {
+        arr_ = StoragePolicy::reallocate(arr_, size_, capacity_, capacity);
+        capacity_ = capacity;
+        if (capacity_ < size_)
         {
-            increaseCapacity();
+            size_ = capacity_;
         }
-
-        auto expanded_arr = new value_type[capacity_]();
-        copyToArray(expanded_arr, capacity_);
-        freeArray();
-        arr_ = expanded_arr;
     }
 
-    template <typename T>
-    void vector<T>::increaseCapacity()
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    typename vector<T, GrowthPolicy, StoragePolicy>::iterator
+    vector<T, GrowthPolicy, StoragePolicy>::openGap(difference_type index,
+                                                    size_type amount)
     {
-        capacity_ = 1 + static_cast<size_type>(1.618 *
-                                               static_cast<double>(capacity_)); 
-        // 1.618 is the golden ratio for optimal expansion
+        expandArray(amount);
+
+        iterator gap = begin() + index;
+        moveRange(gap, end(), gap + amount);
+        size_ += amount;
+        return gap;
     }
 
-    template <typename T>
-    void vector<T>::reallocateArray(size_type capacity)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    template <typename It>
+    bool vector<T, GrowthPolicy, StoragePolicy>::pointsInto(
+        It first, It last) const noexcept
     {
-        auto reallocatedArray = new value_type[capacity]();
-        copyToArray(reallocatedArray, capacity);
-        freeArray();
-        capacity_ = capacity;
-        if (capacity_ < size_)
+        // Only pointers can refer to our storage; std::less orders
+        // pointers into unrelated arrays as well.
+        if constexpr (std::is_convertible_v<It, const_iterator>)
         {
-            size_ = capacity_;
+            std::less<const_iterator> less;
+            const_iterator item = first;
+            return first != last && !less(item, cbegin()) && less(item, cend());
+        }
+        else
+        {
+            return false;
         }
-        arr_ = reallocatedArray;
     }
 
-    template <typename T>
-    void vector<T>::copyToArray(value_type *arr, size_type size)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::moveRange(value_type *first,
+                                                           value_type *last,
+                                                           value_type *dest)
     {
-        for (size_type i = 0; i < size && i < size_; ++i)
+        // The tail is moved once, in the direction that is safe for
+        // overlapping ranges; trivially copyable types become a memmove.
+        if (first == dest || first == last)
+        {
+            return;
+        }
+        if (dest < first)
+        {
+            std::move(first, last, dest);
+        }
+        else
         {
-            arr[i] = arr_[i];
+            std::move_backward(first, last, dest + (last - first));
         }
     }
 
-    template <typename T>
-    void vector<T>::copyFromArray(const value_type *arr, size_type size)
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::copyFromArray(
+        const value_type *arr, size_type size)
     {
         clear();
         if (capacity_ < size)
@@ -434,10 +619,10 @@ namespace s21
         size_ = size;
     }
 
-    template <typename T>
-    void vector<T>::freeArray()
+    template <typename T, typename GrowthPolicy, typename StoragePolicy>
+    void vector<T, GrowthPolicy, StoragePolicy>::freeArray()
     {
-        delete[] arr_;
+        StoragePolicy::deallocate(arr_, capacity_);
     }
 } // namespace s21
 
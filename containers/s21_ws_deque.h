@@ -0,0 +1,210 @@
+#ifndef SRC_CONTAINERS_S21_WS_DEQUE_H_
+#define SRC_CONTAINERS_S21_WS_DEQUE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+#include "s21_vector.h"
+
+namespace s21
+{
+    // Chase-Lev work-stealing deque (Le et al., "Correct and Efficient
+    // Work-Stealing for Weak Memory Models", PPoPP 2013). One owner thread
+    // pushes and pops at the bottom without locks; any number of thieves
+    // steal from the top, contending only with each other and with the
+    // owner's pop of the last element. The ring grows on demand; rings it
+    // outgrows stay alive until the deque dies, since a thief may still be
+    // reading one.
+    template <typename T>
+    class ws_deque
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "ws_deque slots are atomics; store pointers or handles");
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+
+        explicit ws_deque(size_type capacity = 64);
+        ws_deque(const ws_deque &other) = delete;
+        ~ws_deque();
+
+        ws_deque &operator=(const ws_deque &other) = delete;
+
+        // Owner thread only.
+        void push(value_type value);
+        bool pop(value_type &value);
+
+        // Any thread. Fails when empty or when it loses a race.
+        bool steal(value_type &value);
+
+        // Snapshot; exact only while no other thread touches the deque.
+        size_type size() const noexcept;
+        bool empty() const noexcept;
+
+    private:
+        struct Ring
+        {
+            explicit Ring(size_type capacity);
+            ~Ring();
+
+            size_type mask;
+            std::atomic<T> *slots;
+
+            T get(int64_t index) const noexcept;
+            void put(int64_t index, T value) noexcept;
+        };
+
+        alignas(64) std::atomic<int64_t> top_;
+        alignas(64) std::atomic<int64_t> bottom_;
+        std::atomic<Ring *> ring_;
+        vector<Ring *> retired_;
+
+        Ring *grow(Ring *ring, int64_t top, int64_t bottom);
+    };
+
+
+    template <typename T>
+    ws_deque<T>::Ring::Ring(size_type capacity) : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+
+    template <typename T>
+    ws_deque<T>::Ring::~Ring()
+    {
+        delete[] slots;
+    }
+
+    template <typename T>
+    T ws_deque<T>::Ring::get(int64_t index) const noexcept
+    {
+        return slots[static_cast<size_type>(index) & mask].load(std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    void ws_deque<T>::Ring::put(int64_t index, T value) noexcept
+    {
+        slots[static_cast<size_type>(index) & mask].store(value, std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    ws_deque<T>::ws_deque(size_type capacity) : top_(0), bottom_(0), ring_(nullptr)
+    {
+        size_type rounded = 2;
+        while (rounded < capacity)
+        {
+            rounded *= 2;
+        }
+        ring_.store(new Ring(rounded), std::memory_order_relaxed);
+    }
+
+    template <typename T>
+    ws_deque<T>::~ws_deque()
+    {
+        delete ring_.load(std::memory_order_relaxed);
+        for (Ring *ring : retired_)
+        {
+            delete ring;
+        }
+    }
+
+    template <typename T>
+    void ws_deque<T>::push(value_type value)
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_acquire);
+        Ring *ring = ring_.load(std::memory_order_relaxed);
+        if (bottom - top > static_cast<int64_t>(ring->mask))
+        {
+            ring = grow(ring, top, bottom);
+        }
+        ring->put(bottom, value);
+        // Publishes the slot (and whatever it points to) to thieves.
+        bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    template <typename T>
+    bool ws_deque<T>::pop(value_type &value)
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Ring *ring = ring_.load(std::memory_order_relaxed);
+        // Every bottom store is a release, so a thief that reads any of
+        // them also sees the task behind each slot below it.
+        bottom_.store(bottom, std::memory_order_release);
+        // The claim on `bottom` must be visible before we read top, or a
+        // thief and the owner could both take the last element.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        if (top > bottom)
+        {
+            bottom_.store(bottom + 1, std::memory_order_release);
+            return false;
+        }
+        value = ring->get(bottom);
+        if (top == bottom)
+        {
+            // Last element: race the thieves for it through top.
+            bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                    std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_release);
+            return won;
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool ws_deque<T>::steal(value_type &value)
+    {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return false;
+        }
+        Ring *ring = ring_.load(std::memory_order_acquire);
+        T stolen = ring->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+        value = stolen;
+        return true;
+    }
+
+    template <typename T>
+    typename ws_deque<T>::size_type ws_deque<T>::size() const noexcept
+    {
+        int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    template <typename T>
+    bool ws_deque<T>::empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    template <typename T>
+    typename ws_deque<T>::Ring *ws_deque<T>::grow(Ring *ring, int64_t top, int64_t bottom)
+    {
+        Ring *bigger = new Ring(2 * (ring->mask + 1));
+        for (int64_t i = top; i < bottom; ++i)
+        {
+            bigger->put(i, ring->get(i));
+        }
+        try
+        {
+            retired_.push_back(ring);
+        }
+        catch (...)
+        {
+            delete bigger;
+            throw;
+        }
+        ring_.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+} // namespace s21
+
+#endif // SRC_CONTAINERS_S21_WS_DEQUE_H_
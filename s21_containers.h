@@ -4,6 +4,7 @@
 #include "containers/s21_array.h"
 #include "containers/s21_list.h"
 #include "containers/s21_map.h"
+#include "containers/s21_priority_queue.h"
 #include "containers/s21_queue.h"
 #include "containers/s21_set.h"
 #include "containers/s21_stack.h"
@@ -1,7 +1,28 @@
 #ifndef SRC_S21_CONTAINERSPLUS_H_
 #define SRC_S21_CONTAINERSPLUS_H_
 
+#include "containers/s21_algorithm.h"
 #include "containers/s21_array.h"
+#include "containers/s21_concurrent_map.h"
+#include "containers/s21_cow.h"
+#include "containers/s21_epoch.h"
+#include "containers/s21_frozen_map.h"
+#include "containers/s21_indexed_heap.h"
+#include "containers/s21_intrusive_list.h"
+#include "containers/s21_lru_cache.h"
+#include "containers/s21_mmap_vector.h"
 #include "containers/s21_multiset.h"
+#include "containers/s21_parallel.h"
+#include "containers/s21_persistent_map.h"
+#include "containers/s21_persistent_vector.h"
+#include "containers/s21_rcu_map.h"
+#include "containers/s21_skiplist_map.h"
+#include "containers/s21_small_vector.h"
+#include "containers/s21_sorted_vector_view.h"
+#include "containers/s21_static_vector.h"
+#include "containers/s21_thread_pool.h"
+#include "containers/s21_timer_wheel.h"
+#include "containers/s21_unrolled_list.h"
+#include "containers/s21_ws_deque.h"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+const s21::simd::level kLevels[] = {s21::simd::level::kScalar,
+                                    s21::simd::level::kSse42,
+                                    s21::simd::level::kAvx2};
+
+// Runs check() once per instruction set the CPU supports.
+template <typename Check>
+void ForEachLevel(Check check) {
+  s21::simd::level saved = s21::simd::active();
+  for (s21::simd::level level : kLevels) {
+    if (level <= s21::simd::supported()) {
+      s21::simd::limit(level);
+      check();
+    }
+  }
+  s21::simd::limit(saved);
+}
+
+std::vector<int32_t> Pseudorandom(size_t n, uint32_t seed) {
+  std::vector<int32_t> result(n);
+  for (size_t i = 0; i < n; ++i) {
+    seed = seed * 1664525u + 1013904223u;
+    result[i] = static_cast<int32_t>(seed >> 8) % 1000 - 500;
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(TestAlgorithm, LimitClampsToSupported) {
+  s21::simd::level saved = s21::simd::active();
+  s21::simd::limit(s21::simd::level::kAvx2);
+  EXPECT_EQ(s21::simd::active(), s21::simd::supported());
+  s21::simd::limit(s21::simd::level::kScalar);
+  EXPECT_EQ(s21::simd::active(), s21::simd::level::kScalar);
+  s21::simd::limit(saved);
+}
+
+TEST(TestAlgorithm, FindAndCountMatchStd) {
+  ForEachLevel([] {
+    for (size_t n : {0u, 1u, 3u, 7u, 8u, 9u, 31u, 100u, 1001u}) {
+      std::vector<int32_t> items = Pseudorandom(n, static_cast<uint32_t>(n));
+      for (int32_t value : {-500, 0, 7, 499, 12345}) {
+        const int32_t *first = items.data();
+        const int32_t *last = first + n;
+        EXPECT_EQ(s21::find(first, last, value),
+                  std::find(first, last, value));
+        EXPECT_EQ(s21::count(first, last, value),
+                  static_cast<size_t>(std::count(first, last, value)));
+        EXPECT_EQ(s21::contains(first, last, value),
+                  std::find(first, last, value) != last);
+      }
+    }
+  });
+}
+
+TEST(TestAlgorithm, MinMaxMatchStd) {
+  ForEachLevel([] {
+    for (size_t n : {1u, 2u, 15u, 16u, 17u, 64u, 999u}) {
+      std::vector<int32_t> items = Pseudorandom(n, 7u + static_cast<uint32_t>(n));
+      const int32_t *first = items.data();
+      const int32_t *last = first + n;
+      EXPECT_EQ(s21::min_element(first, last), std::min_element(first, last));
+      EXPECT_EQ(s21::max_element(first, last), std::max_element(first, last));
+    }
+  });
+}
+
+TEST(TestAlgorithm, LowerBoundMatchesStd) {
+  ForEachLevel([] {
+    for (size_t n : {0u, 1u, 5u, 32u, 33u, 1000u, 4097u}) {
+      std::vector<int32_t> items = Pseudorandom(n, 3u);
+      std::sort(items.begin(), items.end());
+      const int32_t *first = items.data();
+      const int32_t *last = first + n;
+      for (int32_t value = -502; value <= 502; value += 3) {
+        EXPECT_EQ(s21::lower_bound(first, last, value),
+                  std::lower_bound(first, last, value));
+      }
+    }
+  });
+}
+
+TEST(TestAlgorithm, FloatEqualityAndNan) {
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  ForEachLevel([&] {
+    std::vector<float> items(40, 1.0f);
+    items[5] = nan;
+    items[21] = -0.0f;
+    items[33] = 0.0f;
+    const float *first = items.data();
+    const float *last = first + items.size();
+    EXPECT_EQ(s21::find(first, last, 0.0f), first + 21);
+    EXPECT_EQ(s21::count(first, last, -0.0f), 2u);
+    EXPECT_EQ(s21::find(first, last, nan), last);
+    EXPECT_EQ(s21::min_element(first, last), std::min_element(first, last));
+    EXPECT_EQ(s21::max_element(first, last), std::max_element(first, last));
+    items[5] = 2.0f;
+    EXPECT_EQ(s21::min_element(first, last), first + 21);
+    EXPECT_EQ(s21::max_element(first, last), first + 5);
+  });
+}
+
+TEST(TestAlgorithm, FloatNanFirst) {
+  ForEachLevel([] {
+    std::vector<float> items(32, 3.0f);
+    items[0] = std::numeric_limits<float>::quiet_NaN();
+    items[9] = -1.0f;
+    EXPECT_EQ(s21::min_element(items.data(), items.data() + items.size()),
+              items.data());
+  });
+}
+
+TEST(TestAlgorithm, Containers) {
+  s21::vector<int32_t> vector{5, 3, 9, 3, 1, 9, 2, 8, 7, 6, 4, 0, 3};
+  EXPECT_EQ(s21::find(vector, 9), vector.begin() + 2);
+  EXPECT_EQ(s21::count(vector, 3), 3u);
+  EXPECT_TRUE(s21::contains(vector, 8));
+  EXPECT_FALSE(s21::contains(vector, 10));
+  EXPECT_EQ(*s21::min_element(vector), 0);
+  EXPECT_EQ(s21::max_element(vector), vector.begin() + 2);
+
+  const s21::array<float, 5> array{0.5f, 1.5f, 2.5f, 3.5f, 4.5f};
+  EXPECT_EQ(s21::lower_bound(array, 2.0f), array.begin() + 2);
+  EXPECT_EQ(s21::find(array, 4.5f), array.begin() + 4);
+
+  s21::list<int> list{4, 1, 4, 2};
+  EXPECT_EQ(s21::count(list, 4), 2u);
+  EXPECT_EQ(*s21::max_element(list), 4);
+  s21::list<int> sorted{1, 3, 5};
+  EXPECT_EQ(*s21::lower_bound(sorted, 4), 5);
+}
+
+TEST(TestAlgorithm, GenericTypesUseScalarPath) {
+  s21::vector<int64_t> wide{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  EXPECT_EQ(s21::find(wide, int64_t{7}), wide.begin() + 6);
+  EXPECT_EQ(s21::lower_bound(wide.begin(), wide.end(), int64_t{11}),
+            wide.end());
+  // A value of another type compares through the element type's operator==.
+  s21::vector<int32_t> narrow{1, 2, 3};
+  EXPECT_EQ(s21::find(narrow, 2.0), narrow.begin() + 1);
+}
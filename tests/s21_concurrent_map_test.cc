@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+TEST(TestConcurrentMap, SingleThreadBasics) {
+  s21::concurrent_map<int, std::string> map(5);
+  EXPECT_EQ(map.shard_count(), 8u);
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert(1, "one"));
+  EXPECT_FALSE(map.insert(1, "uno"));
+  EXPECT_EQ(map.find(1).value(), "one");
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  EXPECT_TRUE(map.insert_or_assign(2, "two"));
+  EXPECT_EQ(map.find(1).value(), "uno");
+  EXPECT_FALSE(map.find(3).has_value());
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_TRUE(map.erase(2));
+  EXPECT_FALSE(map.erase(2));
+  EXPECT_FALSE(map.contains(2));
+  map.clear();
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(TestConcurrentMap, Update) {
+  s21::concurrent_map<std::string, int> map;
+  EXPECT_FALSE(map.update("a", [](int &value) { ++value; }));
+  map.update("a", 10, [](int &value) { ++value; });
+  map.update("a", 10, [](int &value) { ++value; });
+  EXPECT_TRUE(map.update("a", [](int &value) { value *= 2; }));
+  EXPECT_EQ(map.find("a").value(), 24);
+}
+
+TEST(TestConcurrentMap, SnapshotIsOrdered) {
+  s21::concurrent_map<int, int> map(16);
+  for (int i = 99; i >= 0; --i) {
+    map.insert(i, i * i);
+  }
+  s21::map<int, int> snapshot = map.snapshot();
+  EXPECT_EQ(snapshot.size(), 100u);
+  int expected = 0;
+  for (auto iter = snapshot.cbegin(); iter != snapshot.cend(); ++iter) {
+    EXPECT_EQ((*iter).first, expected);
+    EXPECT_EQ((*iter).second, expected * expected);
+    ++expected;
+  }
+  long long sum = 0;
+  map.for_each([&sum](const std::pair<int, int> &item) { sum += item.first; });
+  EXPECT_EQ(sum, 4950);
+}
+
+TEST(TestConcurrentMap, ConcurrentCounters) {
+  const int kThreads = 4;
+  const int kKeys = 100;
+  const int kRounds = 2000;
+  s21::concurrent_map<int, long long> map(8);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, t] {
+      for (int round = 0; round < kRounds; ++round) {
+        int key = (round * 7 + t) % kKeys;
+        map.update(key, 0, [](long long &value) { ++value; });
+        map.find((key + 1) % kKeys);
+      }
+    });
+  }
+  threads.emplace_back([&map] {
+    for (int i = 0; i < 20; ++i) {
+      map.snapshot();
+    }
+  });
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  long long total = 0;
+  map.for_each([&total](const std::pair<int, long long> &item) {
+    total += item.second;
+  });
+  EXPECT_EQ(total, static_cast<long long>(kThreads) * kRounds);
+  EXPECT_EQ(map.size(), static_cast<size_t>(kKeys));
+}
+
+TEST(TestConcurrentMap, ConcurrentInsertErase) {
+  s21::concurrent_map<int, int> map;
+  std::atomic<int> inserted(0);
+  std::atomic<int> erased(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t] {
+      for (int i = 0; i < 5000; ++i) {
+        int key = i % 500;
+        if ((i + t) % 2 == 0) {
+          inserted += map.insert(key, t);
+        } else {
+          erased += map.erase(key);
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(map.size(), static_cast<size_t>(inserted.load() - erased.load()));
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+TEST(TestCow, CopiesShareUntilWritten) {
+  s21::vector<int> source{1, 2, 3};
+  s21::cow_vector<int> original(source);
+  s21::cow_vector<int> copy = original;
+  EXPECT_EQ(original.use_count(), 2u);
+  EXPECT_EQ(&original.read(), &copy.read());
+  copy.write().push_back(4);
+  EXPECT_NE(&original.read(), &copy.read());
+  EXPECT_TRUE(original.unique());
+  EXPECT_TRUE(copy.unique());
+  EXPECT_EQ(s21::vector<int>(*original).size(), 3u);
+  EXPECT_EQ(s21::vector<int>(*copy).size(), 4u);
+  // A unique owner writes in place.
+  const s21::vector<int> *before = &copy.read();
+  copy.write()[0] = 10;
+  EXPECT_EQ(before, &copy.read());
+  EXPECT_EQ((*copy)[0], 10);
+  EXPECT_EQ(original->at(0), 1);
+}
+
+TEST(TestCow, ReadsThroughConstVector) {
+  s21::cow_vector<std::string> cow(s21::vector<std::string>{"a", "b", "c"});
+  const s21::vector<std::string> &items = cow.read();
+  EXPECT_EQ(items.size(), 3u);
+  EXPECT_FALSE(cow->empty());
+  EXPECT_EQ(items[1], "b");
+  EXPECT_EQ(items.at(2), "c");
+  EXPECT_THROW(items.at(3), std::out_of_range);
+  EXPECT_EQ(cow->front(), "a");
+  EXPECT_EQ(cow->back(), "c");
+  EXPECT_GE(items.capacity(), items.size());
+}
+
+TEST(TestCow, EmptyAndMovedFrom) {
+  s21::cow_map<int, std::string> empty;
+  EXPECT_EQ(empty.use_count(), 0u);
+  EXPECT_TRUE(empty->empty());
+  s21::cow_map<int, std::string> copy = empty;
+  copy.write().insert(1, "one");
+  EXPECT_TRUE(empty->empty());
+  EXPECT_EQ(copy->size(), 1u);
+  s21::cow_map<int, std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy->empty());
+  EXPECT_EQ(moved->at(1), "one");
+  copy = moved;
+  EXPECT_EQ(moved.use_count(), 2u);
+  EXPECT_EQ(copy->at(1), "one");
+  EXPECT_EQ(&copy.read(), &moved.read());
+  copy.write().insert(2, "two");
+  EXPECT_EQ(moved->size(), 1u);
+  EXPECT_EQ(copy->size(), 2u);
+}
+
+TEST(TestCow, ConcurrentWritersOnSharedCopies) {
+  s21::map<int, int> source;
+  for (int i = 0; i < 100; ++i) {
+    source.insert(i, i);
+  }
+  s21::cow_map<int, int> base(std::move(source));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([base, t]() mutable {
+      for (int round = 0; round < 50; ++round) {
+        s21::cow_map<int, int> mine = base;
+        mine.write()[0] = t;
+        EXPECT_EQ(mine->at(0), t);
+        base = mine;
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  // The writers only ever changed their own clones.
+  EXPECT_EQ(base.use_count(), 1u);
+  EXPECT_EQ(base->at(0), 0);
+  EXPECT_EQ(base->size(), 100u);
+}
+
+TEST(TestCow, LookupsReadTheSharedMap) {
+  s21::map<int, std::string> source;
+  for (int i = 0; i < 10; ++i) {
+    source.insert(i * 2, std::to_string(i));
+  }
+  s21::cow_map<int, std::string> original(std::move(source));
+  s21::cow_map<int, std::string> copy = original;
+  const s21::map<int, std::string> &shared = copy.read();
+
+  EXPECT_EQ(shared.at(4), "2");
+  EXPECT_THROW(shared.at(5), std::out_of_range);
+  EXPECT_TRUE(copy->contains(18));
+  EXPECT_FALSE(copy->contains(19));
+  EXPECT_EQ((*copy->find(6)).second, "3");
+  EXPECT_TRUE(copy->find(7) == copy->cend());
+
+  EXPECT_EQ(copy.use_count(), 2u);
+  EXPECT_EQ(&copy.read(), &original.read());
+}
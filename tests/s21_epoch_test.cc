@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+struct Tracked {
+  explicit Tracked(std::atomic<int> &counter) : freed(counter) {}
+  ~Tracked() { freed.fetch_add(1); }
+
+  std::atomic<int> &freed;
+};
+
+}  // namespace
+
+TEST(TestEpoch, RetiredObjectsFreedAfterAdvance) {
+  std::atomic<int> freed(0);
+  s21::epoch_domain domain;
+  for (int i = 0; i < 200; ++i) {
+    s21::epoch_domain::guard guard = domain.pin();
+    domain.retire(new Tracked(freed));
+  }
+  EXPECT_GT(domain.epoch(), 0u);
+  // Re-pinning walks the local epoch forward and empties old bags.
+  for (int i = 0; i < 4; ++i) {
+    s21::epoch_domain::guard guard = domain.pin();
+    domain.retire(new Tracked(freed));
+  }
+  EXPECT_GT(freed.load(), 0);
+  EXPECT_EQ(static_cast<int>(domain.pending()) + freed.load(), 204);
+}
+
+TEST(TestEpoch, PinnedThreadHoldsBackReclamation) {
+  std::atomic<int> freed(0);
+  s21::epoch_domain domain;
+  std::atomic<bool> pinned(false);
+  std::atomic<bool> done(false);
+  std::thread reader([&] {
+    s21::epoch_domain::guard guard(domain);
+    pinned.store(true);
+    while (!done.load()) {
+      std::this_thread::yield();
+    }
+  });
+  while (!pinned.load()) {
+    std::this_thread::yield();
+  }
+  uint64_t start = domain.epoch();
+  for (int i = 0; i < 1000; ++i) {
+    s21::epoch_domain::guard guard = domain.pin();
+    domain.retire(new Tracked(freed));
+  }
+  // The reader saw at most one more epoch, so nothing is old enough.
+  EXPECT_LE(domain.epoch(), start + 1);
+  EXPECT_EQ(freed.load(), 0);
+  done.store(true);
+  reader.join();
+  for (int i = 0; i < 200; ++i) {
+    s21::epoch_domain::guard guard = domain.pin();
+    domain.retire(new Tracked(freed));
+  }
+  EXPECT_GT(freed.load(), 0);
+}
+
+TEST(TestEpoch, GuardsNestAndMove) {
+  s21::epoch_domain domain;
+  s21::epoch_domain::guard outer = domain.pin();
+  {
+    s21::epoch_domain::guard copy(outer);
+    s21::epoch_domain::guard moved(std::move(copy));
+    s21::epoch_domain::guard empty;
+    empty = moved;
+  }
+  outer.release();
+  outer.release();
+  std::atomic<int> freed(0);
+  {
+    s21::epoch_domain::guard guard = domain.pin();
+    domain.retire(new Tracked(freed));
+  }
+  EXPECT_EQ(domain.pending(), 1u);
+}
+
+TEST(TestEpoch, DestructorFreesPending) {
+  std::atomic<int> freed(0);
+  {
+    s21::epoch_domain domain;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 3; ++t) {
+      threads.emplace_back([&] {
+        for (int i = 0; i < 50; ++i) {
+          s21::epoch_domain::guard guard = domain.pin();
+          domain.retire(new Tracked(freed));
+        }
+      });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+  }
+  EXPECT_EQ(freed.load(), 150);
+}
+
+TEST(TestEpoch, ThreadForgetsDeadDomains) {
+  s21::epoch_domain kept;
+  kept.pin();
+  for (int i = 0; i < 1000; ++i) {
+    s21::epoch_domain short_lived;
+    short_lived.pin();
+  }
+
+  s21::epoch_domain fresh;
+  fresh.pin();
+  EXPECT_EQ(2u, s21::epoch_domain::thread_records());
+}
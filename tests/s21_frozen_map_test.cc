@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+s21::map<int, double> Squares(int n) {
+  s21::map<int, double> m;
+  for (int i = 0; i < n; ++i) {
+    m.insert(i * 2, i * 0.5);
+  }
+  return m;
+}
+
+}  // namespace
+
+TEST(TestFrozenMap, Empty) {
+  s21::map<int, int> m;
+  s21::frozen_map<int, int> frozen(m);
+
+  EXPECT_TRUE(frozen.empty());
+  EXPECT_EQ(0, frozen.size());
+  EXPECT_EQ(frozen.begin(), frozen.end());
+  EXPECT_FALSE(frozen.contains(1));
+  EXPECT_EQ(frozen.end(), frozen.lower_bound(1));
+  EXPECT_THROW(frozen.at(1), std::out_of_range);
+}
+
+TEST(TestFrozenMap, IterationInKeyOrder) {
+  for (int n = 1; n < 70; ++n) {
+    s21::map<int, double> m = Squares(n);
+    s21::frozen_map<int, double> frozen(m);
+    ASSERT_EQ(static_cast<size_t>(n), frozen.size());
+
+    auto expected = m.begin();
+    for (auto iter = frozen.begin(); iter != frozen.end(); ++iter) {
+      EXPECT_EQ((*expected).first, (*iter).first);
+      EXPECT_DOUBLE_EQ((*expected).second, (*iter).second);
+      ++expected;
+    }
+    EXPECT_EQ(m.end(), expected);
+
+    auto last = frozen.end();
+    --last;
+    EXPECT_EQ((n - 1) * 2, (*last).first);
+  }
+}
+
+TEST(TestFrozenMap, ReverseIteration) {
+  s21::frozen_map<int, double> frozen(Squares(20));
+
+  int expected = 38;
+  auto iter = frozen.end();
+  do {
+    --iter;
+    EXPECT_EQ(expected, (*iter).first);
+    expected -= 2;
+  } while (iter != frozen.begin());
+  EXPECT_EQ(-2, expected);
+}
+
+TEST(TestFrozenMap, Lookups) {
+  for (int n = 1; n < 40; ++n) {
+    s21::frozen_map<int, double> frozen(Squares(n));
+
+    for (int key = -1; key <= n * 2; ++key) {
+      bool present = key >= 0 && key % 2 == 0 && key < n * 2;
+      EXPECT_EQ(present, frozen.contains(key));
+
+      auto lower = frozen.lower_bound(key);
+      int lower_key = key <= 0 ? 0 : (key + 1) / 2 * 2;
+      if (lower_key >= n * 2) {
+        EXPECT_EQ(frozen.end(), lower);
+      } else {
+        EXPECT_EQ(lower_key, (*lower).first);
+      }
+
+      auto upper = frozen.upper_bound(key);
+      int upper_key = key < 0 ? 0 : key / 2 * 2 + 2;
+      if (upper_key >= n * 2) {
+        EXPECT_EQ(frozen.end(), upper);
+      } else {
+        EXPECT_EQ(upper_key, (*upper).first);
+      }
+    }
+  }
+}
+
+TEST(TestFrozenMap, FindAndAt) {
+  s21::frozen_map<int, double> frozen(Squares(100));
+
+  auto iter = frozen.find(84);
+  ASSERT_NE(frozen.end(), iter);
+  EXPECT_DOUBLE_EQ(21.0, (*iter).second);
+  EXPECT_EQ(frozen.end(), frozen.find(85));
+  EXPECT_DOUBLE_EQ(0.5, frozen.at(2));
+  EXPECT_THROW(frozen.at(3), std::out_of_range);
+}
+
+TEST(TestFrozenMap, ViewOverBuffer) {
+  s21::frozen_map<int, double> frozen(Squares(10));
+  s21::frozen_map<int, double> view(frozen.data(), frozen.data_size());
+
+  EXPECT_EQ(10, view.size());
+  EXPECT_DOUBLE_EQ(4.5, view.at(18));
+  EXPECT_THROW((s21::frozen_map<int, double>(frozen.data(), 32)),
+               std::invalid_argument);
+  EXPECT_THROW((s21::frozen_map<long, double>(frozen.data(),
+                                              frozen.data_size())),
+               std::invalid_argument);
+}
+
+TEST(TestFrozenMap, SaveAndMapFile) {
+  std::string path = ::testing::TempDir() + "s21_frozen_map_test.bin";
+  {
+    s21::frozen_map<int, double> frozen(Squares(1000));
+    std::ofstream file(path, std::ios::binary);
+    frozen.save(file);
+  }
+
+  s21::frozen_map<int, double> mapped(path.c_str());
+  EXPECT_EQ(1000, mapped.size());
+  EXPECT_DOUBLE_EQ(499.5, mapped.at(1998));
+  EXPECT_TRUE(mapped.contains(0));
+
+  s21::frozen_map<int, double> moved(std::move(mapped));
+  EXPECT_EQ(1000, moved.size());
+  EXPECT_EQ(0, mapped.size());
+  std::remove(path.c_str());
+
+  EXPECT_THROW((s21::frozen_map<int, double>(path.c_str())),
+               std::system_error);
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+#include "tests/s21_test_random.h"
+
+TEST(TestIndexedHeap, BasicConstructor) {
+  s21::indexed_heap<int, int> heap;
+
+  EXPECT_TRUE(heap.empty());
+  EXPECT_EQ(heap.size(), 0U);
+  EXPECT_THROW(heap.top(), std::out_of_range);
+}
+
+TEST(TestIndexedHeap, PopsInPriorityOrder) {
+  s21::indexed_heap<std::string, int> heap;
+  heap.push("c", 30);
+  heap.push("a", 10);
+  heap.push("d", 40);
+  heap.push("b", 20);
+
+  std::vector<std::string> order;
+  while (!heap.empty()) {
+    order.push_back(heap.key(heap.top()));
+    heap.pop();
+  }
+  EXPECT_EQ(order, (std::vector<std::string>{"a", "b", "c", "d"}));
+}
+
+TEST(TestIndexedHeap, DecreaseAndIncreaseKey) {
+  s21::indexed_heap<char, int> heap;
+  auto a = heap.push('a', 10);
+  auto b = heap.push('b', 20);
+  auto c = heap.push('c', 30);
+
+  heap.decrease_key(c, 5);
+  EXPECT_EQ(heap.top(), c);
+  heap.increase_key(c, 25);
+  EXPECT_EQ(heap.top(), a);
+  heap.update(a, 40);
+  EXPECT_EQ(heap.top(), b);
+  EXPECT_EQ(heap.priority(a), 40);
+  EXPECT_EQ(heap.priority(c), 25);
+
+  EXPECT_THROW(heap.decrease_key(b, 21), std::invalid_argument);
+  EXPECT_THROW(heap.increase_key(b, 19), std::invalid_argument);
+  EXPECT_EQ(heap.priority(b), 20);
+}
+
+TEST(TestIndexedHeap, EraseAndHandleReuse) {
+  s21::indexed_heap<int, int> heap;
+  auto a = heap.push(1, 1);
+  auto b = heap.push(2, 2);
+  auto c = heap.push(3, 3);
+
+  heap.erase(a);
+  EXPECT_FALSE(heap.contains(a));
+  EXPECT_TRUE(heap.contains(b));
+  EXPECT_THROW(heap.erase(a), std::out_of_range);
+  EXPECT_THROW(heap.key(a), std::out_of_range);
+  EXPECT_THROW(heap.priority(42), std::out_of_range);
+  EXPECT_EQ(heap.top(), b);
+
+  // d reuses a's slot, but a stays stale.
+  auto d = heap.push(4, 0);
+  EXPECT_NE(d, a);
+  EXPECT_FALSE(heap.contains(a));
+  EXPECT_THROW(heap.priority(a), std::out_of_range);
+  EXPECT_THROW(heap.erase(a), std::out_of_range);
+  EXPECT_EQ(heap.key(d), 4);
+  EXPECT_EQ(heap.top(), d);
+  EXPECT_EQ(heap.key(c), 3);
+  EXPECT_EQ(heap.size(), 3U);
+}
+
+TEST(TestIndexedHeap, CustomCompareAndSwap) {
+  s21::indexed_heap<int, int, std::greater<int>, 2> max_heap;
+  max_heap.push(1, 1);
+  auto big = max_heap.push(9, 9);
+  s21::indexed_heap<int, int, std::greater<int>, 2> other;
+  other.swap(max_heap);
+
+  EXPECT_TRUE(max_heap.empty());
+  EXPECT_EQ(other.top(), big);
+  other.clear();
+  EXPECT_TRUE(other.empty());
+  EXPECT_FALSE(other.contains(big));
+}
+
+TEST(TestIndexedHeap, HandlesStayStaleAcrossClearAndReuse) {
+  s21::indexed_heap<int, int> heap;
+  auto first = heap.push(1, 1);
+  heap.pop();
+  auto second = heap.push(2, 2);
+  EXPECT_FALSE(heap.contains(first));
+  EXPECT_TRUE(heap.contains(second));
+
+  heap.clear();
+  for (int i = 0; i < 4; ++i) {
+    heap.push(i, i);
+  }
+  EXPECT_FALSE(heap.contains(first));
+  EXPECT_FALSE(heap.contains(second));
+  EXPECT_THROW(heap.decrease_key(second, 0), std::out_of_range);
+  EXPECT_EQ(heap.size(), 4U);
+  EXPECT_EQ(heap.key(heap.top()), 0);
+}
+
+TEST(TestIndexedHeap, RandomOperationsMatchReference) {
+  s21::indexed_heap<int, uint64_t, std::less<uint64_t>, 3> heap;
+  // Reference: live handle -> priority.
+  std::vector<std::pair<size_t, uint64_t>> live;
+  uint64_t state = 88172645463325252ull;
+  for (int i = 0; i < 5000; ++i) {
+    uint64_t op = s21_test::NextRandom(state) % 5;
+    if (op <= 1 || live.empty()) {
+      uint64_t priority = s21_test::NextRandom(state) % 1000;
+      live.emplace_back(heap.push(i, priority), priority);
+    } else if (op == 2) {
+      size_t pick = s21_test::NextRandom(state) % live.size();
+      live[pick].second = s21_test::NextRandom(state) % 1000;
+      heap.update(live[pick].first, live[pick].second);
+    } else if (op == 3) {
+      size_t pick = s21_test::NextRandom(state) % live.size();
+      heap.erase(live[pick].first);
+      live.erase(live.begin() + pick);
+    } else {
+      auto min = std::min_element(
+          live.begin(), live.end(),
+          [](const auto &l, const auto &r) { return l.second < r.second; });
+      ASSERT_EQ(heap.priority(heap.top()), min->second);
+      live.erase(std::find_if(live.begin(), live.end(), [&](const auto &e) {
+        return e.first == heap.top();
+      }));
+      heap.pop();
+    }
+    ASSERT_EQ(heap.size(), live.size());
+  }
+}
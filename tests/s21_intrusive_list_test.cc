@@ -0,0 +1,266 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+#include "s21_containersplus.h"
+
+namespace {
+
+struct Timer {
+  explicit Timer(int d = 0) : deadline(d) {}
+
+  bool operator>(const Timer &other) const { return deadline > other.deadline; }
+  bool operator==(const Timer &other) const {
+    return deadline == other.deadline;
+  }
+
+  int deadline;
+  s21::intrusive_list_hook by_deadline;
+  s21::intrusive_list_hook by_owner;
+};
+
+using DeadlineList = s21::intrusive_list<Timer, &Timer::by_deadline>;
+using OwnerList = s21::intrusive_list<Timer, &Timer::by_owner>;
+
+template <typename List>
+std::string Deadlines(const List &l) {
+  std::string result;
+  for (auto iter = l.cbegin(); iter != l.cend(); ++iter) {
+    result += std::to_string((*iter).deadline);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(TestIntrusiveList, BasicConstructor) {
+  DeadlineList l;
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(0, l.size());
+  EXPECT_EQ(l.begin(), l.end());
+}
+
+TEST(TestIntrusiveList, PushAndPop) {
+  Timer t1(1), t2(2), t3(3);
+  DeadlineList l;
+
+  l.push_back(t2);
+  l.push_back(t3);
+  l.push_front(t1);
+
+  EXPECT_EQ(3, l.size());
+  EXPECT_EQ(&t1, &l.front());
+  EXPECT_EQ(&t3, &l.back());
+  EXPECT_EQ("123", Deadlines(l));
+
+  l.pop_front();
+  EXPECT_FALSE(t1.by_deadline.is_linked());
+  l.pop_back();
+  EXPECT_FALSE(t3.by_deadline.is_linked());
+  EXPECT_EQ("2", Deadlines(l));
+}
+
+TEST(TestIntrusiveList, UnlinkFromElement) {
+  Timer t1(1), t2(2), t3(3);
+  DeadlineList l;
+  l.insert_many_back(t1, t2, t3);
+
+  t2.by_deadline.unlink();
+
+  EXPECT_EQ("13", Deadlines(l));
+  EXPECT_FALSE(t2.by_deadline.is_linked());
+  t2.by_deadline.unlink();
+  EXPECT_EQ(2, l.size());
+}
+
+TEST(TestIntrusiveList, ElementDestructionUnlinks) {
+  Timer t1(1), t3(3);
+  DeadlineList l;
+  l.push_back(t1);
+  {
+    Timer t2(2);
+    l.push_back(t2);
+    l.push_back(t3);
+    EXPECT_EQ("123", Deadlines(l));
+  }
+  EXPECT_EQ("13", Deadlines(l));
+}
+
+TEST(TestIntrusiveList, ListDestructionReleasesHooks) {
+  Timer t1(1);
+  {
+    DeadlineList l;
+    l.push_back(t1);
+  }
+  EXPECT_FALSE(t1.by_deadline.is_linked());
+}
+
+TEST(TestIntrusiveList, MultipleHooks) {
+  Timer t1(1), t2(2), t3(3);
+  DeadlineList deadlines;
+  OwnerList owners;
+
+  deadlines.insert_many_back(t1, t2, t3);
+  owners.insert_many_back(t3, t1);
+
+  EXPECT_EQ("123", Deadlines(deadlines));
+  EXPECT_EQ("31", Deadlines(owners));
+
+  owners.erase(OwnerList::iterator_to(t3));
+  EXPECT_EQ("1", Deadlines(owners));
+  EXPECT_EQ("123", Deadlines(deadlines));
+}
+
+TEST(TestIntrusiveList, ElementWithoutDefaultConstructor) {
+  struct Named {
+    explicit Named(std::string n) : name(std::move(n)) {}
+
+    std::string name;
+    s21::intrusive_list_hook hook;
+  };
+
+  Named a("a"), b("b");
+  s21::intrusive_list<Named, &Named::hook> names;
+  names.insert_many_back(a, b);
+  EXPECT_EQ(&a, &names.front());
+  EXPECT_EQ("b", names.back().name);
+}
+
+TEST(TestIntrusiveList, CopiedElementIsNotLinked) {
+  Timer t1(1);
+  DeadlineList l;
+  l.push_back(t1);
+
+  Timer copy(t1);
+  EXPECT_FALSE(copy.by_deadline.is_linked());
+  copy = t1;
+  EXPECT_FALSE(copy.by_deadline.is_linked());
+  EXPECT_EQ(1, l.size());
+}
+
+TEST(TestIntrusiveList, InsertMovesBetweenLists) {
+  Timer t1(1), t2(2);
+  DeadlineList l1;
+  DeadlineList l2;
+  l1.insert_many_back(t1, t2);
+
+  l2.push_back(t1);
+
+  EXPECT_EQ("2", Deadlines(l1));
+  EXPECT_EQ("1", Deadlines(l2));
+}
+
+TEST(TestIntrusiveList, EraseReturnsNext) {
+  Timer t1(1), t2(2), t3(3);
+  DeadlineList l;
+  l.insert_many_back(t1, t2, t3);
+
+  auto iter = l.erase(++l.begin());
+  EXPECT_EQ(3, iter->deadline);
+  EXPECT_EQ("13", Deadlines(l));
+}
+
+TEST(TestIntrusiveList, Move) {
+  Timer t1(1), t2(2);
+  DeadlineList origin;
+  origin.insert_many_back(t1, t2);
+
+  DeadlineList moved(std::move(origin));
+  EXPECT_TRUE(origin.empty());
+  EXPECT_EQ("12", Deadlines(moved));
+
+  origin = std::move(moved);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ("12", Deadlines(origin));
+  EXPECT_EQ(&t2, &origin.back());
+}
+
+TEST(TestIntrusiveList, Swap) {
+  Timer t1(1), t2(2), t3(3);
+  DeadlineList l1;
+  DeadlineList l2;
+  l1.insert_many_back(t1, t2);
+  l2.push_back(t3);
+
+  l1.swap(l2);
+
+  EXPECT_EQ("3", Deadlines(l1));
+  EXPECT_EQ("12", Deadlines(l2));
+}
+
+TEST(TestIntrusiveList, Splice) {
+  Timer t1(1), t2(2), t3(3), t4(4), t5(5);
+  DeadlineList l1;
+  DeadlineList l2;
+  l1.insert_many_back(t1, t5);
+  l2.insert_many_back(t2, t3, t4);
+
+  l1.splice(++l1.cbegin(), l2);
+
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ("12345", Deadlines(l1));
+}
+
+TEST(TestIntrusiveList, SpliceRangeAndSingle) {
+  Timer t1(1), t2(2), t3(3), t4(4), t5(5);
+  DeadlineList l1;
+  DeadlineList l2;
+  l1.insert_many_back(t1, t5);
+  l2.insert_many_back(t4, t2, t3);
+
+  l1.splice(++l1.cbegin(), l2, ++l2.cbegin(), l2.cend());
+  l1.splice(--l1.cend(), l2, l2.cbegin());
+
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ("12345", Deadlines(l1));
+}
+
+TEST(TestIntrusiveList, Reverse) {
+  Timer t1(1), t2(2), t3(3);
+  DeadlineList l;
+  l.insert_many_back(t1, t2, t3);
+
+  l.reverse();
+
+  EXPECT_EQ("321", Deadlines(l));
+  EXPECT_EQ(&t1, &l.back());
+}
+
+TEST(TestIntrusiveList, Unique) {
+  Timer t1(1), t2(1), t3(2), t4(2), t5(3);
+  DeadlineList l;
+  l.insert_many_back(t1, t2, t3, t4, t5);
+
+  l.unique();
+
+  EXPECT_EQ("123", Deadlines(l));
+}
+
+TEST(TestIntrusiveList, Merge) {
+  Timer t1(1), t2(2), t3(3), t4(4), t5(5);
+  DeadlineList l1;
+  DeadlineList l2;
+  l1.insert_many_back(t1, t4);
+  l2.insert_many_back(t2, t3, t5);
+
+  l1.merge(l2);
+
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ("12345", Deadlines(l1));
+}
+
+TEST(TestIntrusiveList, Sort) {
+  Timer timers[] = {Timer(5), Timer(3), Timer(9), Timer(1), Timer(7),
+                    Timer(2), Timer(8), Timer(4), Timer(6)};
+  DeadlineList l;
+  for (auto &timer : timers) {
+    l.push_back(timer);
+  }
+
+  l.sort();
+
+  EXPECT_EQ("123456789", Deadlines(l));
+  EXPECT_EQ(&timers[3], &l.front());
+  EXPECT_EQ(&timers[2], &l.back());
+}
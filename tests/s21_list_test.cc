@@ -428,6 +428,123 @@ TEST(TestList, SpliceEmptyLeft) {
   }
 }
 
+TEST(TestList, SpliceRange) {
+  s21::list<char> l1({'a', 's'});
+  s21::list<char> l2({'x', 'b', 'o', 'b', 'u', 'y'});
+
+  auto first = l2.begin();
+  ++first;
+  auto last = l2.end();
+  --last;
+
+  l1.splice(++l1.begin(), l2, first, last);
+
+  EXPECT_EQ(6, l1.size());
+  EXPECT_EQ(2, l2.size());
+  EXPECT_EQ('x', l2.front());
+  EXPECT_EQ('y', l2.back());
+
+  std::string text = "abobus";
+  size_t i = 0;
+  for (auto iter = l1.begin(); iter != l1.end(); ++iter, ++i) {
+    EXPECT_EQ(text[i], *iter);
+  }
+  EXPECT_EQ(6, i);
+}
+
+TEST(TestList, SpliceRangeToEnd) {
+  s21::list<char> l1({'a', 'b'});
+  s21::list<char> l2({'o', 'b', 'u', 's'});
+
+  l1.splice(l1.end(), l2, l2.begin(), l2.end());
+
+  EXPECT_EQ(6, l1.size());
+  EXPECT_TRUE(l2.empty());
+  EXPECT_EQ('s', l1.back());
+
+  std::string text = "abobus";
+  size_t i = 0;
+  for (auto iter = l1.begin(); iter != l1.end(); ++iter, ++i) {
+    EXPECT_EQ(text[i], *iter);
+  }
+  auto iter = l1.end();
+  for (i = text.size(); i > 0; --i) {
+    --iter;
+    EXPECT_EQ(text[i - 1], *iter);
+  }
+}
+
+TEST(TestList, SpliceRangeSameList) {
+  s21::list<char> l({'b', 'u', 's', 'a', 'b', 'o'});
+
+  auto first = l.begin();
+  auto last = first;
+  ++last;
+  ++last;
+  ++last;
+
+  l.splice(l.end(), l, first, last);
+
+  EXPECT_EQ(6, l.size());
+  std::string text = "abobus";
+  size_t i = 0;
+  for (auto iter = l.begin(); iter != l.end(); ++iter, ++i) {
+    EXPECT_EQ(text[i], *iter);
+  }
+}
+
+TEST(TestList, SpliceSingle) {
+  s21::list<char> l1({'a', 'o', 'b', 'u', 's'});
+  s21::list<char> l2({'b'});
+
+  l1.splice(++l1.begin(), l2, l2.begin());
+
+  EXPECT_EQ(6, l1.size());
+  EXPECT_TRUE(l2.empty());
+
+  std::string text = "abobus";
+  size_t i = 0;
+  for (auto iter = l1.begin(); iter != l1.end(); ++iter, ++i) {
+    EXPECT_EQ(text[i], *iter);
+  }
+}
+
+TEST(TestList, SpliceSingleSameList) {
+  s21::list<char> l({'b', 'o', 'b', 'u', 's', 'a'});
+
+  auto last = l.end();
+  --last;
+  l.splice(l.begin(), l, last);
+  l.splice(l.begin(), l, l.begin());
+
+  EXPECT_EQ(6, l.size());
+  std::string text = "abobus";
+  size_t i = 0;
+  for (auto iter = l.begin(); iter != l.end(); ++iter, ++i) {
+    EXPECT_EQ(text[i], *iter);
+  }
+  EXPECT_EQ('s', l.back());
+}
+
+TEST(TestList, IteratorsSurviveMove) {
+  s21::list<int> origin({1, 2, 3});
+  auto second = ++origin.begin();
+
+  s21::list<int> moved(std::move(origin));
+
+  EXPECT_TRUE(origin.empty());
+  EXPECT_EQ(origin.begin(), origin.end());
+  EXPECT_NE(moved.end(), origin.end());
+  EXPECT_EQ(2, *second);
+  EXPECT_EQ(3, *(++second));
+  EXPECT_EQ(moved.end(), ++second);
+  EXPECT_EQ(3, *(--second));
+
+  origin.push_back(4);
+  EXPECT_EQ(1, origin.size());
+  EXPECT_EQ(4, origin.front());
+}
+
 TEST(TestList, ReverseEmpty) {
   s21::list<char> l;
 
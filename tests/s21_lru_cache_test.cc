@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <list>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+#include "tests/s21_test_random.h"
+
+namespace {
+
+struct StringBytes {
+  size_t operator()(int, const std::string &value) const {
+    return value.size();
+  }
+};
+
+}  // namespace
+
+TEST(TestLruCache, GetPutAndEvictLeastRecentlyUsed) {
+  s21::lru_cache<int, std::string> cache(2);
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.get(1), nullptr);
+
+  cache.put(1, "one");
+  cache.put(2, "two");
+  ASSERT_NE(cache.get(1), nullptr);
+  EXPECT_EQ(*cache.get(1), "one");
+  cache.put(3, "three");  // 2 is least recently used
+
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(3));
+
+  cache.put(1, "uno");  // replace, no eviction
+  EXPECT_EQ(*cache.peek(1), "uno");
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_TRUE(cache.erase(3));
+  EXPECT_FALSE(cache.erase(3));
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+}
+
+TEST(TestLruCache, PeekDoesNotRefresh) {
+  s21::lru_cache<int, int> cache(2);
+  cache.put(1, 10);
+  cache.put(2, 20);
+  EXPECT_EQ(*cache.peek(1), 10);
+  cache.put(3, 30);
+
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_TRUE(cache.contains(2));
+}
+
+TEST(TestLruCache, EvictionCallback) {
+  s21::lru_cache<int, std::string> cache(2);
+  std::vector<std::pair<int, std::string>> evicted;
+  cache.set_eviction_callback([&](const int &key, std::string &value) {
+    evicted.emplace_back(key, std::move(value));
+  });
+  cache.put(1, "a");
+  cache.put(2, "b");
+  cache.put(2, "bb");  // replaced, not evicted
+  cache.put(3, "c");
+  cache.erase(3);      // erased, not evicted
+  cache.set_capacity(1);
+
+  std::vector<std::pair<int, std::string>> expected = {{1, "a"}};
+  EXPECT_EQ(evicted, expected);
+  EXPECT_EQ(cache.size(), 1U);
+  EXPECT_EQ(*cache.peek(2), "bb");
+}
+
+TEST(TestLruCache, CapacityByWeight) {
+  s21::lru_cache<int, std::string, std::hash<int>, StringBytes> cache(10);
+  cache.put(1, "aaaa");
+  cache.put(2, "bbbb");
+  EXPECT_EQ(cache.weight(), 8U);
+  cache.put(3, "ccccc");  // needs 1 evicted
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_EQ(cache.weight(), 9U);
+
+  cache.put(4, std::string(11, 'x'));  // heavier than the whole cache
+  EXPECT_FALSE(cache.contains(4));
+  EXPECT_EQ(cache.weight(), 9U);
+  cache.put(2, std::string(11, 'x'));  // replacing drops the old value
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_EQ(cache.weight(), 5U);
+}
+
+TEST(TestLruCache, ClockGivesSecondChance) {
+  s21::lru_cache<int, int> cache(3, s21::eviction_policy::kClock);
+  cache.put(1, 1);
+  cache.put(2, 2);
+  cache.put(3, 3);
+  cache.get(1);
+  cache.put(4, 4);  // 1 was referenced, so 2 goes
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_FALSE(cache.contains(2));
+  cache.put(5, 5);  // the hand moved on past 1: 3 goes
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_TRUE(cache.contains(4));
+}
+
+TEST(TestLruCache, SieveKeepsVisitedAndSkipsNew) {
+  s21::lru_cache<int, int> cache(3, s21::eviction_policy::kSieve);
+  cache.put(1, 1);
+  cache.put(2, 2);
+  cache.put(3, 3);
+  cache.get(1);
+  cache.get(2);
+  cache.put(4, 4);  // 1 and 2 visited: 3 goes
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_TRUE(cache.contains(2));
+  cache.get(4);
+  // The hand passed the head and restarts from the tail, where 1 lost its
+  // bit on the last sweep. 4 is newer but visited, so it stays.
+  cache.put(5, 5);
+  EXPECT_FALSE(cache.contains(1));
+  EXPECT_TRUE(cache.contains(4));
+  cache.put(6, 6);  // next towards the head: 2, also cleared
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_TRUE(cache.contains(4));
+}
+
+TEST(TestLruCache, LruMatchesReferenceModel) {
+  s21::lru_cache<int, int> cache(50);
+  std::list<std::pair<int, int>> model;
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index;
+  uint64_t state = 88172645463325252ull;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(s21_test::NextRandom(state) % 120);
+    auto found = index.find(key);
+    if (s21_test::NextRandom(state) % 3 == 0) {
+      int *value = cache.get(key);
+      ASSERT_EQ(value != nullptr, found != index.end());
+      if (value != nullptr) {
+        EXPECT_EQ(*value, found->second->second);
+        model.splice(model.begin(), model, found->second);
+      }
+    } else {
+      cache.put(key, i);
+      if (found != index.end()) {
+        model.erase(found->second);
+      } else if (model.size() == 50) {
+        index.erase(model.back().first);
+        model.pop_back();
+      }
+      model.emplace_front(key, i);
+      index[key] = model.begin();
+    }
+    ASSERT_EQ(cache.size(), model.size());
+  }
+}
+
+TEST(TestLruCache, PoliciesStayWithinCapacity) {
+  for (auto policy : {s21::eviction_policy::kLru, s21::eviction_policy::kClock,
+                      s21::eviction_policy::kSieve}) {
+    s21::lru_cache<uint64_t, uint64_t> cache(100, policy);
+    uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < 20000; ++i) {
+      uint64_t key = s21_test::NextRandom(state) % 300;
+      if (i % 5 == 0) {
+        cache.erase(key);
+      } else if (uint64_t *value = cache.get(key)) {
+        EXPECT_EQ(*value, key * 7);
+      } else {
+        cache.put(key, key * 7);
+      }
+      ASSERT_LE(cache.size(), 100U);
+    }
+    EXPECT_EQ(cache.size(), 100U);
+  }
+}
+
+TEST(TestLruCache, MoveKeepsEntries) {
+  s21::lru_cache<int, int> cache(4, s21::eviction_policy::kSieve);
+  cache.put(1, 1);
+  s21::lru_cache<int, int> moved(std::move(cache));
+  EXPECT_TRUE(moved.contains(1));
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.capacity(), 4U);
+  cache.put(2, 2);
+  moved = std::move(cache);
+  EXPECT_TRUE(moved.contains(2));
+  EXPECT_FALSE(moved.contains(1));
+}
+
+TEST(TestShardedLruCache, SingleThreadBasics) {
+  s21::sharded_lru_cache<int, std::string> cache(64, s21::eviction_policy::kLru,
+                                                 5);
+  EXPECT_EQ(cache.shard_count(), 8U);
+  cache.put(1, "one");
+  EXPECT_EQ(cache.get(1).value(), "one");
+  EXPECT_FALSE(cache.get(2).has_value());
+  EXPECT_TRUE(cache.contains(1));
+  EXPECT_TRUE(cache.erase(1));
+  EXPECT_FALSE(cache.contains(1));
+  for (int i = 0; i < 1000; ++i) {
+    cache.put(i, std::to_string(i));
+  }
+  EXPECT_LE(cache.size(), 64U);
+  EXPECT_EQ(cache.size(), cache.weight());
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST(TestShardedLruCache, ConcurrentReadersAndWriters) {
+  s21::sharded_lru_cache<int, int> cache(256, s21::eviction_policy::kSieve, 8);
+  std::atomic<int> evictions{0};
+  cache.set_eviction_callback(
+      [&](const int &, int &) { evictions.fetch_add(1); });
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache, t] {
+      uint64_t state = 88172645463325252ull + t;
+      for (int i = 0; i < 20000; ++i) {
+        int key = static_cast<int>(s21_test::NextRandom(state) % 1000);
+        if (auto value = cache.get(key)) {
+          EXPECT_EQ(*value, key + 1);
+        } else {
+          cache.put(key, key + 1);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  EXPECT_LE(cache.size(), 256U);
+  EXPECT_GT(evictions.load(), 0);
+}
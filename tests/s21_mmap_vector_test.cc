@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "s21_containersplus.h"
+
+namespace {
+
+struct Record {
+  int id;
+  double score;
+};
+
+class TestMmapVector : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    path_ = ::testing::TempDir() + "s21_mmap_vector_" +
+            ::testing::UnitTest::GetInstance()->current_test_info()->name();
+    std::remove(path_.c_str());
+  }
+  void TearDown() override { std::remove(path_.c_str()); }
+
+  const char *path() const { return path_.c_str(); }
+
+ private:
+  std::string path_;
+};
+
+}  // namespace
+
+TEST_F(TestMmapVector, CreateEmpty) {
+  s21::mmap_vector<int> vec(path());
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(0, vec.size());
+  EXPECT_EQ(0, vec.capacity());
+  EXPECT_EQ(vec.begin(), vec.end());
+  EXPECT_FALSE(vec.read_only());
+}
+
+TEST_F(TestMmapVector, PushBackAndReopen) {
+  {
+    s21::mmap_vector<Record> vec(path());
+    for (int i = 0; i < 1000; ++i) {
+      vec.push_back(Record{i, i * 0.5});
+    }
+    vec.sync();
+  }
+
+  s21::mmap_vector<Record> vec(path(), s21::mmap_mode::read_only);
+  EXPECT_TRUE(vec.read_only());
+  EXPECT_EQ(1000, vec.size());
+  EXPECT_EQ(999, vec.back().id);
+  EXPECT_DOUBLE_EQ(250.0, vec[500].score);
+
+  int expected = 0;
+  for (const auto &record : vec) {
+    EXPECT_EQ(expected++, record.id);
+  }
+}
+
+TEST_F(TestMmapVector, ReadOnlyRejectsWrites) {
+  { s21::mmap_vector<int> vec(path()); }
+
+  s21::mmap_vector<int> vec(path(), s21::mmap_mode::read_only);
+  EXPECT_THROW(vec.push_back(1), std::invalid_argument);
+  EXPECT_THROW(vec.reserve(10), std::invalid_argument);
+  EXPECT_THROW(vec.clear(), std::invalid_argument);
+}
+
+TEST_F(TestMmapVector, ReadOnlyMissingFile) {
+  EXPECT_THROW(s21::mmap_vector<int>(path(), s21::mmap_mode::read_only),
+               std::system_error);
+}
+
+TEST_F(TestMmapVector, RejectsOtherElementType) {
+  {
+    s21::mmap_vector<int> vec(path());
+    vec.push_back(1);
+  }
+  EXPECT_THROW(s21::mmap_vector<Record>{path()}, std::invalid_argument);
+}
+
+TEST_F(TestMmapVector, RejectsForeignFile) {
+  std::FILE *file = std::fopen(path(), "wb");
+  ASSERT_NE(nullptr, file);
+  std::fputs("definitely not a vector, but long enough to hold a header "
+             "of sixty-four bytes",
+             file);
+  std::fclose(file);
+
+  EXPECT_THROW(s21::mmap_vector<int>{path()}, std::invalid_argument);
+}
+
+TEST_F(TestMmapVector, At) {
+  s21::mmap_vector<int> vec(path());
+  vec.insert_many_back(1, 2, 3);
+
+  vec.at(1) = 5;
+  EXPECT_EQ(5, vec[1]);
+  EXPECT_THROW(vec.at(3), std::out_of_range);
+}
+
+TEST_F(TestMmapVector, AppendOwnElements) {
+  s21::mmap_vector<int> vec(path());
+  vec.insert_many_back(1, 2, 3);
+  vec.shrink_to_fit();
+  EXPECT_EQ(3, vec.capacity());
+
+  vec.append(vec.cbegin(), vec.cend());
+
+  EXPECT_EQ(6, vec.size());
+  EXPECT_EQ(1, vec[3]);
+  EXPECT_EQ(3, vec[5]);
+}
+
+TEST_F(TestMmapVector, ReserveAndShrink) {
+  s21::mmap_vector<int> vec(path());
+  vec.reserve(100);
+  EXPECT_EQ(100, vec.capacity());
+  vec.push_back(7);
+  vec.pop_back();
+  vec.push_back(8);
+
+  vec.shrink_to_fit();
+  EXPECT_EQ(1, vec.capacity());
+  EXPECT_EQ(8, vec.front());
+
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST_F(TestMmapVector, Move) {
+  s21::mmap_vector<int> vec(path());
+  vec.push_back(1);
+
+  s21::mmap_vector<int> moved(std::move(vec));
+  EXPECT_EQ(1, moved.size());
+  EXPECT_EQ(0, vec.size());
+  EXPECT_EQ(nullptr, vec.data());
+
+  vec = std::move(moved);
+  EXPECT_EQ(1, vec.front());
+}
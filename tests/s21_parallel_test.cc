@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+s21::vector<int64_t> Pseudorandom(size_t n) {
+  s21::vector<int64_t> result(n);
+  uint64_t state = 42;
+  for (size_t i = 0; i < n; ++i) {
+    state = state * 6364136223846793005ull + 1442695040888963407ull;
+    result[i] = static_cast<int64_t>(state >> 40) - (1 << 23);
+  }
+  return result;
+}
+
+}  // namespace
+
+TEST(TestParallel, ForEachAndTransform) {
+  s21::thread_pool pool(3);
+  for (size_t grain : {0u, 1u, 7u, 1000u}) {
+    auto policy = s21::execution::par.on(pool).with_grain(grain);
+    s21::vector<int64_t> items = Pseudorandom(1001);
+    s21::vector<int64_t> expected(items);
+    s21::for_each(policy, items.begin(), items.end(), [](int64_t &x) { x *= 3; });
+    std::for_each(expected.begin(), expected.end(), [](int64_t &x) { x *= 3; });
+    EXPECT_TRUE(std::equal(items.begin(), items.end(), expected.begin()));
+
+    s21::vector<int64_t> out(items.size());
+    auto end = s21::transform(policy, items.begin(), items.end(), out.begin(),
+                              [](int64_t x) { return x + 1; });
+    EXPECT_EQ(end, out.end());
+    for (size_t i = 0; i < items.size(); ++i) {
+      EXPECT_EQ(out[i], items[i] + 1);
+    }
+  }
+}
+
+TEST(TestParallel, ReduceKeepsOrderForNonCommutativeOps) {
+  s21::thread_pool pool(2);
+  s21::array<std::string, 10> words{"a", "b", "c", "d", "e",
+                                    "f", "g", "h", "i", "j"};
+  auto policy = s21::execution::par.on(pool).with_grain(3);
+  EXPECT_EQ(s21::reduce(policy, words.begin(), words.end(), std::string(">")),
+            ">abcdefghij");
+  EXPECT_EQ(s21::reduce(s21::execution::seq, words.begin(), words.end(),
+                        std::string(">")),
+            ">abcdefghij");
+  s21::vector<int64_t> empty;
+  EXPECT_EQ(s21::reduce(policy, empty.begin(), empty.end(), int64_t{5}), 5);
+}
+
+TEST(TestParallel, ReduceMatchesAccumulate) {
+  s21::vector<int64_t> items = Pseudorandom(100003);
+  int64_t expected = std::accumulate(items.begin(), items.end(), int64_t{0});
+  EXPECT_EQ(s21::reduce(s21::execution::par, items.begin(), items.end(),
+                        int64_t{0}),
+            expected);
+}
+
+TEST(TestParallel, Sort) {
+  s21::thread_pool pool(3);
+  for (size_t n : {0u, 1u, 2u, 17u, 1000u, 65537u}) {
+    for (size_t grain : {0u, 1u, 100u}) {
+      s21::vector<int64_t> items = Pseudorandom(n);
+      s21::vector<int64_t> expected(items);
+      std::sort(expected.begin(), expected.end());
+      s21::sort(s21::execution::par.on(pool).with_grain(grain), items.begin(),
+                items.end());
+      EXPECT_TRUE(std::equal(items.begin(), items.end(), expected.begin()));
+    }
+  }
+  s21::vector<int64_t> items = Pseudorandom(5000);
+  s21::sort(s21::execution::par.on(pool), items.begin(), items.end(),
+            std::greater<>());
+  EXPECT_TRUE(std::is_sorted(items.begin(), items.end(), std::greater<>()));
+}
+
+TEST(TestParallel, InclusiveScan) {
+  s21::thread_pool pool(3);
+  for (size_t n : {0u, 1u, 5u, 1000u, 30001u}) {
+    for (size_t grain : {0u, 1u, 64u}) {
+      s21::vector<int64_t> items = Pseudorandom(n);
+      s21::vector<int64_t> expected(n);
+      std::partial_sum(items.begin(), items.end(), expected.begin());
+      s21::vector<int64_t> out(n);
+      auto end = s21::inclusive_scan(s21::execution::par.on(pool).with_grain(grain),
+                                     items.begin(), items.end(), out.begin());
+      EXPECT_EQ(end, out.end());
+      EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()));
+      s21::inclusive_scan(s21::execution::par.on(pool).with_grain(grain),
+                          items.begin(), items.end(), items.begin());
+      EXPECT_TRUE(std::equal(items.begin(), items.end(), expected.begin()));
+    }
+  }
+}
+
+TEST(TestParallel, ExceptionPropagates) {
+  s21::thread_pool pool(2);
+  s21::vector<int64_t> items = Pseudorandom(100);
+  EXPECT_THROW(s21::for_each(s21::execution::par.on(pool).with_grain(1),
+                             items.begin(), items.end(),
+                             [](int64_t x) {
+                               if (x % 7 == 0) throw std::logic_error("bad");
+                             }),
+               std::logic_error);
+}
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+TEST(TestPersistentMap, VersionsAreIndependent) {
+  s21::persistent_map<int, std::string> empty;
+  auto one = empty.insert(1, "one");
+  auto two = one.insert(2, "two");
+  auto renamed = two.insert_or_assign(1, "uno");
+  auto erased = renamed.erase(2);
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(one.size(), 1u);
+  EXPECT_EQ(two.size(), 2u);
+  EXPECT_EQ(two.at(1), "one");
+  EXPECT_EQ(renamed.at(1), "uno");
+  EXPECT_EQ(renamed.size(), 2u);
+  EXPECT_EQ(erased.size(), 1u);
+  EXPECT_FALSE(erased.contains(2));
+  EXPECT_TRUE(two.contains(2));
+  EXPECT_THROW(erased.at(2), std::out_of_range);
+  EXPECT_EQ(one.insert(1, "uno").at(1), "one");
+  EXPECT_EQ(one.erase(7).size(), 1u);
+}
+
+TEST(TestPersistentMap, IterationAndBounds) {
+  s21::persistent_map<int, int> map{{4, 40}, {2, 20}, {8, 80}, {6, 60}};
+  int expected = 2;
+  for (auto iter = map.begin(); iter != map.end(); ++iter) {
+    EXPECT_EQ(iter->first, expected);
+    EXPECT_EQ((*iter).second, expected * 10);
+    expected += 2;
+  }
+  EXPECT_EQ(expected, 10);
+  EXPECT_EQ(map.lower_bound(4)->first, 4);
+  EXPECT_EQ(map.lower_bound(5)->first, 6);
+  EXPECT_EQ(map.upper_bound(4)->first, 6);
+  EXPECT_TRUE(map.upper_bound(8) == map.end());
+  EXPECT_TRUE(map.find(5) == map.end());
+  EXPECT_EQ(map.find(8)->second, 80);
+}
+
+TEST(TestPersistentMap, RandomHistoryAgainstMap) {
+  // Keeps every tenth version with a deep copy of s21::map beside it and
+  // checks them all at the end, so any sharing bug shows up as a
+  // version that changed after the fact.
+  s21::persistent_map<int, int> current;
+  s21::map<int, int> reference;
+  std::vector<s21::persistent_map<int, int>> versions;
+  std::vector<s21::map<int, int>> copies;
+  uint32_t state = 11u;
+  for (int i = 0; i < 3000; ++i) {
+    state = state * 1664525u + 1013904223u;
+    int key = static_cast<int>((state >> 8) % 256);
+    if ((state >> 20) % 3 != 0) {
+      current = current.insert_or_assign(key, i);
+      reference.insert_or_assign(key, i);
+    } else {
+      current = current.erase(key);
+      auto found = reference.find(key);
+      if (found != reference.end()) {
+        reference.erase(found);
+      }
+    }
+    if (i % 10 == 0) {
+      versions.push_back(current);
+      copies.push_back(reference);
+    }
+  }
+  for (size_t v = 0; v < versions.size(); ++v) {
+    ASSERT_EQ(versions[v].size(), copies[v].size());
+    auto expected = copies[v].cbegin();
+    for (auto iter = versions[v].begin(); iter != versions[v].end();
+         ++iter, ++expected) {
+      EXPECT_EQ(iter->first, (*expected).first);
+      EXPECT_EQ(iter->second, (*expected).second);
+    }
+  }
+}
+
+TEST(TestPersistentMap, Transient) {
+  s21::persistent_map<int, int> base{{1, 1}, {2, 2}};
+  auto edit = base.transient();
+  EXPECT_TRUE(edit.insert(3, 3));
+  EXPECT_FALSE(edit.insert(3, 30));
+  EXPECT_FALSE(edit.insert_or_assign(1, 10));
+  EXPECT_TRUE(edit.erase(2));
+  EXPECT_FALSE(edit.erase(2));
+  auto first = edit.persistent();
+  EXPECT_TRUE(edit.insert(4, 4));
+  auto second = edit.persistent();
+  EXPECT_EQ(base.size(), 2u);
+  EXPECT_EQ(base.at(1), 1);
+  EXPECT_EQ(first.size(), 2u);
+  EXPECT_EQ(first.at(1), 10);
+  EXPECT_FALSE(first.contains(4));
+  EXPECT_EQ(second.size(), 3u);
+  EXPECT_EQ(edit.at(4), 4);
+
+  s21::map<int, int> source;
+  for (int i = 0; i < 1000; ++i) {
+    source.insert(i, -i);
+  }
+  s21::persistent_map<int, int> built(source);
+  EXPECT_EQ(built.size(), 1000u);
+  EXPECT_EQ(built.at(999), -999);
+}
+
+TEST(TestPersistentMap, SharedAcrossThreads) {
+  s21::persistent_map<int, int> base;
+  for (int i = 0; i < 500; ++i) {
+    base = base.insert(i, i);
+  }
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([base, t] {
+      s21::persistent_map<int, int> mine = base;
+      for (int i = 0; i < 500; i += 2) {
+        mine = mine.insert_or_assign(i, t).erase(i + 1);
+      }
+      EXPECT_EQ(mine.size(), 250u);
+      EXPECT_EQ(mine.at(0), t);
+      EXPECT_EQ(base.at(0), 0);
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(base.size(), 500u);
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+TEST(TestPersistentVector, VersionsAreIndependent) {
+  s21::persistent_vector<std::string> empty;
+  auto one = empty.push_back("a");
+  auto two = one.push_back("b");
+  auto changed = two.set(0, "z");
+  auto popped = changed.pop_back();
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(one.size(), 1u);
+  EXPECT_EQ(two[1], "b");
+  EXPECT_EQ(two[0], "a");
+  EXPECT_EQ(changed.front(), "z");
+  EXPECT_EQ(changed.back(), "b");
+  EXPECT_EQ(popped.size(), 1u);
+  EXPECT_EQ(popped.at(0), "z");
+  EXPECT_THROW(popped.at(1), std::out_of_range);
+  EXPECT_THROW(popped.set(1, "x"), std::out_of_range);
+}
+
+TEST(TestPersistentVector, GrowsAndShrinksThroughLevels) {
+  // 40000 elements need three trie levels; every size on the way up and
+  // down is kept and checked against its own contents.
+  const int kCount = 40000;
+  std::vector<s21::persistent_vector<int>> versions;
+  s21::persistent_vector<int> current;
+  for (int i = 0; i < kCount; ++i) {
+    current = current.push_back(i);
+    if (i % 997 == 0) {
+      versions.push_back(current);
+    }
+  }
+  for (const auto &version : versions) {
+    int expected = 0;
+    for (auto iter = version.begin(); iter != version.end(); ++iter) {
+      ASSERT_EQ(*iter, expected);
+      ++expected;
+    }
+    EXPECT_EQ(static_cast<size_t>(expected), version.size());
+  }
+  for (int i = kCount; i > 0; --i) {
+    ASSERT_EQ(current.size(), static_cast<size_t>(i));
+    ASSERT_EQ(current.back(), i - 1);
+    current = current.pop_back();
+  }
+  EXPECT_TRUE(current.empty());
+  EXPECT_EQ(versions.back()[kCount / 2], kCount / 2);
+}
+
+TEST(TestPersistentVector, SetCopiesOnePath) {
+  s21::persistent_vector<int> base;
+  for (int i = 0; i < 5000; ++i) {
+    base = base.push_back(i);
+  }
+  auto changed = base.set(1234, -1).set(4999, -2).set(0, -3);
+  EXPECT_EQ(base[1234], 1234);
+  EXPECT_EQ(base[4999], 4999);
+  EXPECT_EQ(changed[1234], -1);
+  EXPECT_EQ(changed[4999], -2);
+  EXPECT_EQ(changed[0], -3);
+  EXPECT_EQ(changed[1235], 1235);
+  auto iter = changed.end();
+  --iter;
+  EXPECT_EQ(*iter, -2);
+  --iter;
+  EXPECT_EQ(*iter, 4998);
+}
+
+TEST(TestPersistentVector, Transient) {
+  s21::persistent_vector<int> base{1, 2, 3};
+  auto edit = base.transient();
+  for (int i = 4; i <= 100; ++i) {
+    edit.push_back(i);
+  }
+  auto hundred = edit.persistent();
+  edit.set(0, -1);
+  edit.pop_back();
+  auto later = edit.persistent();
+  EXPECT_EQ(base.size(), 3u);
+  EXPECT_EQ(hundred.size(), 100u);
+  EXPECT_EQ(hundred[0], 1);
+  EXPECT_EQ(hundred[99], 100);
+  EXPECT_EQ(later.size(), 99u);
+  EXPECT_EQ(later[0], -1);
+  EXPECT_EQ(edit[98], 99);
+  int sum = 0;
+  for (int value : hundred) {
+    sum += value;
+  }
+  EXPECT_EQ(sum, 5050);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "s21_containers.h"
+#include "tests/s21_test_random.h"
+
+namespace {
+
+template <typename Queue>
+std::vector<int> Drain(Queue &queue) {
+  std::vector<int> out;
+  while (!queue.empty()) {
+    out.push_back(queue.top());
+    queue.pop();
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(TestPriorityQueue, BasicConstructor) {
+  s21::priority_queue<int> queue;
+
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.size(), 0U);
+}
+
+TEST(TestPriorityQueue, PushPopInPriorityOrder) {
+  s21::priority_queue<int> queue;
+  for (int value : {5, 1, 9, 3, 9, 7}) {
+    queue.push(value);
+  }
+
+  EXPECT_EQ(queue.size(), 6U);
+  EXPECT_EQ(queue.top(), 9);
+  EXPECT_EQ(Drain(queue), (std::vector<int>{9, 9, 7, 5, 3, 1}));
+}
+
+TEST(TestPriorityQueue, CustomCompareGivesMinHeap) {
+  s21::priority_queue<int, s21::vector<int>, std::greater<int>> queue{4, 2, 8,
+                                                                      6};
+
+  EXPECT_EQ(queue.top(), 2);
+  EXPECT_EQ(Drain(queue), (std::vector<int>{2, 4, 6, 8}));
+}
+
+TEST(TestPriorityQueue, HeapifyFromRangeAndContainer) {
+  std::vector<int> items = {3, 14, 1, 5, 9, 2, 6, 5, 3, 5};
+  s21::priority_queue<int> from_range(items.begin(), items.end());
+  s21::vector<int> container = {3, 14, 1, 5, 9, 2, 6, 5, 3, 5};
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, 4> from_container(
+      std::less<int>(), std::move(container));
+
+  std::vector<int> expected = {14, 9, 6, 5, 5, 5, 3, 3, 2, 1};
+  EXPECT_EQ(Drain(from_range), expected);
+  EXPECT_EQ(Drain(from_container), expected);
+}
+
+TEST(TestPriorityQueue, EmplaceForwardsArguments) {
+  s21::priority_queue<std::string> queue;
+  queue.emplace(3, 'b');
+  queue.emplace("zz");
+  queue.push(std::string("a"));
+
+  EXPECT_EQ(queue.top(), "zz");
+  queue.pop();
+  EXPECT_EQ(queue.top(), "bbb");
+  queue.pop();
+  EXPECT_EQ(queue.top(), "a");
+}
+
+TEST(TestPriorityQueue, CopyMoveAndSwap) {
+  s21::priority_queue<int> queue1{1, 2, 3};
+  s21::priority_queue<int> queue2(queue1);
+  queue2.pop();
+  s21::priority_queue<int> queue3(std::move(queue2));
+  s21::priority_queue<int> queue4{10};
+  queue4.swap(queue3);
+
+  EXPECT_EQ(queue1.size(), 3U);
+  EXPECT_EQ(queue1.top(), 3);
+  EXPECT_EQ(queue4.size(), 2U);
+  EXPECT_EQ(queue4.top(), 2);
+  EXPECT_EQ(queue3.top(), 10);
+}
+
+TEST(TestPriorityQueue, AritiesMatchSortedOrder) {
+  s21::priority_queue<int> binary;
+  s21::priority_queue<int, s21::vector<int>, std::less<int>, 3> ternary;
+  s21::priority_queue<int, std::vector<int>, std::less<int>, 4> quaternary;
+  std::vector<int> expected;
+  uint64_t state = 88172645463325252ull;
+  for (int i = 0; i < 2000; ++i) {
+    int value = static_cast<int>(s21_test::NextRandom(state) % 500);
+    binary.push(value);
+    ternary.push(value);
+    quaternary.push(value);
+    expected.push_back(value);
+    // Interleave pops so sift-down runs on partially built heaps.
+    if (i % 7 == 6) {
+      std::sort(expected.begin(), expected.end());
+      EXPECT_EQ(binary.top(), expected.back());
+      EXPECT_EQ(ternary.top(), expected.back());
+      EXPECT_EQ(quaternary.top(), expected.back());
+      expected.pop_back();
+      binary.pop();
+      ternary.pop();
+      quaternary.pop();
+    }
+  }
+  std::sort(expected.rbegin(), expected.rend());
+
+  EXPECT_EQ(Drain(binary), expected);
+  EXPECT_EQ(Drain(ternary), expected);
+  EXPECT_EQ(Drain(quaternary), expected);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+// Walks a snapshot and checks it matches keys [0, count) * step.
+void ExpectKeys(const s21::rcu_map<int, int>::snapshot &view, int count,
+                int step) {
+  int expected = 0;
+  for (auto iter = view.begin(); iter != view.end(); ++iter) {
+    EXPECT_EQ(iter->first, expected * step);
+    ++expected;
+  }
+  EXPECT_EQ(expected, count);
+  EXPECT_EQ(view.size(), static_cast<size_t>(count));
+}
+
+}  // namespace
+
+TEST(TestRcuMap, SingleThreadBasics) {
+  s21::rcu_map<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert(1, "one"));
+  EXPECT_FALSE(map.insert(1, "uno"));
+  EXPECT_EQ(map.find(1).value(), "one");
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  EXPECT_TRUE(map.insert_or_assign(2, "two"));
+  EXPECT_EQ(map.find(1).value(), "uno");
+  EXPECT_FALSE(map.find(3).has_value());
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_TRUE(map.erase(2));
+  EXPECT_FALSE(map.erase(2));
+  EXPECT_FALSE(map.contains(2));
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  map.clear();
+}
+
+TEST(TestRcuMap, SnapshotIsFrozen) {
+  s21::rcu_map<int, int> map;
+  for (int i = 0; i < 100; ++i) {
+    map.insert(i, i);
+  }
+  s21::rcu_map<int, int>::snapshot before = map.read();
+  for (int i = 0; i < 100; i += 2) {
+    map.erase(i);
+  }
+  map.insert_or_assign(1, -1);
+  map.insert(1000, 1000);
+  ExpectKeys(before, 100, 1);
+  EXPECT_EQ(before.find(1)->second, 1);
+  EXPECT_TRUE(before.find(1000) == before.end());
+
+  s21::rcu_map<int, int>::snapshot after = map.read();
+  EXPECT_EQ(after.size(), 51u);
+  EXPECT_EQ(after.find(1)->second, -1);
+  EXPECT_TRUE(after.contains(1000));
+  EXPECT_FALSE(after.contains(0));
+}
+
+TEST(TestRcuMap, Bounds) {
+  s21::map<int, int> source;
+  for (int i = 0; i < 500; ++i) {
+    source.insert(i * 2, i);
+  }
+  s21::rcu_map<int, int> map(source);
+  auto view = map.read();
+  ExpectKeys(view, 500, 2);
+  EXPECT_EQ(view.lower_bound(10)->first, 10);
+  EXPECT_EQ(view.lower_bound(11)->first, 12);
+  EXPECT_EQ(view.upper_bound(10)->first, 12);
+  EXPECT_EQ(view.lower_bound(-3)->first, 0);
+  EXPECT_TRUE(view.lower_bound(999) == view.end());
+  EXPECT_TRUE(view.upper_bound(998) == view.end());
+  auto iter = view.lower_bound(101);
+  int next = 102;
+  for (int i = 0; i < 10; ++i, ++iter, next += 2) {
+    EXPECT_EQ(iter->first, next);
+  }
+}
+
+TEST(TestRcuMap, RandomAgainstMap) {
+  s21::rcu_map<int, int> map;
+  s21::map<int, int> reference;
+  uint32_t state = 7u;
+  for (int i = 0; i < 20000; ++i) {
+    state = state * 1664525u + 1013904223u;
+    int key = static_cast<int>((state >> 8) % 512);
+    if ((state >> 20) % 3 != 0) {
+      EXPECT_EQ(map.insert_or_assign(key, i), !reference.contains(key));
+      reference.insert_or_assign(key, i);
+    } else {
+      auto found = reference.find(key);
+      EXPECT_EQ(map.erase(key), found != reference.end());
+      if (found != reference.end()) {
+        reference.erase(found);
+      }
+    }
+  }
+  auto view = map.read();
+  EXPECT_EQ(view.size(), reference.size());
+  auto expected = reference.cbegin();
+  for (auto iter = view.begin(); iter != view.end(); ++iter, ++expected) {
+    EXPECT_EQ(iter->first, (*expected).first);
+    EXPECT_EQ(iter->second, (*expected).second);
+  }
+}
+
+TEST(TestRcuMap, ReadersDuringUpdates) {
+  // The writer keeps the sum of all values at zero by moving one unit
+  // between two keys per pair of updates; readers must only ever see
+  // versions where keys are sorted and at most one update is pending.
+  const int kKeys = 64;
+  s21::rcu_map<int, int> map;
+  for (int k = 0; k < kKeys; ++k) {
+    map.insert(k, 0);
+  }
+  std::atomic<bool> done(false);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 3; ++t) {
+    readers.emplace_back([&] {
+      while (!done.load()) {
+        auto view = map.read();
+        long sum = 0;
+        int previous = -1;
+        for (auto iter = view.begin(); iter != view.end(); ++iter) {
+          EXPECT_LT(previous, iter->first);
+          previous = iter->first;
+          sum += iter->second;
+        }
+        EXPECT_TRUE(sum == 0 || sum == 1);
+        EXPECT_EQ(view.size(), static_cast<size_t>(kKeys));
+      }
+    });
+  }
+  for (int i = 0; i < 2000; ++i) {
+    int from = i % kKeys;
+    int to = (i * 7 + 3) % kKeys;
+    map.insert_or_assign(to, map.find(to).value() + 1);
+    map.insert_or_assign(from, map.find(from).value() - 1);
+    if (i % 100 == 0) {
+      map.erase(kKeys + 1);
+    }
+  }
+  done.store(true);
+  for (std::thread &reader : readers) {
+    reader.join();
+  }
+  long sum = 0;
+  auto view = map.read();
+  for (auto iter = view.begin(); iter != view.end(); ++iter) {
+    sum += iter->second;
+  }
+  EXPECT_EQ(sum, 0);
+}
@@ -0,0 +1,332 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+struct Point {
+  int x;
+  int y;
+};
+
+struct Padded {
+  char tag;
+  int64_t value;
+};
+
+}  // namespace
+
+// Records are encoded field by field, never as their object representation.
+template <>
+struct s21::serializer<Point> {
+  static constexpr bool bulk = false;
+
+  static void save(std::ostream &os, const Point &point) {
+    s21::serial::write(os, point.x);
+    s21::serial::write(os, point.y);
+  }
+  static void load(std::istream &is, Point &point) {
+    s21::serial::read(is, point.x);
+    s21::serial::read(is, point.y);
+  }
+};
+
+template <>
+struct s21::serializer<Padded> {
+  static constexpr bool bulk = false;
+
+  static void save(std::ostream &os, const Padded &padded) {
+    s21::serial::write(os, padded.tag);
+    s21::serial::write(os, padded.value);
+  }
+  static void load(std::istream &is, Padded &padded) {
+    s21::serial::read(is, padded.tag);
+    s21::serial::read(is, padded.value);
+  }
+};
+
+namespace {
+
+template <typename Container>
+std::string Saved(const Container &container) {
+  std::ostringstream os;
+  container.save(os);
+  return os.str();
+}
+
+template <typename Container>
+Container Loaded(const std::string &bytes) {
+  std::istringstream is(bytes);
+  Container container;
+  container.load(is);
+  return container;
+}
+
+}  // namespace
+
+TEST(TestSerialize, HeaderLayout) {
+  s21::vector<uint32_t> vec({0x01020304, 5});
+  std::string bytes = Saved(vec);
+
+  ASSERT_EQ(16u + 8u, bytes.size());
+  EXPECT_EQ("S21S", bytes.substr(0, 4));
+  EXPECT_EQ(1, bytes[4]);
+  EXPECT_EQ(0, bytes[5]);
+  EXPECT_EQ(static_cast<char>(s21::serial_kind::kVector), bytes[6]);
+  EXPECT_EQ(0, bytes[7]);
+  EXPECT_EQ(2, bytes[8]);
+  EXPECT_EQ(0, bytes[15]);
+  EXPECT_EQ(4, bytes[16]);
+  EXPECT_EQ(1, bytes[19]);
+}
+
+TEST(TestSerialize, Vector) {
+  s21::vector<int> vec({1, -2, 3});
+  auto loaded = Loaded<s21::vector<int>>(Saved(vec));
+
+  ASSERT_EQ(3, loaded.size());
+  EXPECT_EQ(1, loaded[0]);
+  EXPECT_EQ(-2, loaded[1]);
+  EXPECT_EQ(3, loaded[2]);
+
+  s21::vector<int> empty;
+  EXPECT_TRUE(Loaded<s21::vector<int>>(Saved(empty)).empty());
+}
+
+TEST(TestSerialize, VectorOfStrings) {
+  s21::vector<std::string> vec({"", "two", std::string(300, 'x')});
+  auto loaded = Loaded<s21::vector<std::string>>(Saved(vec));
+
+  ASSERT_EQ(3, loaded.size());
+  EXPECT_EQ("", loaded[0]);
+  EXPECT_EQ("two", loaded[1]);
+  EXPECT_EQ(std::string(300, 'x'), loaded[2]);
+}
+
+TEST(TestSerialize, VectorOfRecords) {
+  s21::vector<Point> vec;
+  vec.push_back(Point{1, 2});
+  vec.push_back(Point{3, 4});
+  auto loaded = Loaded<s21::vector<Point>>(Saved(vec));
+
+  ASSERT_EQ(2, loaded.size());
+  EXPECT_EQ(3, loaded[1].x);
+  EXPECT_EQ(4, loaded[1].y);
+}
+
+TEST(TestSerialize, RecordsCarryNoPadding) {
+  static_assert(s21::serializer<int64_t>::bulk);
+  static_assert(!s21::serializer<Padded>::bulk);
+
+  s21::vector<Padded> vec;
+  vec.push_back(Padded{'a', -1});
+  std::string bytes = Saved(vec);
+  EXPECT_EQ(16u + 1u + 8u, bytes.size());
+
+  auto loaded = Loaded<s21::vector<Padded>>(bytes);
+  EXPECT_EQ('a', loaded[0].tag);
+  EXPECT_EQ(-1, loaded[0].value);
+}
+
+TEST(TestSerialize, NestedContainers) {
+  s21::vector<s21::list<int>> vec(2);
+  vec[0].push_back(1);
+  vec[1].insert_many_back(2, 3);
+  auto loaded = Loaded<s21::vector<s21::list<int>>>(Saved(vec));
+
+  ASSERT_EQ(2, loaded.size());
+  EXPECT_EQ(1, loaded[0].size());
+  EXPECT_EQ(2, loaded[1].front());
+  EXPECT_EQ(3, loaded[1].back());
+}
+
+TEST(TestSerialize, Array) {
+  s21::array<double, 3> arr({1.5, 2.5, 3.5});
+  auto loaded = Loaded<s21::array<double, 3>>(Saved(arr));
+  EXPECT_DOUBLE_EQ(2.5, loaded[1]);
+
+  std::istringstream is(Saved(arr));
+  s21::array<double, 4> other;
+  EXPECT_THROW(other.load(is), std::invalid_argument);
+}
+
+TEST(TestSerialize, ListQueueStack) {
+  s21::list<std::string> l({"a", "b", "c"});
+  auto loaded_list = Loaded<s21::list<std::string>>(Saved(l));
+  EXPECT_EQ(3, loaded_list.size());
+  EXPECT_EQ("a", loaded_list.front());
+  EXPECT_EQ("c", loaded_list.back());
+
+  s21::queue<int> q({1, 2, 3});
+  auto loaded_queue = Loaded<s21::queue<int>>(Saved(q));
+  EXPECT_EQ(1, loaded_queue.front());
+  EXPECT_EQ(3, loaded_queue.back());
+
+  s21::stack<int> s({1, 2, 3});
+  auto loaded_stack = Loaded<s21::stack<int>>(Saved(s));
+  EXPECT_EQ(3, loaded_stack.top());
+  EXPECT_EQ(3, loaded_stack.size());
+}
+
+TEST(TestSerialize, Map) {
+  s21::map<int, std::string> m;
+  for (int i = 0; i < 100; ++i) {
+    m.insert(i * 2, std::to_string(i));
+  }
+  auto loaded = Loaded<s21::map<int, std::string>>(Saved(m));
+
+  EXPECT_EQ(100, loaded.size());
+  EXPECT_EQ("42", loaded.at(84));
+  int expected = 0;
+  for (auto iter = loaded.begin(); iter != loaded.end(); ++iter) {
+    EXPECT_EQ(expected, (*iter).first);
+    expected += 2;
+  }
+}
+
+TEST(TestSerialize, LoadedTreeStaysBalanced) {
+  for (int n = 0; n < 40; ++n) {
+    s21::set<int> s;
+    for (int i = 0; i < n; ++i) {
+      s.insert(i * 10);
+    }
+    auto loaded = Loaded<s21::set<int>>(Saved(s));
+    ASSERT_EQ(n, loaded.size());
+
+    for (int i = 0; i < n; i += 2) {
+      loaded.erase(loaded.find(i * 10));
+    }
+    for (int i = 0; i < n; ++i) {
+      loaded.insert(i * 10 + 5);
+    }
+
+    int count = 0;
+    int previous = -1;
+    for (auto iter = loaded.begin(); iter != loaded.end(); ++iter) {
+      EXPECT_LT(previous, *iter);
+      previous = *iter;
+      ++count;
+    }
+    EXPECT_EQ(n - (n + 1) / 2 + n, count);
+  }
+}
+
+TEST(TestSerialize, SetAndMultiset) {
+  s21::set<std::string> s({"pear", "apple", "fig"});
+  auto loaded_set = Loaded<s21::set<std::string>>(Saved(s));
+  EXPECT_EQ(3, loaded_set.size());
+  EXPECT_EQ("apple", *loaded_set.begin());
+  EXPECT_TRUE(loaded_set.contains("pear"));
+
+  s21::multiset<int> ms({3, 1, 3, 2, 3});
+  auto loaded_multiset = Loaded<s21::multiset<int>>(Saved(ms));
+  EXPECT_EQ(5, loaded_multiset.size());
+  EXPECT_EQ(3, loaded_multiset.count(3));
+}
+
+TEST(TestSerialize, SmallVectorAndUnrolledList) {
+  s21::small_vector<int, 2> sv({1, 2, 3, 4});
+  auto loaded_sv = Loaded<s21::small_vector<int, 2>>(Saved(sv));
+  EXPECT_EQ(4, loaded_sv.size());
+  EXPECT_EQ(4, loaded_sv.back());
+
+  s21::small_vector<std::string> small({"x"});
+  auto loaded_small = Loaded<s21::small_vector<std::string>>(Saved(small));
+  EXPECT_TRUE(loaded_small.is_inline());
+  EXPECT_EQ("x", loaded_small.front());
+
+  s21::static_vector<std::string, 4> st({"p", "q"});
+  auto loaded_st = Loaded<s21::static_vector<std::string, 4>>(Saved(st));
+  EXPECT_EQ(2, loaded_st.size());
+  EXPECT_EQ("q", loaded_st.back());
+  EXPECT_THROW((Loaded<s21::static_vector<std::string, 1>>(Saved(st))),
+               std::invalid_argument);
+
+  s21::unrolled_list<int, 4> ul;
+  for (int i = 0; i < 10; ++i) {
+    ul.push_back(i);
+  }
+  auto loaded_ul = Loaded<s21::unrolled_list<int, 4>>(Saved(ul));
+  EXPECT_EQ(10, loaded_ul.size());
+  EXPECT_EQ(9, loaded_ul.back());
+}
+
+TEST(TestSerialize, SameBytesAcrossSequences) {
+  s21::vector<int> vec({1, 2, 3});
+  s21::list<int> l({1, 2, 3});
+  std::string vec_bytes = Saved(vec);
+  std::string list_bytes = Saved(l);
+
+  EXPECT_EQ(vec_bytes.substr(8), list_bytes.substr(8));
+}
+
+TEST(TestSerialize, RejectsOtherKind) {
+  s21::vector<int> vec({1});
+  std::istringstream is(Saved(vec));
+  s21::list<int> l({7});
+
+  EXPECT_THROW(l.load(is), std::invalid_argument);
+  EXPECT_EQ(7, l.front());
+}
+
+TEST(TestSerialize, RejectsBadMagicAndVersion) {
+  s21::vector<int> vec({1});
+  std::string bytes = Saved(vec);
+
+  std::string bad_magic = bytes;
+  bad_magic[0] = 'X';
+  EXPECT_THROW(Loaded<s21::vector<int>>(bad_magic), std::invalid_argument);
+
+  std::string bad_version = bytes;
+  bad_version[4] = 2;
+  EXPECT_THROW(Loaded<s21::vector<int>>(bad_version), std::invalid_argument);
+}
+
+TEST(TestSerialize, RejectsTruncatedStream) {
+  s21::map<int, std::string> m({{1, "one"}, {2, "two"}});
+  std::string bytes = Saved(m);
+  bytes.resize(bytes.size() - 1);
+
+  EXPECT_THROW((Loaded<s21::map<int, std::string>>(bytes)),
+               std::ios_base::failure);
+
+  // A vector payload shorter than its count means the count is corrupt.
+  s21::vector<int> vec({1, 2});
+  bytes = Saved(vec);
+  bytes.resize(bytes.size() - 2);
+  EXPECT_THROW(Loaded<s21::vector<int>>(bytes), std::invalid_argument);
+}
+
+TEST(TestSerialize, HugeCountFailsWithoutAllocatingIt) {
+  s21::vector<int> empty;
+  std::string bytes = Saved(empty);
+  bytes[8 + 4] = 0x10;  // 2^36 elements, no payload
+
+  EXPECT_THROW(Loaded<s21::vector<int>>(bytes), std::invalid_argument);
+
+  bytes[6] = static_cast<char>(s21::serial_kind::kSmallVector);
+  EXPECT_THROW((Loaded<s21::small_vector<int>>(bytes)), std::invalid_argument);
+  EXPECT_THROW((Loaded<s21::small_vector<std::string>>(bytes)),
+               std::invalid_argument);
+}
+
+TEST(TestSerialize, RejectsUnsortedTree) {
+  s21::vector<std::pair<int, int>> pairs;
+  pairs.push_back({2, 0});
+  pairs.push_back({1, 0});
+  std::string bytes = Saved(pairs);
+  bytes[6] = static_cast<char>(s21::serial_kind::kMap);
+
+  EXPECT_THROW((Loaded<s21::map<int, int>>(bytes)), std::invalid_argument);
+
+  s21::multiset<int> ms({1, 1});
+  bytes = Saved(ms);
+  bytes[6] = static_cast<char>(s21::serial_kind::kSet);
+  EXPECT_THROW(Loaded<s21::set<int>>(bytes), std::invalid_argument);
+}
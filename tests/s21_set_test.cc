@@ -184,4 +184,11 @@ TEST(SetTest, InsertMany) {
     --iter;
     EXPECT_EQ(*iter, i);
   }
-}
\ No newline at end of file
+}
+TEST(SetTest, LookupsOnConstSet) {
+  const s21::set<int> test({1, 3, 5});
+  EXPECT_TRUE(test.contains(3));
+  EXPECT_FALSE(test.contains(4));
+  EXPECT_EQ(*test.find(5), 5);
+  EXPECT_EQ(test.find(2), test.end());
+}
@@ -0,0 +1,146 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+TEST(TestSkiplistMap, SingleThreadBasics) {
+  s21::skiplist_map<int, std::string> map;
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.begin() == map.end());
+  auto inserted = map.insert(2, "two");
+  EXPECT_TRUE(inserted.second);
+  EXPECT_EQ(inserted.first->second, "two");
+  EXPECT_TRUE(map.insert(std::make_pair(1, std::string("one"))).second);
+  auto again = map.insert(1, "uno");
+  EXPECT_FALSE(again.second);
+  EXPECT_EQ((*again.first).second, "one");
+  EXPECT_EQ(map.size(), 2u);
+  EXPECT_TRUE(map.contains(1));
+  EXPECT_FALSE(map.contains(3));
+  EXPECT_EQ(map.find(2)->second, "two");
+  EXPECT_TRUE(map.find(3) == map.end());
+  EXPECT_TRUE(map.erase(1));
+  EXPECT_FALSE(map.erase(1));
+  EXPECT_FALSE(map.contains(1));
+  EXPECT_EQ(map.size(), 1u);
+}
+
+TEST(TestSkiplistMap, OrderedIterationAndBounds) {
+  s21::skiplist_map<int, int> map;
+  for (int i = 0; i < 1000; ++i) {
+    int key = (i * 7919) % 1000;
+    map.insert(key * 2, key);
+  }
+  int expected = 0;
+  for (auto iter = map.begin(); iter != map.end(); ++iter) {
+    EXPECT_EQ(iter->first, expected * 2);
+    EXPECT_EQ(iter->second, expected);
+    ++expected;
+  }
+  EXPECT_EQ(expected, 1000);
+  EXPECT_EQ(map.lower_bound(10)->first, 10);
+  EXPECT_EQ(map.lower_bound(11)->first, 12);
+  EXPECT_EQ(map.upper_bound(10)->first, 12);
+  EXPECT_EQ(map.lower_bound(-5)->first, 0);
+  EXPECT_TRUE(map.lower_bound(1999) == map.end());
+  EXPECT_TRUE(map.upper_bound(1998) == map.end());
+  for (int key = 0; key < 2000; key += 4) {
+    EXPECT_TRUE(map.erase(key));
+  }
+  EXPECT_EQ(map.size(), 500u);
+  EXPECT_EQ(map.begin()->first, 2);
+  EXPECT_EQ(map.lower_bound(4)->first, 6);
+  EXPECT_EQ(map.upper_bound(6)->first, 10);
+}
+
+TEST(TestSkiplistMap, IteratorSkipsConcurrentlyErased) {
+  s21::skiplist_map<int, int> map;
+  for (int i = 0; i < 10; ++i) {
+    map.insert(i, i);
+  }
+  auto iter = map.find(3);
+  map.erase(4);
+  map.erase(5);
+  ++iter;
+  EXPECT_EQ(iter->first, 6);
+}
+
+TEST(TestSkiplistMap, ConcurrentDisjointInserts) {
+  const int kThreads = 4;
+  const int kPerThread = 2000;
+  s21::skiplist_map<int, int> map;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        EXPECT_TRUE(map.insert(i * kThreads + t, t).second);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(map.size(), static_cast<size_t>(kThreads * kPerThread));
+  int expected = 0;
+  for (auto iter = map.begin(); iter != map.end(); ++iter) {
+    EXPECT_EQ(iter->first, expected);
+    EXPECT_EQ(iter->second, expected % kThreads);
+    ++expected;
+  }
+  EXPECT_EQ(expected, kThreads * kPerThread);
+}
+
+TEST(TestSkiplistMap, ConcurrentInsertEraseSameKeys) {
+  // Every thread toggles the same small key range; per key, successful
+  // inserts and erases must alternate, so the counts differ by the final
+  // presence of the key.
+  const int kThreads = 4;
+  const int kKeys = 64;
+  const int kRounds = 4000;
+  s21::skiplist_map<int, int> map;
+  std::atomic<long> inserted[kKeys];
+  std::atomic<long> erased[kKeys];
+  for (int k = 0; k < kKeys; ++k) {
+    inserted[k].store(0);
+    erased[k].store(0);
+  }
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t] {
+      uint32_t state = 12345u + static_cast<uint32_t>(t);
+      for (int i = 0; i < kRounds; ++i) {
+        state = state * 1664525u + 1013904223u;
+        int key = static_cast<int>((state >> 8) % kKeys);
+        if ((state >> 20) & 1) {
+          if (map.insert(key, t).second) {
+            inserted[key].fetch_add(1);
+          }
+        } else if (map.erase(key)) {
+          erased[key].fetch_add(1);
+        }
+        if (i % 256 == 0) {
+          int previous = -1;
+          for (auto iter = map.begin(); iter != map.end(); ++iter) {
+            EXPECT_LT(previous, iter->first);
+            previous = iter->first;
+          }
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  size_t present = 0;
+  for (int k = 0; k < kKeys; ++k) {
+    long balance = inserted[k].load() - erased[k].load();
+    EXPECT_EQ(balance, map.contains(k) ? 1 : 0) << "key " << k;
+    present += map.contains(k);
+  }
+  EXPECT_EQ(map.size(), present);
+}
@@ -0,0 +1,243 @@
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "s21_containersplus.h"
+
+namespace {
+
+// Counts live objects; the move constructor throws once `moves_left`
+// reaches zero.
+struct MoveBomb {
+  static int alive;
+  static int moves_left;
+
+  MoveBomb() { ++alive; }
+  MoveBomb(const MoveBomb &) { ++alive; }
+  MoveBomb(MoveBomb &&) {
+    if (moves_left-- == 0) {
+      throw std::runtime_error("move failed");
+    }
+    ++alive;
+  }
+  MoveBomb &operator=(const MoveBomb &) = default;
+  ~MoveBomb() { --alive; }
+};
+
+int MoveBomb::alive = 0;
+int MoveBomb::moves_left = 0;
+
+}  // namespace
+
+TEST(TestSmallVector, BasicConstructor) {
+  s21::small_vector<int, 4> vec;
+  EXPECT_EQ(0, vec.size());
+  EXPECT_EQ(4, vec.capacity());
+  EXPECT_TRUE(vec.is_inline());
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST(TestSmallVector, SizeConstructor) {
+  s21::small_vector<double, 4> small(3);
+  s21::small_vector<double, 4> big(10);
+
+  EXPECT_TRUE(small.is_inline());
+  EXPECT_FALSE(big.is_inline());
+  EXPECT_EQ(10, big.size());
+  for (size_t i = 0; i < big.size(); ++i) {
+    EXPECT_DOUBLE_EQ(0, big[i]);
+  }
+}
+
+TEST(TestSmallVector, InitializerListConstructor) {
+  s21::small_vector<char, 8> vec({'a', 'b', 'c'});
+  EXPECT_EQ(3, vec.size());
+  EXPECT_TRUE(vec.is_inline());
+  EXPECT_EQ('a', vec.front());
+  EXPECT_EQ('c', vec.back());
+}
+
+TEST(TestSmallVector, SpillAndUnspill) {
+  s21::small_vector<std::string, 2> vec;
+  vec.push_back("one");
+  vec.push_back("two");
+  EXPECT_TRUE(vec.is_inline());
+
+  vec.push_back("three");
+  EXPECT_FALSE(vec.is_inline());
+  EXPECT_EQ(3, vec.size());
+  EXPECT_GE(vec.capacity(), 3);
+  EXPECT_EQ("one", vec[0]);
+  EXPECT_EQ("three", vec[2]);
+
+  vec.pop_back();
+  vec.shrink_to_fit();
+  EXPECT_TRUE(vec.is_inline());
+  EXPECT_EQ(2, vec.capacity());
+  EXPECT_EQ("one", vec[0]);
+  EXPECT_EQ("two", vec[1]);
+}
+
+TEST(TestSmallVector, PushBackOwnElement) {
+  s21::small_vector<std::string, 2> vec({"abobus", "x"});
+  vec.push_back(vec[0]);
+  EXPECT_EQ("abobus", vec.back());
+}
+
+TEST(TestSmallVector, CopyInlineAndHeap) {
+  s21::small_vector<std::string, 2> inline_vec({"a", "b"});
+  s21::small_vector<std::string, 2> heap_vec({"a", "b", "c"});
+
+  s21::small_vector<std::string, 2> inline_copy(inline_vec);
+  s21::small_vector<std::string, 2> heap_copy(heap_vec);
+
+  EXPECT_TRUE(inline_copy.is_inline());
+  EXPECT_EQ(2, inline_copy.size());
+  EXPECT_NE(heap_copy.data(), heap_vec.data());
+  EXPECT_EQ("c", heap_copy[2]);
+
+  inline_copy = heap_vec;
+  EXPECT_EQ(3, inline_copy.size());
+  EXPECT_EQ("c", inline_copy.back());
+}
+
+TEST(TestSmallVector, MoveHeapStealsBuffer) {
+  s21::small_vector<int, 2> origin({1, 2, 3, 4});
+  int *data = origin.data();
+
+  s21::small_vector<int, 2> moved(std::move(origin));
+
+  EXPECT_EQ(data, moved.data());
+  EXPECT_EQ(4, moved.size());
+  EXPECT_TRUE(origin.empty());
+  EXPECT_TRUE(origin.is_inline());
+}
+
+TEST(TestSmallVector, MoveInline) {
+  s21::small_vector<std::string, 4> origin({"a", "b"});
+  s21::small_vector<std::string, 4> moved;
+  moved = std::move(origin);
+
+  EXPECT_TRUE(moved.is_inline());
+  EXPECT_EQ(2, moved.size());
+  EXPECT_EQ("b", moved.back());
+  EXPECT_TRUE(origin.empty());
+}
+
+TEST(TestSmallVector, At) {
+  s21::small_vector<int, 2> vec({1, 2, 3});
+  EXPECT_EQ(3, vec.at(2));
+  EXPECT_THROW(vec.at(3), std::out_of_range);
+}
+
+TEST(TestSmallVector, Iterators) {
+  s21::small_vector<int, 4> vec({1, 2, 3, 4, 5});
+  int expected = 1;
+  for (auto iter = vec.cbegin(); iter != vec.cend(); ++iter, ++expected) {
+    EXPECT_EQ(expected, *iter);
+  }
+  for (auto iter = vec.begin(); iter != vec.end(); ++iter) {
+    *iter *= 2;
+  }
+  EXPECT_EQ(10, vec.back());
+}
+
+TEST(TestSmallVector, Reserve) {
+  s21::small_vector<int, 4> vec({1, 2});
+  vec.reserve(3);
+  EXPECT_TRUE(vec.is_inline());
+  vec.reserve(16);
+  EXPECT_FALSE(vec.is_inline());
+  EXPECT_EQ(16, vec.capacity());
+  EXPECT_EQ(2, vec[1]);
+}
+
+TEST(TestSmallVector, InsertAndErase) {
+  s21::small_vector<std::string, 3> vec({"a", "c"});
+
+  auto pos = vec.insert(vec.begin() + 1, "b");
+  EXPECT_EQ("b", *pos);
+  pos = vec.insert(vec.end(), "d");
+  EXPECT_EQ("d", *pos);
+  pos = vec.insert(vec.begin(), "_");
+  EXPECT_EQ("_", *pos);
+
+  std::string text;
+  for (auto iter = vec.begin(); iter != vec.end(); ++iter) {
+    text += *iter;
+  }
+  EXPECT_EQ("_abcd", text);
+
+  vec.erase(vec.begin());
+  vec.erase(vec.begin() + 1);
+  text.clear();
+  for (auto iter = vec.begin(); iter != vec.end(); ++iter) {
+    text += *iter;
+  }
+  EXPECT_EQ("acd", text);
+}
+
+TEST(TestSmallVector, InsertMany) {
+  s21::small_vector<char, 4> vec({'a', 's'});
+  auto pos = vec.insert_many(vec.cbegin() + 1, 'b', 'o', 'b', 'u');
+
+  EXPECT_EQ('b', *pos);
+  EXPECT_EQ(6, vec.size());
+  std::string text(vec.cbegin(), vec.cend());
+  EXPECT_EQ("abobus", text);
+
+  vec.insert_many(vec.cbegin());
+  EXPECT_EQ(6, vec.size());
+}
+
+TEST(TestSmallVector, InsertManyBack) {
+  s21::small_vector<std::string, 2> vec({"a"});
+  vec.insert_many_back(vec[0], "b", std::string("c"));
+
+  EXPECT_EQ(4, vec.size());
+  EXPECT_EQ("a", vec[1]);
+  EXPECT_EQ("c", vec.back());
+}
+
+TEST(TestSmallVector, Swap) {
+  s21::small_vector<int, 2> inline_vec({1});
+  s21::small_vector<int, 2> heap_vec({1, 2, 3});
+
+  inline_vec.swap(heap_vec);
+
+  EXPECT_EQ(3, inline_vec.size());
+  EXPECT_FALSE(inline_vec.is_inline());
+  EXPECT_EQ(1, heap_vec.size());
+  EXPECT_TRUE(heap_vec.is_inline());
+}
+
+TEST(TestSmallVector, Clear) {
+  s21::small_vector<std::string, 2> vec({"a", "b", "c"});
+  auto capacity = vec.capacity();
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(capacity, vec.capacity());
+}
+
+TEST(TestSmallVector, ConstAccess) {
+  const s21::small_vector<int, 2> vec({1, 2, 3});
+  EXPECT_EQ(1, vec[0]);
+  EXPECT_EQ(3, vec.at(2));
+  EXPECT_EQ(vec.data() + 1, &vec[1]);
+  EXPECT_THROW(vec.at(3), std::out_of_range);
+}
+
+TEST(TestSmallVector, ThrowingMoveWhileGrowing) {
+  MoveBomb::alive = 0;
+  {
+    s21::small_vector<MoveBomb, 4> vec(4);
+    MoveBomb::moves_left = 2;
+    EXPECT_THROW(vec.push_back(MoveBomb()), std::runtime_error);
+    EXPECT_EQ(4, vec.size());
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(4, MoveBomb::alive);
+  }
+  EXPECT_EQ(0, MoveBomb::alive);
+}
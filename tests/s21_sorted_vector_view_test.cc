@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+// Sorted values with duplicates and gaps.
+s21::vector<int> Sorted(size_t n) {
+  s21::vector<int> result;
+  for (size_t i = 0; i < n; ++i) {
+    result.push_back(static_cast<int>(i / 3 * 4));
+  }
+  return result;
+}
+
+void ExpectMatchesStd(const s21::sorted_vector_view<int> &view) {
+  for (int key = -2; key <= static_cast<int>(view.size()) * 2 + 2; ++key) {
+    EXPECT_EQ(view.lower_bound(key),
+              std::lower_bound(view.begin(), view.end(), key));
+    EXPECT_EQ(view.upper_bound(key),
+              std::upper_bound(view.begin(), view.end(), key));
+    EXPECT_EQ(view.contains(key),
+              std::binary_search(view.begin(), view.end(), key));
+  }
+}
+
+}  // namespace
+
+TEST(TestSortedVectorView, Empty) {
+  s21::sorted_vector_view<int> view;
+  EXPECT_TRUE(view.empty());
+  EXPECT_EQ(view.lower_bound(1), view.end());
+  EXPECT_EQ(view.find(1), view.end());
+  view.build_index();
+  EXPECT_TRUE(view.has_index());
+  EXPECT_FALSE(view.contains(0));
+}
+
+TEST(TestSortedVectorView, BranchlessMatchesStd) {
+  for (size_t n : {1u, 2u, 3u, 7u, 8u, 9u, 100u, 1025u}) {
+    s21::vector<int> items = Sorted(n);
+    s21::sorted_vector_view<int> view(items);
+    EXPECT_EQ(view.size(), n);
+    EXPECT_FALSE(view.has_index());
+    ExpectMatchesStd(view);
+  }
+}
+
+TEST(TestSortedVectorView, PrefetchingPathMatchesStd) {
+  s21::vector<int> items = Sorted(40000);
+  s21::sorted_vector_view<int> view(items);
+  ExpectMatchesStd(view);
+}
+
+TEST(TestSortedVectorView, IndexMatchesStd) {
+  for (size_t n : {1u, 2u, 5u, 15u, 16u, 17u, 1000u, 5000u}) {
+    s21::vector<int> items = Sorted(n);
+    s21::sorted_vector_view<int> view(items);
+    view.build_index();
+    EXPECT_TRUE(view.has_index());
+    ExpectMatchesStd(view);
+    view.drop_index();
+    EXPECT_FALSE(view.has_index());
+    ExpectMatchesStd(view);
+  }
+}
+
+TEST(TestSortedVectorView, FindReturnsFirstEqual) {
+  s21::vector<int> items{1, 3, 3, 3, 7};
+  s21::sorted_vector_view<int> view(items);
+  EXPECT_EQ(view.find(3), items.begin() + 1);
+  EXPECT_EQ(view.find(4), view.end());
+  view.build_index();
+  EXPECT_EQ(view.find(3), items.begin() + 1);
+  EXPECT_EQ(view.find(8), view.end());
+  EXPECT_EQ(view[4], 7);
+}
+
+TEST(TestSortedVectorView, ArrayAndStrings) {
+  const s21::array<std::string, 4> words{"apple", "kiwi", "lime", "pear"};
+  s21::sorted_vector_view<std::string> view(words);
+  EXPECT_EQ(view.lower_bound("banana"), words.begin() + 1);
+  view.build_index();
+  EXPECT_TRUE(view.contains("lime"));
+  EXPECT_EQ(view.upper_bound("zebra"), view.end());
+}
+
+TEST(TestSortedVectorView, SubRange) {
+  s21::vector<int> items{0, 10, 20, 30, 40, 50};
+  s21::sorted_vector_view<int> view(items.begin() + 2, items.begin() + 5);
+  EXPECT_EQ(view.size(), 3u);
+  EXPECT_EQ(view.lower_bound(5), items.begin() + 2);
+  EXPECT_EQ(view.lower_bound(45), items.begin() + 5);
+  EXPECT_FALSE(view.contains(50));
+}
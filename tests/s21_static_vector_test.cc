@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "s21_containersplus.h"
+
+namespace {
+
+struct Tracked {
+  static int alive;
+
+  Tracked() : value(0) { ++alive; }
+  explicit Tracked(int v) : value(v) { ++alive; }
+  Tracked(const Tracked &other) : value(other.value) { ++alive; }
+  Tracked(Tracked &&other) noexcept : value(other.value) { ++alive; }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) = default;
+  ~Tracked() { --alive; }
+
+  int value;
+};
+
+int Tracked::alive = 0;
+
+struct ThrowingMove {
+  ThrowingMove() = default;
+  ThrowingMove(const ThrowingMove &) = default;
+  ThrowingMove(ThrowingMove &&) noexcept(false) {}
+  ThrowingMove &operator=(const ThrowingMove &) = default;
+};
+
+}  // namespace
+
+TEST(TestStaticVector, BasicConstructor) {
+  s21::static_vector<int, 4> vec;
+  EXPECT_EQ(0, vec.size());
+  EXPECT_EQ(4, vec.capacity());
+  EXPECT_EQ(4, vec.max_size());
+  EXPECT_TRUE(vec.empty());
+}
+
+TEST(TestStaticVector, CapacityIsConstexpr) {
+  static_assert(s21::static_vector<int, 8>::capacity() == 8);
+  static_assert(s21::static_vector<int, 8>::max_size() == 8);
+  constexpr size_t kSlots = s21::static_vector<char, 3>::capacity();
+  EXPECT_EQ(3, kSlots);
+}
+
+TEST(TestStaticVector, ConstructsOnlyWhatIsPushed) {
+  Tracked::alive = 0;
+  {
+    s21::static_vector<Tracked, 16> vec;
+    EXPECT_EQ(0, Tracked::alive);
+    vec.push_back(Tracked(1));
+    vec.push_back(Tracked(2));
+    EXPECT_EQ(2, Tracked::alive);
+    vec.pop_back();
+    EXPECT_EQ(1, Tracked::alive);
+  }
+  EXPECT_EQ(0, Tracked::alive);
+}
+
+TEST(TestStaticVector, SizeConstructor) {
+  s21::static_vector<double, 4> vec(3);
+  EXPECT_EQ(3, vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_DOUBLE_EQ(0, vec[i]);
+  }
+  EXPECT_THROW((s21::static_vector<double, 4>(5)), std::length_error);
+}
+
+TEST(TestStaticVector, InitializerListConstructor) {
+  s21::static_vector<char, 8> vec({'a', 'b', 'c'});
+  EXPECT_EQ(3, vec.size());
+  EXPECT_EQ('a', vec.front());
+  EXPECT_EQ('c', vec.back());
+  EXPECT_THROW((s21::static_vector<char, 2>({'a', 'b', 'c'})),
+               std::length_error);
+}
+
+TEST(TestStaticVector, PushBackPastCapacityThrows) {
+  s21::static_vector<std::string, 2> vec;
+  vec.push_back("one");
+  vec.push_back("two");
+  EXPECT_THROW(vec.push_back("three"), std::length_error);
+  EXPECT_EQ(2, vec.size());
+  EXPECT_EQ("two", vec.back());
+}
+
+TEST(TestStaticVector, CopyAndMove) {
+  s21::static_vector<std::string, 4> source({"a", "b", "c"});
+  s21::static_vector<std::string, 4> copy(source);
+  EXPECT_EQ(3, copy.size());
+  EXPECT_EQ("b", copy[1]);
+
+  s21::static_vector<std::string, 4> moved(std::move(source));
+  EXPECT_EQ(3, moved.size());
+  EXPECT_EQ("c", moved.back());
+  EXPECT_TRUE(source.empty());
+
+  s21::static_vector<std::string, 4> assigned({"x"});
+  assigned = copy;
+  EXPECT_EQ(3, assigned.size());
+  assigned = std::move(moved);
+  EXPECT_EQ("a", assigned.front());
+  EXPECT_TRUE(moved.empty());
+  assigned = {"p", "q"};
+  EXPECT_EQ(2, assigned.size());
+  EXPECT_EQ("q", assigned.back());
+}
+
+TEST(TestStaticVector, MoveOnlyElements) {
+  s21::static_vector<std::unique_ptr<int>, 4> vec;
+  vec.push_back(std::make_unique<int>(7));
+  vec.insert_many_back(std::make_unique<int>(8), std::make_unique<int>(9));
+  s21::static_vector<std::unique_ptr<int>, 4> moved(std::move(vec));
+  EXPECT_EQ(3, moved.size());
+  EXPECT_EQ(9, *moved[2]);
+}
+
+TEST(TestStaticVector, MoveIsNoexceptWhenElementMoveIs) {
+  using Strings = s21::static_vector<std::string, 4>;
+  using Throwing = s21::static_vector<ThrowingMove, 4>;
+  static_assert(std::is_nothrow_move_constructible_v<Strings>);
+  static_assert(std::is_nothrow_move_assignable_v<Strings>);
+  static_assert(!std::is_nothrow_move_constructible_v<Throwing>);
+  static_assert(!std::is_nothrow_move_assignable_v<Throwing>);
+
+  Throwing source(2);
+  Throwing moved(std::move(source));
+  EXPECT_EQ(2, moved.size());
+}
+
+TEST(TestStaticVector, At) {
+  s21::static_vector<int, 4> vec({1, 2});
+  EXPECT_EQ(2, vec.at(1));
+  EXPECT_THROW(vec.at(2), std::out_of_range);
+}
+
+TEST(TestStaticVector, Iterators) {
+  s21::static_vector<int, 8> vec({1, 2, 3, 4});
+  int sum = 0;
+  for (int value : vec) {
+    sum += value;
+  }
+  EXPECT_EQ(10, sum);
+  EXPECT_EQ(4, vec.cend() - vec.cbegin());
+  EXPECT_EQ(vec.data(), vec.begin());
+}
+
+TEST(TestStaticVector, Reserve) {
+  s21::static_vector<int, 4> vec;
+  vec.reserve(4);
+  vec.shrink_to_fit();
+  EXPECT_EQ(4, vec.capacity());
+  EXPECT_THROW(vec.reserve(5), std::length_error);
+}
+
+TEST(TestStaticVector, InsertAndErase) {
+  s21::static_vector<std::string, 8> vec({"a", "c"});
+  auto it = vec.insert(vec.begin() + 1, "b");
+  EXPECT_EQ("b", *it);
+  EXPECT_EQ(3, vec.size());
+  vec.insert(vec.begin(), vec[2]);
+  EXPECT_EQ("c", vec.front());
+  EXPECT_EQ("c", vec.back());
+
+  vec.erase(vec.begin());
+  EXPECT_EQ("a", vec.front());
+  vec.erase(vec.cbegin(), vec.cbegin() + 2);
+  EXPECT_EQ(1, vec.size());
+  EXPECT_EQ("c", vec.front());
+}
+
+TEST(TestStaticVector, InsertMany) {
+  Tracked::alive = 0;
+  {
+    s21::static_vector<Tracked, 8> vec;
+    vec.insert_many_back(Tracked(1), Tracked(4));
+    vec.insert_many(vec.cbegin() + 1, Tracked(2), Tracked(3));
+    EXPECT_EQ(4, vec.size());
+    for (size_t i = 0; i < vec.size(); ++i) {
+      EXPECT_EQ(static_cast<int>(i + 1), vec[i].value);
+    }
+    EXPECT_EQ(4, Tracked::alive);
+  }
+  EXPECT_EQ(0, Tracked::alive);
+}
+
+TEST(TestStaticVector, InsertManyPastCapacityLeavesVectorIntact) {
+  s21::static_vector<int, 4> vec({1, 2, 3});
+  EXPECT_THROW(vec.insert_many(vec.cbegin(), 8, 9), std::length_error);
+  EXPECT_EQ(3, vec.size());
+  EXPECT_EQ(1, vec.front());
+  vec.insert_many_back(4);
+  EXPECT_EQ(4, vec.back());
+}
+
+TEST(TestStaticVector, Swap) {
+  s21::static_vector<std::string, 4> first({"a"});
+  s21::static_vector<std::string, 4> second({"x", "y"});
+  first.swap(second);
+  EXPECT_EQ(2, first.size());
+  EXPECT_EQ("y", first.back());
+  EXPECT_EQ("a", second.front());
+}
+
+TEST(TestStaticVector, Clear) {
+  Tracked::alive = 0;
+  s21::static_vector<Tracked, 4> vec(4);
+  EXPECT_EQ(4, Tracked::alive);
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(0, Tracked::alive);
+}
@@ -0,0 +1,19 @@
+#ifndef SRC_TESTS_S21_TEST_RANDOM_H_
+#define SRC_TESTS_S21_TEST_RANDOM_H_
+
+#include <cstdint>
+
+namespace s21_test {
+
+// xorshift64: a fast, reproducible sequence for randomized tests. The
+// state must not start at zero.
+inline uint64_t NextRandom(uint64_t &state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+  return state;
+}
+
+}  // namespace s21_test
+
+#endif  // SRC_TESTS_S21_TEST_RANDOM_H_
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <future>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <thread>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+namespace {
+
+size_t Fib(s21::thread_pool &pool, size_t n) {
+  if (n < 12) {
+    return n < 2 ? n : Fib(pool, n - 1) + Fib(pool, n - 2);
+  }
+  size_t left = 0;
+  s21::task_group group(pool);
+  group.run([&] { left = Fib(pool, n - 1); });
+  size_t right = Fib(pool, n - 2);
+  group.wait();
+  return left + right;
+}
+
+}  // namespace
+
+TEST(TestThreadPool, RunsAllTasks) {
+  s21::thread_pool pool(3);
+  EXPECT_EQ(pool.size(), 3u);
+  std::atomic<int> sum(0);
+  s21::task_group group(pool);
+  for (int i = 1; i <= 1000; ++i) {
+    group.run([&sum, i] { sum += i; });
+  }
+  group.wait();
+  EXPECT_EQ(sum.load(), 500500);
+}
+
+TEST(TestThreadPool, ZeroWorkersRunOnWaiter) {
+  s21::thread_pool pool(0);
+  std::thread::id caller = std::this_thread::get_id();
+  bool same_thread = false;
+  s21::task_group group(pool);
+  group.run([&] { same_thread = std::this_thread::get_id() == caller; });
+  group.wait();
+  EXPECT_TRUE(same_thread);
+  EXPECT_FALSE(pool.run_pending());
+}
+
+TEST(TestThreadPool, NestedGroups) {
+  s21::thread_pool pool(2);
+  EXPECT_EQ(Fib(pool, 22), 17711u);
+}
+
+TEST(TestThreadPool, RethrowsFirstException) {
+  s21::thread_pool pool(2);
+  s21::task_group group(pool);
+  std::atomic<int> ran(0);
+  for (int i = 0; i < 8; ++i) {
+    group.run([&ran] {
+      ++ran;
+      throw std::runtime_error("task");
+    });
+  }
+  EXPECT_THROW(group.wait(), std::runtime_error);
+  EXPECT_EQ(ran.load(), 8);
+  group.wait();
+}
+
+TEST(TestThreadPool, FailedRunIsNotWaitedFor) {
+  struct ThrowsOnCopy {
+    ThrowsOnCopy() = default;
+    ThrowsOnCopy(const ThrowsOnCopy &) { throw std::bad_alloc(); }
+    void operator()() const {}
+  };
+
+  s21::thread_pool pool(1);
+  s21::task_group group(pool);
+  ThrowsOnCopy task;
+  EXPECT_THROW(group.run(task), std::bad_alloc);
+  group.wait();
+}
+
+TEST(TestThreadPool, PostFromOutside) {
+  s21::thread_pool pool(2);
+  std::atomic<int> done(0);
+  for (int i = 0; i < 100; ++i) {
+    pool.post([&done] { ++done; });
+  }
+  while (done.load() < 100) {
+    pool.run_pending();
+  }
+  EXPECT_EQ(done.load(), 100);
+}
+
+TEST(TestThreadPool, SubmitReturnsFuture) {
+  s21::thread_pool pool(2);
+  std::future<int> answer = pool.submit([] { return 6 * 7; });
+  std::future<std::string> text = pool.submit([] { return std::string("s21"); });
+  std::future<void> failing =
+      pool.submit([] { throw std::invalid_argument("submit"); });
+  EXPECT_EQ(answer.get(), 42);
+  EXPECT_EQ(text.get(), "s21");
+  EXPECT_THROW(failing.get(), std::invalid_argument);
+}
+
+TEST(TestThreadPool, WaitFinishesEverything) {
+  s21::thread_pool pool(3);
+  std::atomic<int> done(0);
+  for (int i = 0; i < 500; ++i) {
+    pool.post([&pool, &done] {
+      // Tasks that spawn more tasks land on the worker's own deque.
+      pool.post([&done] { ++done; });
+    });
+  }
+  pool.wait();
+  EXPECT_EQ(done.load(), 500);
+}
+
+TEST(TestThreadPool, ParallelFor) {
+  s21::thread_pool pool(3);
+  for (size_t grain : {0u, 1u, 10u, 5000u}) {
+    std::vector<std::atomic<int>> hits(4096);
+    pool.parallel_for(3, hits.size(), [&hits](size_t i) { ++hits[i]; }, grain);
+    for (size_t i = 0; i < hits.size(); ++i) {
+      ASSERT_EQ(hits[i].load(), i < 3 ? 0 : 1) << i;
+    }
+  }
+  pool.parallel_for(5, 5, [](size_t) { FAIL(); });
+  EXPECT_THROW(pool.parallel_for(0, 100,
+                                 [](size_t i) {
+                                   if (i == 50) throw std::range_error("pf");
+                                 },
+                                 1),
+               std::range_error);
+}
+
+TEST(TestThreadPool, Stats) {
+  s21::thread_pool pool(2);
+  pool.reset_stats();
+  EXPECT_EQ(Fib(pool, 20), 6765u);
+  pool.wait();
+  uint64_t executed = 0;
+  for (size_t i = 0; i < pool.size(); ++i) {
+    s21::thread_pool::worker_stats stats = pool.stats(i);
+    executed += stats.executed;
+    EXPECT_LE(stats.stolen, stats.executed);
+  }
+  // Fib(20) spawns 88 tasks; the caller may run some of them itself.
+  EXPECT_LE(executed, 88u);
+  pool.reset_stats();
+  EXPECT_EQ(pool.stats(0).executed, 0u);
+}
+
+TEST(TestThreadPool, DeepForkJoinFromOutsideThread) {
+  // Many small tasks waited on by a thread outside the pool; helping must
+  // not nest one subtree per wait.
+  s21::thread_pool pool(0);
+  EXPECT_EQ(Fib(pool, 27), 196418u);
+}
@@ -0,0 +1,155 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "s21_containersplus.h"
+#include "tests/s21_test_random.h"
+
+TEST(TestTimerWheel, BasicConstructor) {
+  s21::timer_wheel<int> wheel(100);
+
+  EXPECT_TRUE(wheel.empty());
+  EXPECT_EQ(wheel.size(), 0U);
+  EXPECT_EQ(wheel.now(), 100U);
+  EXPECT_EQ(wheel.advance(200, [](int) {}), 0U);
+  EXPECT_EQ(wheel.now(), 200U);
+}
+
+TEST(TestTimerWheel, FiresAtDeadlineInBatches) {
+  s21::timer_wheel<int> wheel;
+  wheel.schedule(5, 1);
+  wheel.schedule(3, 2);
+  wheel.schedule(5, 3);
+  wheel.schedule(0, 4);  // in the past: next tick
+
+  std::vector<std::pair<uint64_t, int>> fired;
+  auto record = [&](int value) { fired.emplace_back(wheel.now(), value); };
+  EXPECT_EQ(wheel.advance(4, record), 2U);
+  EXPECT_EQ(wheel.advance(5, record), 2U);
+
+  std::vector<std::pair<uint64_t, int>> expected = {
+      {1, 4}, {3, 2}, {5, 1}, {5, 3}};
+  EXPECT_EQ(fired, expected);
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TestTimerWheel, CancelIsSafeAfterFiring) {
+  s21::timer_wheel<int> wheel;
+  auto first = wheel.schedule(10, 1);
+  auto second = wheel.schedule(10, 2);
+
+  EXPECT_TRUE(wheel.cancel(first));
+  EXPECT_FALSE(wheel.cancel(first));
+  EXPECT_FALSE(wheel.pending(first));
+  EXPECT_TRUE(wheel.pending(second));
+
+  int fired = 0;
+  wheel.advance(10, [&](int value) { fired += value; });
+  EXPECT_EQ(fired, 2);
+  EXPECT_FALSE(wheel.pending(second));
+  EXPECT_FALSE(wheel.cancel(second));
+
+  // The node is reused, but the old id does not match the new timer.
+  auto third = wheel.schedule(20, 3);
+  EXPECT_FALSE(wheel.cancel(second));
+  EXPECT_TRUE(wheel.pending(third));
+  EXPECT_FALSE(wheel.pending(decltype(wheel)::timer_id()));
+}
+
+TEST(TestTimerWheel, CallbackMayScheduleAndCancel) {
+  s21::timer_wheel<int> wheel;
+  decltype(wheel)::timer_id self = wheel.schedule(7, 0);
+  decltype(wheel)::timer_id victim = wheel.schedule(7, -1);
+  std::vector<int> fired;
+  wheel.advance(100, [&](int value) {
+    fired.push_back(value);
+    if (value == 0) {
+      EXPECT_FALSE(wheel.cancel(self));
+      EXPECT_TRUE(wheel.cancel(victim));
+      wheel.schedule(wheel.now() + 3, 1);
+    }
+  });
+
+  // The victim was later in the same batch but got cancelled.
+  EXPECT_EQ(fired, (std::vector<int>{0, 1}));
+}
+
+TEST(TestTimerWheel, CascadesFromUpperLevels) {
+  s21::timer_wheel<uint64_t> wheel(12345);
+  std::vector<uint64_t> deadlines;
+  uint64_t state = 88172645463325252ull;
+  for (int i = 0; i < 3000; ++i) {
+    // Spread over every level, including far beyond the top wheel.
+    uint64_t shift = s21_test::NextRandom(state) % 40;
+    uint64_t deadline =
+        12345 + 1 + s21_test::NextRandom(state) % (uint64_t(1) << shift);
+    deadlines.push_back(deadline);
+    wheel.schedule(deadline, deadline);
+  }
+  std::sort(deadlines.begin(), deadlines.end());
+
+  // Check timers one deadline at a time so lateness shows up.
+  std::vector<uint64_t> fired;
+  size_t next = 0;
+  while (next < deadlines.size()) {
+    wheel.advance(deadlines[next], [&](uint64_t deadline) {
+      EXPECT_EQ(deadline, wheel.now());
+      fired.push_back(deadline);
+    });
+    while (next < deadlines.size() && deadlines[next] <= wheel.now()) {
+      ++next;
+    }
+    EXPECT_EQ(fired.size(), next);
+  }
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TestTimerWheel, FarTimersParkAndFireOnTime) {
+  s21::timer_wheel<int> wheel;
+  uint64_t far = (uint64_t(1) << 37) + 5;
+  wheel.schedule(far, 1);
+  wheel.schedule(far + 1, 2);
+
+  std::vector<uint64_t> at;
+  wheel.advance(far + 1, [&](int) { at.push_back(wheel.now()); });
+  EXPECT_EQ(at, (std::vector<uint64_t>{far, far + 1}));
+}
+
+TEST(TestTimerWheel, OwnsValues) {
+  auto shared = std::make_shared<int>(7);
+  {
+    s21::timer_wheel<std::shared_ptr<int>> wheel;
+    auto id = wheel.schedule(5, shared);
+    wheel.schedule(6, shared);
+    wheel.schedule(7, shared);
+    EXPECT_EQ(shared.use_count(), 4);
+    wheel.cancel(id);
+    EXPECT_EQ(shared.use_count(), 3);
+    wheel.advance(6, [](std::shared_ptr<int> &) {});
+    EXPECT_EQ(shared.use_count(), 2);
+  }
+  EXPECT_EQ(shared.use_count(), 1);
+}
+
+TEST(TestTimerWheel, ThrowingCallbackKeepsRestOfBatch) {
+  s21::timer_wheel<int> wheel;
+  wheel.schedule(3, 1);
+  wheel.schedule(3, 2);
+  wheel.schedule(3, 3);
+
+  EXPECT_THROW(wheel.advance(3,
+                             [](int value) {
+                               if (value == 1) {
+                                 throw std::runtime_error("boom");
+                               }
+                             }),
+               std::runtime_error);
+  EXPECT_EQ(wheel.size(), 2U);
+  std::vector<int> fired;
+  wheel.advance(4, [&](int value) { fired.push_back(value); });
+  EXPECT_EQ(fired, (std::vector<int>{2, 3}));
+}
@@ -0,0 +1,263 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+#include "s21_containersplus.h"
+
+namespace {
+
+template <typename List>
+std::string Text(const List &l) {
+  std::string result;
+  for (auto iter = l.cbegin(); iter != l.cend(); ++iter) {
+    result += *iter;
+  }
+  return result;
+}
+
+using SmallBlocks = s21::unrolled_list<char, 4>;
+
+}  // namespace
+
+TEST(TestUnrolledList, BasicConstructor) {
+  s21::unrolled_list<int> l;
+  EXPECT_EQ(0, l.size());
+  EXPECT_TRUE(l.empty());
+  EXPECT_EQ(l.begin(), l.end());
+  EXPECT_EQ(0, l.block_count());
+}
+
+TEST(TestUnrolledList, SizeConstructor) {
+  s21::unrolled_list<double, 8> l(24);
+  EXPECT_EQ(24, l.size());
+  EXPECT_EQ(3, l.block_count());
+  for (auto iter = l.begin(); iter != l.end(); ++iter) {
+    EXPECT_DOUBLE_EQ(0, *iter);
+  }
+}
+
+TEST(TestUnrolledList, InitializerListConstructor) {
+  SmallBlocks l({'a', 'b', 'o', 'b', 'u', 's'});
+  EXPECT_EQ(6, l.size());
+  EXPECT_EQ(2, l.block_count());
+  EXPECT_EQ('a', l.front());
+  EXPECT_EQ('s', l.back());
+  EXPECT_EQ("abobus", Text(l));
+}
+
+TEST(TestUnrolledList, CopyAndMove) {
+  SmallBlocks origin({'a', 'b', 'o', 'b', 'u', 's'});
+  SmallBlocks copy(origin);
+  EXPECT_EQ("abobus", Text(copy));
+
+  *copy.begin() = 'A';
+  EXPECT_EQ("abobus", Text(origin));
+
+  SmallBlocks moved(std::move(origin));
+  EXPECT_TRUE(origin.empty());
+  EXPECT_EQ("abobus", Text(moved));
+
+  origin = copy;
+  EXPECT_EQ("Abobus", Text(origin));
+  origin = std::move(moved);
+  EXPECT_EQ("abobus", Text(origin));
+  origin = {'c', 'o', 'o', 'l'};
+  EXPECT_EQ("cool", Text(origin));
+}
+
+TEST(TestUnrolledList, BackwardIteration) {
+  SmallBlocks l({'s', 'u', 'b', 'o', 'b', 'a'});
+  std::string text;
+  for (auto iter = l.end(); iter != l.begin();) {
+    --iter;
+    text += *iter;
+  }
+  EXPECT_EQ("abobus", text);
+}
+
+TEST(TestUnrolledList, InsertIntoFullBlock) {
+  SmallBlocks l({'a', 'b', 'b', 'u'});
+  EXPECT_EQ(1, l.block_count());
+
+  auto iter = l.begin();
+  ++iter;
+  ++iter;
+  iter = l.insert(iter, 'o');
+  EXPECT_EQ('o', *iter);
+  EXPECT_EQ(2, l.block_count());
+
+  l.insert(l.end(), 's');
+  EXPECT_EQ("abobus", Text(l));
+  EXPECT_EQ(6, l.size());
+}
+
+TEST(TestUnrolledList, InsertEverywhere) {
+  SmallBlocks l;
+  std::string expected;
+  for (int i = 0; i < 40; ++i) {
+    char c = static_cast<char>('a' + i % 26);
+    size_t pos = (i * 7) % (expected.size() + 1);
+    auto iter = l.begin();
+    for (size_t j = 0; j < pos; ++j) {
+      ++iter;
+    }
+    EXPECT_EQ(c, *l.insert(iter, c));
+    expected.insert(expected.begin() + static_cast<long>(pos), c);
+  }
+  EXPECT_EQ(expected, Text(l));
+  EXPECT_EQ(expected.size(), l.size());
+}
+
+TEST(TestUnrolledList, Erase) {
+  SmallBlocks l({'a', 'x', 'b', 'o', 'x', 'b', 'u', 's', 'x'});
+
+  for (auto iter = l.begin(); iter != l.end();) {
+    auto current = iter++;
+    if (*current == 'x') {
+      l.erase(current);
+      iter = l.begin();
+    }
+  }
+
+  EXPECT_EQ("abobus", Text(l));
+  EXPECT_EQ(6, l.size());
+}
+
+TEST(TestUnrolledList, PushPop) {
+  SmallBlocks l;
+  l.push_back('b');
+  l.push_back('u');
+  l.push_front('o');
+  l.push_front('b');
+  l.push_front('a');
+  l.push_back('s');
+  EXPECT_EQ("abobus", Text(l));
+
+  l.pop_front();
+  l.pop_back();
+  EXPECT_EQ("bobu", Text(l));
+
+  while (!l.empty()) {
+    l.pop_back();
+  }
+  EXPECT_EQ(0, l.block_count());
+}
+
+TEST(TestUnrolledList, Swap) {
+  SmallBlocks l1({'a', 'b'});
+  SmallBlocks l2({'o', 'b', 'u', 's'});
+  l1.swap(l2);
+  EXPECT_EQ("obus", Text(l1));
+  EXPECT_EQ("ab", Text(l2));
+}
+
+TEST(TestUnrolledList, Merge) {
+  s21::unrolled_list<int, 4> l1({1, 3, 5, 7, 9});
+  s21::unrolled_list<int, 4> l2({2, 4, 6, 8});
+
+  l1.merge(l2);
+
+  EXPECT_EQ(9, l1.size());
+  EXPECT_TRUE(l2.empty());
+  int i = 1;
+  for (auto iter = l1.begin(); iter != l1.end(); ++iter, ++i) {
+    EXPECT_EQ(i, *iter);
+  }
+}
+
+TEST(TestUnrolledList, SpliceMiddleOfBlock) {
+  SmallBlocks l1({'a', 'b', 'u', 's'});
+  SmallBlocks l2({'o', 'b'});
+
+  auto iter = l1.cbegin();
+  ++iter;
+  ++iter;
+  l1.splice(iter, l2);
+
+  EXPECT_EQ("abobus", Text(l1));
+  EXPECT_EQ(6, l1.size());
+  EXPECT_TRUE(l2.empty());
+}
+
+TEST(TestUnrolledList, SpliceEnds) {
+  SmallBlocks l1({'b', 'o'});
+  SmallBlocks l2({'a'});
+  SmallBlocks l3({'b', 'u', 's'});
+
+  l1.splice(l1.cbegin(), l2);
+  l1.splice(l1.cend(), l3);
+
+  EXPECT_EQ("abobus", Text(l1));
+  EXPECT_EQ(6, l1.size());
+}
+
+TEST(TestUnrolledList, Reverse) {
+  SmallBlocks l({'s', 'u', 'b', 'o', 'b', 'a'});
+  l.reverse();
+  EXPECT_EQ("abobus", Text(l));
+  EXPECT_EQ('s', l.back());
+}
+
+TEST(TestUnrolledList, Unique) {
+  SmallBlocks l({'a', 'a', 'b', 'o', 'o', 'o', 'b', 'u', 'u', 's', 's'});
+  l.unique();
+  EXPECT_EQ("abobus", Text(l));
+  EXPECT_EQ(6, l.size());
+}
+
+TEST(TestUnrolledList, Sort) {
+  s21::unrolled_list<int, 4> l({9, 4, 7, 1, 8, 2, 6, 3, 5, 0, 5});
+  l.sort();
+
+  int expected[] = {0, 1, 2, 3, 4, 5, 5, 6, 7, 8, 9};
+  EXPECT_EQ(11, l.size());
+  int i = 0;
+  for (auto iter = l.begin(); iter != l.end(); ++iter, ++i) {
+    EXPECT_EQ(expected[i], *iter);
+  }
+}
+
+TEST(TestUnrolledList, SortSingleBlock) {
+  SmallBlocks l({'u', 'a', 's', 'b'});
+  l.sort();
+  EXPECT_EQ("absu", Text(l));
+}
+
+TEST(TestUnrolledList, InsertMany) {
+  SmallBlocks l({'a', 'u', 's'});
+  auto pos = l.insert_many(++l.cbegin(), 'b', 'o', 'b');
+  EXPECT_EQ('b', *pos);
+  EXPECT_EQ("abobus", Text(l));
+
+  l.insert_many_back('!', '!');
+  l.insert_many_front('>');
+  EXPECT_EQ(">abobus!!", Text(l));
+}
+
+TEST(TestUnrolledList, NonTrivialElements) {
+  s21::unrolled_list<std::string, 3> l;
+  for (int i = 0; i < 10; ++i) {
+    l.push_front(std::string(32, static_cast<char>('a' + i)));
+  }
+  l.sort();
+  l.erase(l.begin());
+  EXPECT_EQ(9, l.size());
+  EXPECT_EQ(std::string(32, 'b'), l.front());
+  EXPECT_EQ(std::string(32, 'j'), l.back());
+}
+
+TEST(TestUnrolledList, InsertOwnElement) {
+  s21::unrolled_list<std::string, 4> l({"one", "two", "three"});
+  auto iter = l.begin();
+  l.insert(iter, *iter);
+  EXPECT_EQ("one", l.front());
+  EXPECT_EQ("one", *++l.begin());
+
+  // A full block is split before the copy would otherwise be read.
+  l.push_back("four");
+  l.insert(l.begin(), l.back());
+  EXPECT_EQ("four", l.front());
+  EXPECT_EQ("four", l.back());
+  EXPECT_EQ(6, l.size());
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <sstream>
+#include <string>
 #include <utility>
 
 #include "s21_containers.h"
@@ -337,6 +340,18 @@ TEST(TestVector, PushBack) {
   }
 }
 
+TEST(TestVector, PushBackMovesRvalues) {
+  s21::vector<std::string> vec;
+  std::string long_string(64, 'x');
+  vec.push_back(std::move(long_string));
+  // Moving the vector's own element while it reallocates.
+  vec.push_back(std::move(vec[0]));
+
+  EXPECT_EQ(vec.size(), 2U);
+  EXPECT_EQ(vec[1], std::string(64, 'x'));
+  EXPECT_TRUE(vec[0].empty());
+}
+
 TEST(TestVector, PopBack) {
   s21::vector<int> vec;
 
@@ -539,4 +554,208 @@ TEST(TestVector, InsertManyBackEmpty) {
   EXPECT_EQ('o', vec[1]);
   EXPECT_EQ('o', vec[2]);
   EXPECT_EQ('l', vec[3]);
-}
\ No newline at end of file
+}
+TEST(TestVector, InsertRange) {
+  s21::vector<int> vec({1, 5});
+  s21::vector<int> items({2, 3, 4});
+
+  auto iter = vec.insert(vec.cbegin() + 1, items.cbegin(), items.cend());
+
+  EXPECT_EQ(vec.begin() + 1, iter);
+  EXPECT_EQ(5, vec.size());
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(i + 1, vec[i]);
+  }
+}
+
+TEST(TestVector, InsertRangeEmpty) {
+  s21::vector<int> vec({1, 2});
+  s21::vector<int> items;
+
+  auto iter = vec.insert(vec.cend(), items.cbegin(), items.cend());
+
+  EXPECT_EQ(vec.end(), iter);
+  EXPECT_EQ(2, vec.size());
+}
+
+TEST(TestVector, InsertSinglePassRange) {
+  s21::vector<int> vec({0, 5});
+  std::istringstream input("1 2 3 4");
+
+  vec.insert(vec.cbegin() + 1, std::istream_iterator<int>(input),
+             std::istream_iterator<int>());
+
+  EXPECT_EQ(6, vec.size());
+  for (int i = 0; i < 6; ++i) {
+    EXPECT_EQ(i, vec[i]);
+  }
+}
+
+TEST(TestVector, InsertRangeOfItself) {
+  s21::vector<std::string> vec({"a", "b"});
+  vec.shrink_to_fit();
+
+  vec.insert(vec.cbegin(), vec.begin(), vec.end());
+  vec.insert(vec.cend(), vec.cbegin() + 1, vec.cbegin() + 3);
+
+  EXPECT_EQ(6, vec.size());
+  std::string joined;
+  for (auto iter = vec.cbegin(); iter != vec.cend(); ++iter) {
+    joined += *iter;
+  }
+  EXPECT_EQ("ababba", joined);
+}
+
+TEST(TestVector, EraseRange) {
+  s21::vector<int> vec({1, 2, 3, 4, 5, 6});
+
+  auto iter = vec.erase(vec.cbegin() + 1, vec.cbegin() + 4);
+
+  EXPECT_EQ(3, vec.size());
+  EXPECT_EQ(5, *iter);
+  EXPECT_EQ(1, vec[0]);
+  EXPECT_EQ(5, vec[1]);
+  EXPECT_EQ(6, vec[2]);
+
+  iter = vec.erase(vec.cbegin(), vec.cend());
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.end(), iter);
+}
+
+TEST(TestVector, InsertOwnElement) {
+  s21::vector<std::string> vec({"a", "b", "c"});
+  vec.shrink_to_fit();
+
+  vec.insert(vec.begin(), vec[2]);
+  vec.insert_many(vec.cbegin() + 1, vec[0], vec[3]);
+
+  EXPECT_EQ(6, vec.size());
+  EXPECT_EQ("c", vec[0]);
+  EXPECT_EQ("c", vec[1]);
+  EXPECT_EQ("c", vec[2]);
+  EXPECT_EQ("a", vec[3]);
+  EXPECT_EQ("b", vec[4]);
+  EXPECT_EQ("c", vec[5]);
+}
+
+TEST(TestVector, StringShifts) {
+  s21::vector<std::string> vec({"one", "four"});
+
+  vec.insert_many(vec.cbegin() + 1, "two", "three");
+  vec.insert_many_back("five", "six");
+  vec.erase(vec.begin() + 5);
+
+  EXPECT_EQ(5, vec.size());
+  EXPECT_EQ("one", vec[0]);
+  EXPECT_EQ("two", vec[1]);
+  EXPECT_EQ("three", vec[2]);
+  EXPECT_EQ("four", vec[3]);
+  EXPECT_EQ("five", vec[4]);
+}
+
+TEST(TestVector, GrowthPolicyFactor) {
+  s21::vector<int, s21::growth_2x> vec;
+  vec.push_back(1);
+  EXPECT_EQ(8, vec.capacity());
+
+  for (int i = 0; i < 8; ++i) {
+    vec.push_back(i);
+  }
+  EXPECT_EQ(16, vec.capacity());
+
+  s21::vector<int, s21::growth_1_5x> other;
+  other.insert_many_back(1, 2, 3, 4, 5, 6, 7, 8, 9);
+  EXPECT_EQ(9, other.capacity());
+  other.push_back(10);
+  EXPECT_EQ(13, other.capacity());
+  EXPECT_EQ(10, other.size());
+}
+
+TEST(TestVector, GrowthPolicyLargeRequest) {
+  s21::vector<int, s21::growth_2x> vec({1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+  s21::vector<int> items(100);
+
+  vec.insert(vec.cend(), items.cbegin(), items.cend());
+
+  EXPECT_EQ(110, vec.capacity());
+}
+
+TEST(TestVector, GrowthPolicyPage) {
+  s21::vector<char, s21::page_growth<4096>> vec;
+  for (int i = 0; i < 5000; ++i) {
+    vec.push_back('a');
+  }
+  EXPECT_EQ(0, vec.capacity() % 4096);
+  EXPECT_EQ(5000, vec.size());
+}
+
+TEST(TestVector, GrowthPolicySizeClass) {
+  using Policy = s21::size_class_growth<>;
+  EXPECT_EQ(8, Policy::size_class(1));
+  EXPECT_EQ(48, Policy::size_class(33));
+  EXPECT_EQ(160, Policy::size_class(129));
+  EXPECT_EQ(256, Policy::size_class(250));
+  EXPECT_EQ(320, Policy::size_class(257));
+  EXPECT_EQ(7168, Policy::size_class(6145));
+
+  s21::vector<int, Policy> vec;
+  vec.insert_many_back(1, 2, 3, 4, 5, 6, 7, 8, 9);
+  EXPECT_EQ(0, vec.capacity() * sizeof(int) % 16);
+  EXPECT_EQ(9, vec.back());
+}
+
+TEST(TestVector, MmapStorageGrowth) {
+  using MappedVector =
+      s21::vector<int, s21::growth_2x, s21::mmap_storage<4096>>;
+  MappedVector vec;
+  for (int i = 0; i < 10000; ++i) {
+    vec.push_back(i);
+  }
+  vec.insert_many(vec.cbegin(), -2, -1);
+
+  EXPECT_EQ(10002, vec.size());
+  EXPECT_EQ(-2, vec[0]);
+  EXPECT_EQ(0, vec[2]);
+  EXPECT_EQ(9999, vec.back());
+
+  vec.erase(vec.cbegin() + 100, vec.cend());
+  vec.shrink_to_fit();
+  EXPECT_EQ(100, vec.capacity());
+  EXPECT_EQ(97, vec[99]);
+}
+
+TEST(TestVector, MmapStorageZeroInitialized) {
+  using MappedVector =
+      s21::vector<long, s21::golden_growth, s21::mmap_storage<4096>>;
+  MappedVector vec(5000);
+  EXPECT_EQ(0, vec[0]);
+  EXPECT_EQ(0, vec[4999]);
+
+  vec[10] = 7;
+  vec.reserve(100000);
+  EXPECT_EQ(7, vec[10]);
+  EXPECT_EQ(0, vec.data()[99999]);
+
+  MappedVector small(3);
+  small.reserve(1000);
+  EXPECT_EQ(0, small.data()[999]);
+}
+
+TEST(TestVector, MmapStorageCopyAndMove) {
+  using MappedVector =
+      s21::vector<int, s21::golden_growth, s21::mmap_storage<4096>>;
+  MappedVector vec(2000);
+  vec[1999] = 5;
+
+  MappedVector copy(vec);
+  EXPECT_EQ(5, copy[1999]);
+
+  MappedVector moved(std::move(copy));
+  EXPECT_EQ(5, moved[1999]);
+  EXPECT_EQ(nullptr, copy.data());
+
+  copy = {1, 2, 3};
+  moved = copy;
+  EXPECT_EQ(3, moved.size());
+  EXPECT_EQ(3, moved[2]);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+TEST(TestWsDeque, OwnerIsLifo) {
+  s21::ws_deque<int> deque(2);
+  EXPECT_TRUE(deque.empty());
+  for (int i = 0; i < 100; ++i) {
+    deque.push(i);
+  }
+  EXPECT_EQ(deque.size(), 100u);
+  int value = -1;
+  for (int i = 99; i >= 0; --i) {
+    ASSERT_TRUE(deque.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(deque.pop(value));
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST(TestWsDeque, ThiefIsFifo) {
+  s21::ws_deque<int> deque;
+  for (int i = 0; i < 10; ++i) {
+    deque.push(i);
+  }
+  int value = -1;
+  ASSERT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 0);
+  ASSERT_TRUE(deque.pop(value));
+  EXPECT_EQ(value, 9);
+  ASSERT_TRUE(deque.steal(value));
+  EXPECT_EQ(value, 1);
+  EXPECT_EQ(deque.size(), 7u);
+}
+
+TEST(TestWsDeque, ConcurrentStealsTakeEachItemOnce) {
+  const int kItems = 200000;
+  const int kThieves = 3;
+  s21::ws_deque<int> deque(4);
+  std::vector<std::atomic<int>> seen(kItems);
+  std::atomic<bool> done(false);
+  std::atomic<int> taken(0);
+
+  std::vector<std::thread> thieves;
+  for (int t = 0; t < kThieves; ++t) {
+    thieves.emplace_back([&] {
+      int value;
+      while (!done.load() || !deque.empty()) {
+        if (deque.steal(value)) {
+          seen[value].fetch_add(1);
+          taken.fetch_add(1);
+        }
+      }
+    });
+  }
+  int value;
+  for (int i = 0; i < kItems; ++i) {
+    deque.push(i);
+    if (i % 3 == 0 && deque.pop(value)) {
+      seen[value].fetch_add(1);
+      taken.fetch_add(1);
+    }
+  }
+  while (deque.pop(value)) {
+    seen[value].fetch_add(1);
+    taken.fetch_add(1);
+  }
+  done.store(true);
+  for (std::thread &thief : thieves) {
+    thief.join();
+  }
+  EXPECT_EQ(taken.load(), kItems);
+  for (int i = 0; i < kItems; ++i) {
+    ASSERT_EQ(seen[i].load(), 1) << i;
+  }
+}